@@ -585,6 +585,10 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
+    #  @param zero_copy: If `True`, inputs are bound to the request without copying as described in `infer()` method
+    #                    of the `InferRequest` class, and the returned arrays are views of the output blobs
+    #                    (see `output_views` property of the `InferRequest` class), which are overwritten by
+    #                    the next inference. If `False` (default), every call returns copies of the outputs.
     #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
     #
     #  Usage example:\n
@@ -601,12 +605,13 @@ cdef class ExecutableNetwork:
     #                  ......
     #                 ]])}
     #  ```
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, zero_copy=False):
         current_request = self.requests[0]
-        current_request.infer(inputs)
+        current_request.infer(inputs, zero_copy)
         res = {}
         for out in current_request._outputs_list:
-            res[out] = deepcopy(current_request.output_blobs[out].buffer)
+            buffer = current_request._get_blob_buffer(out.encode()).to_numpy()
+            res[out] = buffer if zero_copy else buffer.copy()
         return res
 
 
@@ -736,7 +741,14 @@ cdef class ExecutableNetwork:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        cdef C.IEExecNetwork* impl = self.impl.get()
+        cdef int c_num_requests = <int> num_requests
+        cdef int64_t c_timeout = <int64_t> timeout
+        cdef int status
+        # completion callbacks of the requests need the GIL, so it is released while waiting
+        with nogil:
+            status = deref(impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -753,6 +765,7 @@ cdef class InferRequest:
     #  which stores infer requests.
     def __init__(self):
         self._user_blobs = {}
+        self._preallocated_blobs = {}
         self._inputs_list = []
         self._outputs_list = []
         self._py_callback = lambda *args, **kwargs: None
@@ -821,6 +834,18 @@ cdef class InferRequest:
             output_blobs[output] = deepcopy(blob)
         return output_blobs
 
+    ## Dictionary that maps output layer names to `numpy.ndarray` views of the output blobs of the request.
+    #
+    #  \note Unlike `output_blobs`, no data is copied. The arrays keep the memory of the blobs alive, so they stay
+    #  valid after the request is deleted, but every following inference of the request overwrites their content.
+    #  Copy the arrays which have to outlive the next inference.
+    @property
+    def output_views(self):
+        output_views = {}
+        for output in self._outputs_list:
+            output_views[output] = self._get_blob_buffer(output.encode()).to_numpy()
+        return output_views
+
     ## Sets user defined IEBlob for the infer request
     #  @param blob_name: A name of input blob
     #  @param blob: IEBlob object to set for the infer request
@@ -839,10 +864,18 @@ cdef class InferRequest:
     def set_blob(self, blob_name : str, blob : IEBlob):
         deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
         self._user_blobs[blob_name] = blob
+        self._preallocated_blobs.pop(blob_name, None)
     ## Starts synchronous inference of the infer request and fill outputs array
     #
+    #  \note The GIL is released during the inference, so other Python threads keep running.
+    #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param zero_copy: If `True`, C-contiguous arrays with the element type of the input blob are bound to
+    #                    the request as blobs without copying. The request keeps a reference to the arrays until
+    #                    other inputs are passed, and the arrays must not be modified while an inference runs.
+    #                    Other arrays are copied. If `False` (default), all inputs are copied into the blobs of
+    #                    the request.
     #  @return None
     #
     #  Usage example:\n
@@ -855,15 +888,19 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, zero_copy=False):
+        cdef C.InferRequestWrap* impl = self.impl
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, zero_copy)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param zero_copy: If `True`, inputs are bound without copying as described in `infer()` method.
+    #                    The arrays must not be modified until the request is finished.
     #  @return: None
     #
     #  Usage example:\n
@@ -873,12 +910,14 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, zero_copy=False):
+        cdef C.InferRequestWrap* impl = self.impl
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, zero_copy)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -894,6 +933,9 @@ cdef class InferRequest:
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef C.InferRequestWrap* impl = self.impl
+        cdef int64_t c_timeout
+        cdef int status
         if self._py_callback_used:
             # check request status to avoid blocking for idle requests
             status = deref(self.impl).wait(WaitMode.STATUS_ONLY)
@@ -912,7 +954,10 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1002,11 +1047,42 @@ cdef class InferRequest:
             raise ValueError("Batch size should be positive integer number but {} specified".format(size))
         deref(self.impl).setBatch(size)
 
-    def _fill_inputs(self, inputs):
+    def _fill_inputs(self, inputs, zero_copy=False):
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
+            if zero_copy and self._bind_input(k, v):
+                continue
+            if k in self._preallocated_blobs:
+                # the input was bound to an array before, so the blob which was replaced is filled instead
+                self.set_blob(k, self._preallocated_blobs[k])
             self.input_blobs[k].buffer[:] = v
 
+    # Wraps the array into a blob set to the request, returns False if the array cannot be used without a copy
+    def _bind_input(self, name, array):
+        cdef IEBlob current
+        cdef IEBlob blob
+        if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS']:
+            return False
+        if name in self._user_blobs:
+            current = self._user_blobs[name]
+        else:
+            current = IEBlob()
+            deref(self.impl).getBlobPtr(name.encode(), current._ptr)
+        tensor_desc = current.tensor_desc
+        precision = tensor_desc.precision
+        # FP16 blobs cannot be created from arrays
+        if precision not in format_map or precision == "FP16" or array.dtype != format_map[precision]:
+            return False
+        if array.size != np.prod(tensor_desc.dims):
+            return False
+
+        blob = IEBlob(tensor_desc, array)
+        deref(self.impl).setBlob(name.encode(), blob._ptr)
+        if name not in self._preallocated_blobs:
+            self._preallocated_blobs[name] = current
+        self._user_blobs[name] = blob
+        return True
+
 
 ## Layer calibration statistic container.
 class LayerStats:
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+"""
+ Copyright (C) 2020 Intel Corporation
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ Throughput of synchronous InferRequest.infer() called from several Python threads, each of them with its own
+ request. While the GIL is held during inference the threads run one at a time, so the throughput does not grow
+ with the number of threads. Run it against the builds before and after a change to compare them, e.g.
+
+     python benchmark_threaded_infer.py -m model.xml -d CPU -t 1 2 4 8 --zero_copy
+
+ It is not collected by pytest.
+"""
+from __future__ import print_function
+import sys
+import threading
+import time
+from argparse import ArgumentParser, SUPPRESS
+import logging as log
+import numpy as np
+from openvino.inference_engine import IECore
+
+
+def build_argparser():
+    parser = ArgumentParser(add_help=False)
+    args = parser.add_argument_group('Options')
+    args.add_argument('-h', '--help', action='help', default=SUPPRESS, help='Show this help message and exit.')
+    args.add_argument("-m", "--model", help="Required. Path to an .xml file with a trained model.",
+                      required=True, type=str)
+    args.add_argument("-d", "--device", help="Optional. Target device. Default value is CPU", default="CPU", type=str)
+    args.add_argument("-t", "--threads", help="Optional. Numbers of Python threads to measure. Default value is 1 2 4",
+                      default=[1, 2, 4], nargs="+", type=int)
+    args.add_argument("-s", "--seconds", help="Optional. Measurement time for every number of threads, seconds. "
+                      "Default value is 5", default=5., type=float)
+    args.add_argument("--zero_copy", help="Optional. Pass inputs with zero_copy=True", action="store_true")
+    return parser
+
+
+def measure(exec_net, inputs, threads, seconds, zero_copy):
+    counters = [0] * threads
+    deadline = time.time() + seconds
+
+    def run(index):
+        request = exec_net.requests[index]
+        request.infer(inputs, zero_copy=zero_copy)  # warm-up
+        while time.time() < deadline:
+            request.infer(inputs, zero_copy=zero_copy)
+            counters[index] += 1
+
+    workers = [threading.Thread(target=run, args=(i,)) for i in range(threads)]
+    start = time.time()
+    for worker in workers:
+        worker.start()
+    for worker in workers:
+        worker.join()
+    return sum(counters) / (time.time() - start)
+
+
+def main():
+    log.basicConfig(format="[ %(levelname)s ] %(message)s", level=log.INFO, stream=sys.stdout)
+    args = build_argparser().parse_args()
+
+    ie = IECore()
+    net = ie.read_network(model=args.model, weights=args.model[:-4] + ".bin")
+    max_threads = max(args.threads)
+    # a stream per Python thread, so the device is not the bottleneck
+    config = {"CPU_THROUGHPUT_STREAMS": str(max_threads)} if args.device == "CPU" else {}
+    exec_net = ie.load_network(network=net, device_name=args.device, config=config, num_requests=max_threads)
+
+    inputs = {}
+    for name, data in net.inputs.items():
+        inputs[name] = np.random.uniform(0., 1., data.shape).astype(np.float32)
+
+    baseline = None
+    for threads in args.threads:
+        fps = measure(exec_net, inputs, threads, args.seconds, args.zero_copy)
+        baseline = baseline or fps
+        log.info("threads: {:3d}  throughput: {:10.2f} FPS  scaling: {:5.2f}x".format(threads, fps, fps / baseline))
+
+
+if __name__ == '__main__':
+    sys.exit(main() or 0)
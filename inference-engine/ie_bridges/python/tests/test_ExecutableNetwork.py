@@ -35,6 +35,18 @@ def test_infer(device):
     del ie_core
 
 
+def test_infer_zero_copy(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    exec_net = ie_core.load_network(net, device)
+    img = read_image().astype(np.float32)
+    res = exec_net.infer({'data': img}, zero_copy=True)
+    assert np.argmax(res['fc_out'][0]) == 2
+    assert np.shares_memory(res['fc_out'], exec_net.requests[0].output_views['fc_out'])
+    del exec_net
+    del ie_core
+
+
 def test_infer_net_from_buffer(device):
     ie_core = ie.IECore()
     with open(test_net_bin, 'rb') as f:
@@ -277,6 +277,40 @@ def test_infer_modify_outputs(device):
     del net
 
 
+def test_infer_zero_copy_inputs(device):
+    exec_net = load_sample_model(device)
+    img = np.ascontiguousarray(read_image())
+    request = exec_net.requests[0]
+    request.infer({'data': img}, zero_copy=True)
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    # without zero_copy the data is copied to the blob of the request again
+    request.infer({'data': img})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    del exec_net
+
+
+def test_infer_zero_copy_falls_back_to_copy(device):
+    exec_net = load_sample_model(device)
+    img = np.asfortranarray(read_image())
+    request = exec_net.requests[0]
+    request.infer({'data': img}, zero_copy=True)
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    del exec_net
+
+
+def test_output_views(device):
+    exec_net = load_sample_model(device)
+    request = exec_net.requests[0]
+    request.infer({'data': read_image()})
+    views = request.output_views
+    assert np.array_equal(views['fc_out'], request.output_blobs['fc_out'].buffer)
+    assert np.shares_memory(views['fc_out'], request.output_views['fc_out'])
+    del exec_net
+
+
 def test_async_infer_callback(device):
     def static_vars(**kwargs):
         def decorate(func):
@@ -129,6 +129,23 @@ public:
         const CNNNetwork& network, const std::string& deviceName,
         const std::map<std::string, std::string>& config = {});
 
+    /**
+     * @brief Reads a model and creates an executable network from it.
+     *
+     * If the KEY_CACHE_DIR config key is set for the Core and the device supports import, the compiled
+     * network is stored in the cache directory and imported from there by the next calls with the same model
+     * files, device and config instead of compiling the network again.
+     *
+     * @param modelPath A path to the model file. Weights are read from the bin file with the same name if it exists
+     * @param deviceName Name of device to load network to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @return An executable network reference
+     */
+    ExecutableNetwork LoadNetwork(
+        const std::string& modelPath, const std::string& deviceName,
+        const std::map<std::string, std::string>& config = {});
+
     /**
      * @brief Registers extension
      * @param extension Pointer to already loaded extension
@@ -209,7 +226,8 @@ public:
      * @brief Sets configuration for device, acceptable keys can be found in ie_plugin_config.hpp
      *
      * @param deviceName An optinal name of a device. If device name is not specified, the config is set for all the
-     * registered devices.
+     * registered devices. KEY_CACHE_DIR and KEY_CACHE_MAX_SIZE configure the Core itself and are accepted only
+     * without a device name.
      *
      * @param config Map of pairs: (config parameter name, config parameter value)
      */
@@ -18,6 +18,7 @@
 #include <string>
 
 #include "ie_common.h"
+#include "ie_imemory_state.hpp"
 #include "ie_preprocess.hpp"
 
 namespace InferenceEngine {
@@ -178,6 +179,20 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Gets state control interface for the given infer request.
+     *
+     * State of a recurrent network is kept by every infer request separately, so requests created by the same
+     * executable network can process independent sequences in parallel
+     *
+     * @param pState reference to a pointer that receives internal states
+     * @param idx requested index for receiving memory state
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for
+     * given index
+     */
+    virtual StatusCode QueryState(IMemoryState::Ptr& pState, size_t idx, ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
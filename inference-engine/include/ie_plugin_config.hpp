@@ -12,8 +12,12 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace InferenceEngine {
@@ -151,11 +155,97 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric to get a bool value telling whether networks exported by the device can be imported back.
+ *
+ * Core::LoadNetwork stores compiled models in the KEY_CACHE_DIR directory only for such devices.
+ * String value is "IMPORT_EXPORT_SUPPORT"
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
+/**
+ * @brief Metric to get counters of the compiled model cache of a Core object. Query it with an empty device name.
+ *
+ * Metric returns a value of std::map<std::string, float> type with "HITS", "MISSES" and "SAVED_COMPILE_TIME_MS"
+ * entries. String value is "COMPILED_MODEL_CACHE_STATISTICS"
+ */
+DECLARE_METRIC_KEY(COMPILED_MODEL_CACHE_STATISTICS, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get counters of the process-wide cache of JIT kernels of the CPU plugin.
+ *
+ * Metric returns a value of std::map<std::string, uint64_t> type with "HITS", "MISSES" and "EVICTIONS" counters,
+ * "KERNELS" number of cached kernels and "CODE_SIZE" total size of their code in bytes.
+ * String value is "CPU_JIT_KERNEL_CACHE_STATISTICS"
+ */
+DECLARE_METRIC_KEY(CPU_JIT_KERNEL_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get per layer latency summary accumulated across all infer requests of an executable network.
+ *
+ * Available only if the network was loaded with KEY_LATENCY_HISTOGRAMS set to YES.
+ * Metric returns a value of std::map<std::string, std::map<std::string, float>> type, where key is a layer name
+ * and value contains "count", "min", "mean", "p50", "p90", "p99" and "max" entries. Latencies are in microseconds.
+ * String value is "LAYERS_LATENCY_PERCENTILES".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LAYERS_LATENCY_PERCENTILES, std::map<std::string, std::map<std::string, float>>);
+
+/**
+ * @brief Metric to get raw per layer latency histograms accumulated across all infer requests of an executable network.
+ *
+ * Available only if the network was loaded with KEY_LATENCY_HISTOGRAMS set to YES.
+ * Metric returns a value of std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> type, where key is
+ * a layer name and value is a list of non empty buckets as pairs of {bucket upper bound in nanoseconds, number of samples}.
+ * String value is "LAYERS_LATENCY_HISTOGRAMS".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LAYERS_LATENCY_HISTOGRAMS, std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>>);
+
+/**
+ * @brief Metric to verify placement of weights of an executable network on NUMA nodes.
+ *
+ * Metric returns a value of std::map<int, std::map<int, std::size_t>> type, where key is a NUMA node streams run on
+ * and value is a number of memory pages of weights used by these streams per NUMA node the pages reside on.
+ * Pages which cannot be queried are counted with -1 key. Placement is available on Linux only.
+ * String value is "WEIGHTS_NUMA_PLACEMENT".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(WEIGHTS_NUMA_PLACEMENT, std::map<int, std::map<int, std::size_t>>);
+
+/**
+ * @brief Metric to get occupancy of the streams executor shared by executable networks.
+ *
+ * Metric returns a value of std::map<std::string, uint64_t> type with "IN_FLIGHT", "QUEUED" and "COMPLETED"
+ * numbers of requests of the network, "TOTAL_IN_FLIGHT", "TOTAL_QUEUED" and "TOTAL_COMPLETED" numbers of requests
+ * of all networks sharing the executor, "MAX_IN_FLIGHT" limit of requests in the executor and "NETWORKS" number
+ * of networks sharing it. Available only if the network was loaded with KEY_CPU_SHARED_EXECUTOR set to YES.
+ * String value is "SHARED_EXECUTOR_OCCUPANCY".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(SHARED_EXECUTOR_OCCUPANCY, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get measurements the number of streams of the executable network was chosen by.
+ *
+ * Metric returns a value of std::map<int, std::pair<float, float>> type, where key is a candidate number of streams
+ * and value is a pair of throughput (inferences per second) and median latency (milliseconds) measured with it.
+ * Available only if the network was loaded with KEY_CPU_THROUGHPUT_AUTOTUNE set to YES.
+ * String value is "STREAMS_AUTOTUNE_RESULTS".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(STREAMS_AUTOTUNE_RESULTS, std::map<int, std::pair<float, float>>);
+
+/**
+ * @brief Metric to get durations of the phases of network compilation done by LoadNetwork.
+ *
+ * Metric returns a value of std::map<std::string, float> type, where key is a path of a phase in the tree of phases,
+ * e.g. "LoadNetwork/CreateGraph/CreatePrimitives", and value is its total duration in milliseconds. Durations of
+ * phases run in parallel, e.g. graph creation for several streams, are summed.
+ * String value is "COMPILE_PHASES".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(COMPILE_PHASES, std::map<std::string, float>);
+
 }  // namespace Metrics
 
 /**
@@ -217,6 +307,93 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The name for choosing the number of CPU streams by measurements at the network loading.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). The network runs with synthetic inputs for every candidate number of streams
+ * and is loaded with the one giving the highest throughput within KEY_CPU_THROUGHPUT_AUTOTUNE_MAX_LATENCY.
+ * The choice is cached per network and CPU model for the process lifetime, so the following loads are not slowed
+ * down. KEY_CPU_THROUGHPUT_STREAMS is ignored, the option has no effect together with KEY_EXCLUSIVE_ASYNC_REQUESTS.
+ */
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_AUTOTUNE);
+
+/**
+ * @brief The name for limiting the median latency of an inference when choosing the number of CPU streams.
+ *
+ * It is passed to Core::LoadNetwork() together with KEY_CPU_THROUGHPUT_AUTOTUNE, a number of milliseconds,
+ * 0 (default) means no limit. If no number of streams fits the limit, the one with the lowest latency is chosen.
+ */
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_AUTOTUNE_MAX_LATENCY);
+
+/**
+ * @brief The name for setting placement of weights on multi-socket (NUMA) systems.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::CPU_WEIGHTS_REPLICATE (a copy of weights is allocated on every NUMA node used by streams)
+ * PluginConfigParams::CPU_WEIGHTS_INTERLEAVE (a single copy of weights is interleaved over all NUMA nodes)
+ * PluginConfigParams::CPU_WEIGHTS_AUTO (default, weights are replicated unless the copies are too large)
+ * The option has an effect only if streams run on several NUMA nodes
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_NUMA_POLICY);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_REPLICATE);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_INTERLEAVE);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_AUTO);
+
+/**
+ * @brief The name for setting the density of weights below which they are stored in a packed sparse format.
+ *
+ * It is passed to Core::LoadNetwork(), a floating point share of non-zero weights in range [0, 1], 0 (default)
+ * disables the sparse format. FP32 FullyConnected layers with constant weights and no fused operations whose
+ * density does not exceed the value keep only the columns of 16 output channels with non-zero weights and skip
+ * the rest during inference. Pruned models with 70-90% of zero weights usually benefit from values about 0.3,
+ * the weights footprint shrinks when zeros are grouped by output channels.
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_DENSITY);
+
+/**
+ * @brief The name for setting the capacity of the process-wide cache of JIT kernels of the CPU plugin.
+ *
+ * It is passed to Core::SetConfig(), a non-negative integer number of bytes of code of cached kernels, 16 MB by
+ * default, 0 disables caching. The least recently used kernels are dropped from the cache above the capacity,
+ * networks which use them keep them.
+ */
+DECLARE_CONFIG_KEY(CPU_JIT_KERNEL_CACHE_CAPACITY);
+
+/**
+ * @brief The name for running requests of all CPU executable networks in one process-wide streams executor.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). Networks with the same streams and threads settings share the executor, so
+ * the cores are not oversubscribed by a thread pool per network. Requests wait in per-network queues until the
+ * executor has a free stream, the queues are served according to KEY_CPU_SHARED_EXECUTOR_WEIGHT and
+ * KEY_CPU_SHARED_EXECUTOR_QUOTA of the networks.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_EXECUTOR);
+
+/**
+ * @brief The name for setting a relative share of the shared executor the network gets under contention.
+ *
+ * It is passed to Core::LoadNetwork() together with KEY_CPU_SHARED_EXECUTOR, a positive integer value, 1 by default.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_EXECUTOR_WEIGHT);
+
+/**
+ * @brief The name for limiting the number of requests of the network running in the shared executor at once.
+ *
+ * It is passed to Core::LoadNetwork() together with KEY_CPU_SHARED_EXECUTOR, 0 (default) means no limit.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_EXECUTOR_QUOTA);
+
+/**
+ * @brief The name for limiting the number of requests of all networks running in the shared executor at once.
+ *
+ * It is passed to Core::LoadNetwork() together with KEY_CPU_SHARED_EXECUTOR, the value applies to the whole
+ * executor. The network which creates the executor sets the limit, 0 (default) means the number of streams. Later
+ * networks may pass 0 or the same limit, a different one is rejected by LoadNetwork().
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_EXECUTOR_MAX_IN_FLIGHT);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -360,5 +537,33 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The key enables accumulation of per layer latency histograms across all infer requests
+ *
+ * Should be passed into LoadNetwork method. Values are YES/NO, default is NO.
+ * Histograms are available through the LAYERS_LATENCY_PERCENTILES and LAYERS_LATENCY_HISTOGRAMS
+ * executable network metrics. Passing the RESET value to ExecutableNetwork::SetConfig clears accumulated data.
+ */
+DECLARE_CONFIG_KEY(LATENCY_HISTOGRAMS);
+DECLARE_CONFIG_VALUE(RESET);
+
+/**
+ * @brief The key sets a directory where Core::LoadNetwork(modelPath, ...) keeps compiled models
+ *
+ * Should be passed into Core::SetConfig without a device name. An empty value (the default) disables the cache.
+ * A network is imported from the cache if the model files, the device name, the plugin version and the config
+ * are the same. Only devices which report the IMPORT_EXPORT_SUPPORT metric are cached. The directory can be
+ * shared by several processes.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
+/**
+ * @brief The key limits the total size of the compiled model cache in megabytes
+ *
+ * Should be passed into Core::SetConfig without a device name. The least recently used models are removed
+ * when the limit is exceeded. Default is 0, which means no limit.
+ */
+DECLARE_CONFIG_KEY(CACHE_MAX_SIZE);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
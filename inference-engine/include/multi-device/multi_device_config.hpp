@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include "ie_plugin_config.hpp"
 
@@ -36,4 +37,27 @@ namespace MultiDeviceConfigParams {
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @def MULTI_METRIC_KEY(name)
+ * @brief A macro which provides a MULTI-mangled name for metric with name `name`
+ */
+#define MULTI_METRIC_KEY(name) METRIC_KEY(MULTI_##name)
+
+#define DECLARE_MULTI_METRIC_KEY(name, ...) DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric to get statistics the requests are scheduled to the devices by.
+ *
+ * Metric returns a value of std::map<std::string, std::map<std::string, float>> type, where key is a device name
+ * ("<device name>#<n>" for the n-th entry of a device listed in the priorities several times) and value maps
+ * "SERVICE_TIME_MS" (moving average of the request execution time on the device), "UTILIZATION" (fraction of time
+ * the infer requests of the device were busy since the network was loaded), "IN_FLIGHT", "COMPLETED" and "REQUESTS"
+ * (number of infer requests of the device). String value is "MULTI_DEVICE_STATISTICS".
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_STATISTICS, std::map<std::string, std::map<std::string, float>>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
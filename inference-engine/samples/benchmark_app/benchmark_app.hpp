@@ -88,6 +88,9 @@ static const char progress_message[] = "Optional. Show progress bar (can affect
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for load network phases option
+static const char load_phases_message[] = "Optional. Report durations of the phases of loading the network if the device supports it.";
+
 #ifdef USE_OPENCV
 // @brief message for load config option
 static const char load_config_message[] = "Optional. Path to XML/YAML/JSON file to load custom IE parameters."
@@ -176,6 +179,9 @@ DEFINE_bool(progress, false, progress_message);
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Define flag for showing durations of load network phases <br>
+DEFINE_bool(load_phases, false, load_phases_message);
+
 #ifdef USE_OPENCV
 /// @brief Define flag for loading configuration file <br>
 DEFINE_string(load_config, "", load_config_message);
@@ -223,6 +229,7 @@ static void showUsage() {
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
+    std::cout << "    -load_phases              " << load_phases_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
@@ -93,6 +93,27 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
+static void printLoadNetworkPhases(ExecutableNetwork &exeNetwork, const std::shared_ptr<StatisticsReport> &statistics) {
+    std::vector<std::string> supportedMetrics = exeNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    if (std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(COMPILE_PHASES)) == supportedMetrics.end()) {
+        slog::warn << "Durations of load network phases are not supported by the device" << slog::endl;
+        return;
+    }
+    std::map<std::string, float> phases = exeNetwork.GetMetric(METRIC_KEY(COMPILE_PHASES));
+    slog::info << "Load network phases:" << slog::endl;
+    for (auto &&phase : phases) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << phase.second;
+        auto duration_ms = ss.str();
+        slog::info << "  " << phase.first << ": " << duration_ms << " ms" << slog::endl;
+        if (statistics)
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {phase.first + " time (ms)", duration_ms}
+                                      });
+    }
+}
+
 template <typename T>
 T getMedianValue(const std::vector<T> &vec) {
     std::vector<T> sortedVec(vec);
@@ -371,6 +392,8 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"load network time (ms)", duration_ms}
                                           });
+            if (FLAGS_load_phases)
+                printLoadNetworkPhases(exeNetwork, statistics);
         } else {
             next_step();
             slog::info << "Skipping the step for compiled network" << slog::endl;
@@ -12,11 +12,8 @@ inline InferenceEngine::Blob::Ptr make_fp32_blob(InferenceEngine::Blob::Ptr fp16
          fp16_blob->getTensorDesc().getDims(), fp16_blob->getTensorDesc().getLayout() });
     fp32_blob->allocate();
 
-    int i = 0;
-    for (auto& f32Value : *fp32_blob) {
-        auto f16Value = fp16_blob->buffer().template as<InferenceEngine::PrecisionTrait<InferenceEngine::Precision::FP16>::value_type*>()[i++];
-        f32Value = InferenceEngine::PrecisionUtils::f16tof32(f16Value);
-    }
+    auto f16Data = fp16_blob->buffer().template as<InferenceEngine::PrecisionTrait<InferenceEngine::Precision::FP16>::value_type*>();
+    InferenceEngine::PrecisionUtils::f16tof32Arrays(fp32_blob->buffer().template as<float*>(), f16Data, fp32_blob->size());
 
     return static_cast<InferenceEngine::Blob::Ptr>(fp32_blob);
 }
@@ -30,8 +30,8 @@ class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafe
 
     GNAExecutableNetwork(InferenceEngine::ICNNNetwork &network, std::shared_ptr<GNAPlugin> plg)
         : plg(plg) {
-        InferenceEngine::NetPass::ConvertPrecision(network, InferenceEngine::Precision::I64, InferenceEngine::Precision::I32);
-        InferenceEngine::NetPass::ConvertPrecision(network, InferenceEngine::Precision::U64, InferenceEngine::Precision::I32);
+        InferenceEngine::NetPass::ConvertPrecision(network, {{InferenceEngine::Precision::I64, InferenceEngine::Precision::I32},
+                                                             {InferenceEngine::Precision::U64, InferenceEngine::Precision::I32}});
         plg->LoadNetwork(network);
     }
 
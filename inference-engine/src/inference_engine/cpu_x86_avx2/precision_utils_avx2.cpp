@@ -0,0 +1,212 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#include "precision_utils.h"
+
+#include <immintrin.h>  // AVX2, F16C
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+static inline bool isIdentity(float scale, float bias) {
+    return scale == 1.f && bias == 0.f;
+}
+
+static inline __m256 applyScaleBias(__m256 v, __m256 scale, __m256 bias) {
+    // multiplication and addition are not fused to keep results equal to scalar code
+    return _mm256_add_ps(_mm256_mul_ps(v, scale), bias);
+}
+
+void f16tof32Arrays_avx2(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const bool identity = isIdentity(scale, bias);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256 f = _mm256_cvtph_ps(h);
+        if (!identity)
+            f = applyScaleBias(f, vscale, vbias);
+        _mm256_storeu_ps(dst + i, f);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = identity ? f16tof32(src[i]) : f16tof32(src[i]) * scale + bias;
+    }
+}
+
+// Vector version of PrecisionUtils::f32tof16: rounds to nearest, flushes denormals to zero
+// and saturates values which do not fit into f16 range (F16C instruction produces infinity instead)
+static inline __m128i cvt_f32_f16(__m256 x) {
+    const __m256i expMaskF32 = _mm256_set1_epi32(0x7F800000);
+    const __m256i absMask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i mantMask = _mm256_set1_epi32(0x007FFFFF);
+    const __m256i signMask = _mm256_set1_epi32(0x8000);
+    const __m256i nanBit = _mm256_set1_epi32(0x0200);
+    const __m256i minNormF16 = _mm256_set1_epi32(1 << 10);
+    const __m256i maxF16 = _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m256i expBiasDiff = _mm256_set1_epi32((127 - 15) << 23);
+    const __m256 halfUlpScale = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23));
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 halfMin16 = _mm256_mul_ps(min16, _mm256_set1_ps(0.5f));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m256i u = _mm256_castps_si256(x);
+    __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), signMask);
+    __m256i a = _mm256_and_si256(u, absMask);
+    __m256i e = _mm256_and_si256(a, expMaskF32);
+
+    // NAN and INF
+    __m256i isNanInf = _mm256_cmpeq_epi32(e, expMaskF32);
+    __m256i isInf = _mm256_cmpeq_epi32(_mm256_and_si256(a, mantMask), _mm256_setzero_si256());
+    __m256i nanInf = _mm256_or_si256(_mm256_or_si256(s, _mm256_srli_epi32(a, 23 - 10)),
+                                     _mm256_andnot_si256(isInf, nanBit));
+
+    // round to nearest f16 by adding half of f16 ULP
+    __m256 v = _mm256_add_ps(_mm256_castsi256_ps(a), _mm256_mul_ps(_mm256_castsi256_ps(e), halfUlpScale));
+    __m256i r = _mm256_or_si256(_mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v), expBiasDiff), 23 - 10), s);
+
+    __m256i tooBig = _mm256_castps_si256(_mm256_cmp_ps(v, max16, _CMP_GE_OQ));
+    __m256i belowMin = _mm256_castps_si256(_mm256_cmp_ps(v, min16, _CMP_LT_OQ));
+    __m256i belowHalfMin = _mm256_castps_si256(_mm256_cmp_ps(v, halfMin16, _CMP_LT_OQ));
+
+    r = _mm256_blendv_epi8(r, _mm256_or_si256(s, maxF16), tooBig);
+    r = _mm256_blendv_epi8(r, _mm256_or_si256(s, minNormF16), belowMin);
+    r = _mm256_blendv_epi8(r, s, belowHalfMin);
+    r = _mm256_blendv_epi8(r, nanInf, isNanInf);
+
+    // drop exponent bits shifted out of f16 range for NAN and INF like scalar code does,
+    // then all values fit into 16 bits and saturation does not change them
+    r = _mm256_and_si256(r, _mm256_set1_epi32(0xFFFF));
+    return _mm_packus_epi32(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1));
+}
+
+void f32tof16Arrays_avx2(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const bool identity = isIdentity(scale, bias);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 f = _mm256_loadu_ps(src + i);
+        if (!identity)
+            f = applyScaleBias(f, vscale, vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), cvt_f32_f16(f));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tof16(identity ? src[i] : src[i] * scale + bias);
+    }
+}
+
+void bf16tof32Arrays_avx2(float* dst, const short* src, size_t nelem) {
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256i u = _mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16);
+        _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(u));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = bf16tof32(src[i]);
+    }
+}
+
+void f32tobf16Arrays_avx2(short* dst, const float* src, size_t nelem) {
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i roundingBias = _mm256_set1_epi32(0x7FFF);
+    const __m256i quietNanBit = _mm256_set1_epi32(0x0040);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 f = _mm256_loadu_ps(src + i);
+        __m256i u = _mm256_castps_si256(f);
+        // round to nearest even
+        __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(u, 16), one);
+        __m256i r = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(roundingBias, lsb)), 16);
+        // keep NAN as quiet NAN
+        __m256i isNan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+        __m256i nan = _mm256_or_si256(_mm256_srli_epi32(u, 16), quietNanBit);
+        r = _mm256_blendv_epi8(r, nan, isNan);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_packus_epi32(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1)));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tobf16(src[i]);
+    }
+}
+
+void u8tof32Arrays_avx2(float* dst, const uint8_t* src, size_t nelem, float scale, float bias) {
+    const bool identity = isIdentity(scale, bias);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+        __m256 f = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(b));
+        if (!identity)
+            f = applyScaleBias(f, vscale, vbias);
+        _mm256_storeu_ps(dst + i, f);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = identity ? static_cast<float>(src[i]) : static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+void i8tof32Arrays_avx2(float* dst, const int8_t* src, size_t nelem, float scale, float bias) {
+    const bool identity = isIdentity(scale, bias);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+        __m256 f = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(b));
+        if (!identity)
+            f = applyScaleBias(f, vscale, vbias);
+        _mm256_storeu_ps(dst + i, f);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = identity ? static_cast<float>(src[i]) : static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+void u16tof32Arrays_avx2(float* dst, const uint16_t* src, size_t nelem, float scale, float bias) {
+    const bool identity = isIdentity(scale, bias);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256 f = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(w));
+        if (!identity)
+            f = applyScaleBias(f, vscale, vbias);
+        _mm256_storeu_ps(dst + i, f);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = identity ? static_cast<float>(src[i]) : static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+void i16tof32Arrays_avx2(float* dst, const int16_t* src, size_t nelem, float scale, float bias) {
+    const bool identity = isIdentity(scale, bias);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256 f = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(w));
+        if (!identity)
+            f = applyScaleBias(f, vscale, vbias);
+        _mm256_storeu_ps(dst + i, f);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = identity ? static_cast<float>(src[i]) : static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// Precision conversion primitives manually vectored for AVX2 + F16C
+// (w/o threads, results are bit exact with scalar implementation)
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_avx2(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays_avx2(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+void bf16tof32Arrays_avx2(float* dst, const short* src, size_t nelem);
+
+void f32tobf16Arrays_avx2(short* dst, const float* src, size_t nelem);
+
+void u8tof32Arrays_avx2(float* dst, const uint8_t* src, size_t nelem, float scale, float bias);
+
+void i8tof32Arrays_avx2(float* dst, const int8_t* src, size_t nelem, float scale, float bias);
+
+void u16tof32Arrays_avx2(float* dst, const uint16_t* src, size_t nelem, float scale, float bias);
+
+void i16tof32Arrays_avx2(float* dst, const int16_t* src, size_t nelem, float scale, float bias);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_compile_profiler.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace InferenceEngine {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// the same phase may be updated by several threads, e.g. when graphs of streams are created in parallel
+std::mutex& phasesMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<CompilePhase::Ptr>& phasesStack() {
+    thread_local std::vector<CompilePhase::Ptr> stack;
+    return stack;
+}
+
+CompilePhase::Ptr startPhase(const char* name, const CompilePhase::Ptr& parent) {
+    if (nullptr == parent) {
+        auto phase = std::make_shared<CompilePhase>();
+        phase->name = name;
+        return phase;
+    }
+    std::lock_guard<std::mutex> lock{phasesMutex()};
+    auto it = std::find_if(parent->children.begin(), parent->children.end(), [&](const CompilePhase::Ptr& child) {
+        return child->name == name;
+    });
+    if (it != parent->children.end()) {
+        return *it;
+    }
+    auto phase = std::make_shared<CompilePhase>();
+    phase->name = name;
+    parent->children.push_back(phase);
+    return phase;
+}
+
+void flatten(const CompilePhase& phase, const std::string& prefix, std::map<std::string, float>& durations) {
+    const auto path = prefix.empty() ? phase.name : prefix + "/" + phase.name;
+    durations[path] = phase.duration;
+    for (auto&& child : phase.children) {
+        flatten(*child, path, durations);
+    }
+}
+
+}  // namespace
+
+CompilePhaseScope::CompilePhaseScope(const char* name) : CompilePhaseScope{name, current()} {}
+
+CompilePhaseScope::CompilePhaseScope(const char* name, const CompilePhase::Ptr& parent)
+    : _phase{startPhase(name, parent)} {
+    phasesStack().push_back(_phase);
+    _start = Clock::now();
+}
+
+CompilePhaseScope::~CompilePhaseScope() {
+    const auto duration = std::chrono::duration<float, std::milli>(Clock::now() - _start).count();
+    {
+        std::lock_guard<std::mutex> lock{phasesMutex()};
+        _phase->count++;
+        _phase->duration += duration;
+    }
+    phasesStack().pop_back();
+}
+
+CompilePhase::Ptr CompilePhaseScope::current() {
+    auto& stack = phasesStack();
+    return stack.empty() ? nullptr : stack.back();
+}
+
+CompilePhase::Ptr CompilePhaseScope::root() {
+    auto& stack = phasesStack();
+    return stack.empty() ? nullptr : stack.front();
+}
+
+std::map<std::string, float> getCompilePhaseDurations(const CompilePhase::Ptr& root) {
+    std::map<std::string, float> durations;
+    if (nullptr != root) {
+        std::lock_guard<std::mutex> lock{phasesMutex()};
+        flatten(*root, {}, durations);
+    }
+    return durations;
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,378 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_compiled_model_cache.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+# include <direct.h>
+# include <process.h>
+# include <sys/utime.h>
+# include <windows.h>
+#else
+# include <dirent.h>
+# include <unistd.h>
+# include <utime.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+#include "details/ie_exception.hpp"
+#include "ie_common.h"
+#include "file_utils.h"
+
+namespace InferenceEngine {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr const char* kBlobExtension = ".blob";
+constexpr const char* kMetaExtension = ".meta";
+constexpr const char* kTemporaryExtension = ".tmp";
+// the meta file starts with the format and its version, entries of other versions are removed
+constexpr const char* kMetaFormat = "ie_compiled_model_cache";
+constexpr int kMetaVersion = 1;
+// temporary files of crashed processes are removed after this time
+constexpr std::time_t kStaleTemporaryTime = 60 * 60;
+
+struct CacheFile {
+    std::string name;
+    std::uint64_t size;
+    std::time_t modified;
+};
+
+// FNV-1a, the size of every part is hashed as well, so the parts cannot be shifted between each other
+class Hasher {
+public:
+    void update(const char* data, std::size_t size) {
+        for (std::size_t i = 0; i < size; i++) {
+            _hash ^= static_cast<unsigned char>(data[i]);
+            _hash *= 0x100000001b3ULL;
+        }
+    }
+
+    void update(const std::string& part) {
+        const std::uint64_t size = part.size();
+        update(reinterpret_cast<const char*>(&size), sizeof(size));
+        update(part.data(), part.size());
+    }
+
+    std::uint64_t value() const {
+        return _hash;
+    }
+
+private:
+    std::uint64_t _hash = 0xcbf29ce484222325ULL;
+};
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+    return str.size() >= suffix.size() && 0 == str.compare(str.size() - suffix.size(), suffix.size(), suffix);
+}
+
+std::vector<CacheFile> listFiles(const std::string& dir) {
+    std::vector<std::string> names;
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA(FileUtils::makePath(dir, std::string("*")).c_str(), &data);
+    if (INVALID_HANDLE_VALUE == handle) {
+        return {};
+    }
+    do {
+        names.emplace_back(data.cFileName);
+    } while (FindNextFileA(handle, &data));
+    FindClose(handle);
+#else
+    DIR* directory = opendir(dir.c_str());
+    if (nullptr == directory) {
+        return {};
+    }
+    while (auto entry = readdir(directory)) {
+        names.emplace_back(entry->d_name);
+    }
+    closedir(directory);
+#endif
+
+    std::vector<CacheFile> files;
+    for (auto&& name : names) {
+        struct stat status;
+        if (0 == stat(FileUtils::makePath(dir, name).c_str(), &status) && S_IFREG == (status.st_mode & S_IFMT)) {
+            files.push_back({name, static_cast<std::uint64_t>(status.st_size), status.st_mtime});
+        }
+    }
+    return files;
+}
+
+bool fileSize(const std::string& path, std::uint64_t& size) {
+    struct stat status;
+    if (0 != stat(path.c_str(), &status)) {
+        return false;
+    }
+    size = static_cast<std::uint64_t>(status.st_size);
+    return true;
+}
+
+// the meta file keeps the size of the blob, so a truncated blob is detected before it is imported
+bool readMeta(const std::string& metaPath, const std::string& blobPath, float& compileTime) {
+    std::ifstream meta(metaPath);
+    std::string format;
+    int version = 0;
+    std::uint64_t size = 0;
+    meta >> format >> version >> size >> compileTime;
+    std::uint64_t blobSize = 0;
+    return meta && format == kMetaFormat && version == kMetaVersion && fileSize(blobPath, blobSize) &&
+           size == blobSize;
+}
+
+// a plugin reports a blob which it cannot parse by NETWORK_NOT_READ, other errors do not damage the entry
+bool isNotRead(const details::InferenceEngineException& e) {
+    return e.hasStatus() && NETWORK_NOT_READ == e.getStatus();
+}
+
+void makeDir(const std::string& dir) {
+#ifdef _WIN32
+    _mkdir(dir.c_str());
+#else
+    mkdir(dir.c_str(), 0755);
+#endif
+}
+
+// the modification time of a blob is its last use, so eviction removes the least recently used entries
+void touch(const std::string& path) {
+#ifdef _WIN32
+    _utime(path.c_str(), nullptr);
+#else
+    utime(path.c_str(), nullptr);
+#endif
+}
+
+std::string temporarySuffix() {
+    static std::atomic<unsigned int> counter{0};
+#ifdef _WIN32
+    const auto pid = _getpid();
+#else
+    const auto pid = getpid();
+#endif
+    return kTemporaryExtension + std::to_string(pid) + "_" + std::to_string(counter++);
+}
+
+float milliseconds(Clock::duration duration) {
+    return std::chrono::duration<float, std::milli>(duration).count();
+}
+
+}  // namespace
+
+std::string CompiledModelCache::computeKey(const std::vector<std::string>& files, const std::string& deviceName,
+                                           const std::string& pluginVersion,
+                                           const std::map<std::string, std::string>& config,
+                                           const std::vector<std::string>& extensions) {
+    Hasher hasher;
+    std::vector<char> buffer(1 << 20);
+    for (auto&& file : files) {
+        std::ifstream stream(file, std::ios::binary);
+        if (!stream.is_open()) {
+            THROW_IE_EXCEPTION << "Compiled model cache failed to open " << file;
+        }
+        std::uint64_t size = 0;
+        while (stream) {
+            stream.read(buffer.data(), buffer.size());
+            hasher.update(buffer.data(), static_cast<std::size_t>(stream.gcount()));
+            size += stream.gcount();
+        }
+        hasher.update(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+    hasher.update(deviceName);
+    hasher.update(pluginVersion);
+    for (auto&& entry : config) {
+        hasher.update(entry.first);
+        hasher.update(entry.second);
+    }
+    for (auto&& extension : extensions) {
+        hasher.update(extension);
+    }
+
+    std::stringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hasher.value();
+    return key.str();
+}
+
+void CompiledModelCache::setDir(const std::string& dir) {
+    if (!dir.empty()) {
+        makeDir(dir);
+    }
+    std::lock_guard<std::mutex> lock{_mutex};
+    _dir = dir;
+}
+
+std::string CompiledModelCache::getDir() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _dir;
+}
+
+void CompiledModelCache::setMaxSize(std::uint64_t maxSize) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _maxSize = maxSize;
+}
+
+std::uint64_t CompiledModelCache::getMaxSize() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _maxSize;
+}
+
+bool CompiledModelCache::enabled() const {
+    return !getDir().empty();
+}
+
+ExecutableNetwork CompiledModelCache::load(const std::string& key, const CompileFunction& compile,
+                                           const ImportFunction& import) {
+    const auto dir = getDir();
+    if (dir.empty()) {
+        return compile();
+    }
+
+    const auto blobPath = FileUtils::makePath(dir, key + kBlobExtension);
+    const auto metaPath = FileUtils::makePath(dir, key + kMetaExtension);
+    bool keepEntry = false;
+    float compileTime = 0.f;
+    if (FileUtils::fileExist(blobPath)) {
+        bool removeEntry = !readMeta(metaPath, blobPath, compileTime);
+        if (!removeEntry) {
+            const auto start = Clock::now();
+            try {
+                auto network = import(blobPath);
+                const auto importTime = milliseconds(Clock::now() - start);
+                touch(blobPath);
+
+                std::lock_guard<std::mutex> lock{_mutex};
+                _statistics.hits++;
+                _statistics.savedCompileTime += std::max(compileTime - importTime, 0.f);
+                return network;
+            } catch (const NetworkNotRead&) {
+                removeEntry = true;
+            } catch (const details::InferenceEngineException& e) {
+                removeEntry = isNotRead(e);
+            } catch (const std::exception&) {
+                // e.g. the device is busy, the entry is imported next time
+            }
+        }
+
+        if (removeEntry) {
+            // the entry is damaged or was stored by an incompatible version of the cache or the plugin
+            std::remove(blobPath.c_str());
+            std::remove(metaPath.c_str());
+        } else {
+            keepEntry = true;
+        }
+    }
+
+    const auto start = Clock::now();
+    auto network = compile();
+    compileTime = milliseconds(Clock::now() - start);
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _statistics.misses++;
+    }
+    if (keepEntry) {
+        return network;
+    }
+
+    try {
+        store(dir, key, network, compileTime);
+    } catch (const std::exception&) {
+        // the cache is best effort, the compiled network is returned even if it cannot be exported
+    }
+    evict(dir);
+    return network;
+}
+
+CompiledModelCache::Statistics CompiledModelCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _statistics;
+}
+
+void CompiledModelCache::store(const std::string& dir, const std::string& key, ExecutableNetwork& network,
+                               float compileTime) {
+    const auto suffix = temporarySuffix();
+    const auto blobPath = FileUtils::makePath(dir, key + kBlobExtension);
+    const auto metaPath = FileUtils::makePath(dir, key + kMetaExtension);
+    const auto blobTemporaryPath = blobPath + suffix;
+    const auto metaTemporaryPath = metaPath + suffix;
+    try {
+        network.Export(blobTemporaryPath);
+        std::uint64_t blobSize = 0;
+        if (!fileSize(blobTemporaryPath, blobSize)) {
+            THROW_IE_EXCEPTION << "Compiled model cache failed to export " << blobTemporaryPath;
+        }
+        {
+            std::ofstream meta(metaTemporaryPath);
+            meta << kMetaFormat << " " << kMetaVersion << " " << blobSize << "\n" << compileTime;
+            if (!meta) {
+                THROW_IE_EXCEPTION << "Compiled model cache failed to write " << metaTemporaryPath;
+            }
+        }
+        // the blob is renamed last, so readers never find a blob without its meta file.
+        // If another process has stored the same entry meanwhile, renaming may fail on some systems,
+        // which is fine as both entries are equal
+        if (0 != std::rename(metaTemporaryPath.c_str(), metaPath.c_str()) ||
+            0 != std::rename(blobTemporaryPath.c_str(), blobPath.c_str())) {
+            THROW_IE_EXCEPTION << "Compiled model cache failed to store " << blobPath;
+        }
+    } catch (...) {
+        std::remove(blobTemporaryPath.c_str());
+        std::remove(metaTemporaryPath.c_str());
+        throw;
+    }
+}
+
+void CompiledModelCache::evict(const std::string& dir) {
+    const auto maxSize = getMaxSize();
+    const auto now = std::time(nullptr);
+
+    std::map<std::string, std::uint64_t> metaSizes;
+    std::vector<CacheFile> blobs;
+    for (auto&& file : listFiles(dir)) {
+        if (file.name.find(kTemporaryExtension) != std::string::npos) {
+            if (now - file.modified > kStaleTemporaryTime) {
+                std::remove(FileUtils::makePath(dir, file.name).c_str());
+            }
+        } else if (endsWith(file.name, kBlobExtension)) {
+            blobs.push_back(file);
+        } else if (endsWith(file.name, kMetaExtension)) {
+            metaSizes[file.name.substr(0, file.name.size() - std::string(kMetaExtension).size())] = file.size;
+        }
+    }
+    if (0 == maxSize) {
+        return;
+    }
+
+    std::uint64_t totalSize = 0;
+    for (auto&& blob : blobs) {
+        blob.name.resize(blob.name.size() - std::string(kBlobExtension).size());
+        blob.size += metaSizes[blob.name];
+        totalSize += blob.size;
+    }
+    std::sort(blobs.begin(), blobs.end(), [](const CacheFile& a, const CacheFile& b) {
+        return a.modified < b.modified;
+    });
+    for (auto&& blob : blobs) {
+        if (totalSize <= maxSize) {
+            break;
+        }
+        std::remove(FileUtils::makePath(dir, blob.name + kBlobExtension).c_str());
+        std::remove(FileUtils::makePath(dir, blob.name + kMetaExtension).c_str());
+        totalSize -= blob.size;
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,94 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_compiled_model_cache.hpp
+ * @brief A header file for the on-disk cache of compiled models used by Core::LoadNetwork
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpp/ie_executable_network.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Keeps networks exported by the devices in a directory shared by processes.
+ *
+ * Every entry is stored to a temporary file and renamed afterwards, so other processes never see
+ * a partially written blob. Entries with a meta file of another format version or a blob which the
+ * plugin cannot read are removed and compiled again. If import fails for another reason, the network is
+ * compiled and the entry is kept. When the total size of the entries exceeds the limit, the least
+ * recently used entries are removed.
+ */
+class CompiledModelCache {
+public:
+    /**
+     * @brief Counters of the cache in the current process
+     */
+    struct Statistics {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        float savedCompileTime = 0.f;  // milliseconds
+    };
+
+    using CompileFunction = std::function<ExecutableNetwork()>;
+    using ImportFunction = std::function<ExecutableNetwork(const std::string& blobPath)>;
+
+    /**
+     * @brief Computes the key of a compiled model
+     * @param files Model files and extension libraries of the device, their content is hashed
+     * @param deviceName A device name with the device ID if any
+     * @param pluginVersion Build number and description of the plugin
+     * @param config The config passed to LoadNetwork
+     * @param extensions Descriptions of the extensions added to Core
+     * @return A string usable as a file name
+     */
+    static std::string computeKey(const std::vector<std::string>& files, const std::string& deviceName,
+                                  const std::string& pluginVersion, const std::map<std::string, std::string>& config,
+                                  const std::vector<std::string>& extensions = {});
+
+    /**
+     * @brief Sets the cache directory, an empty string disables the cache
+     */
+    void setDir(const std::string& dir);
+    std::string getDir() const;
+
+    /**
+     * @brief Sets the limit of the total size of the cache entries in bytes, 0 means no limit
+     */
+    void setMaxSize(std::uint64_t maxSize);
+    std::uint64_t getMaxSize() const;
+
+    bool enabled() const;
+
+    /**
+     * @brief Imports the network stored under the key or compiles and stores it
+     * @param key A key returned by computeKey
+     * @param compile Compiles the network on a miss
+     * @param import Imports the network from a blob file on a hit
+     * @return The executable network
+     */
+    ExecutableNetwork load(const std::string& key, const CompileFunction& compile, const ImportFunction& import);
+
+    Statistics getStatistics() const;
+
+private:
+    void store(const std::string& dir, const std::string& key, ExecutableNetwork& network, float compileTime);
+    void evict(const std::string& dir);
+
+    mutable std::mutex _mutex;
+    std::string _dir;
+    std::uint64_t _maxSize = 0;
+    Statistics _statistics;
+};
+
+}  // namespace InferenceEngine
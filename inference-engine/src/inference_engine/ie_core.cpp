@@ -4,6 +4,7 @@
 
 #include "ie_core.hpp"
 
+#include <algorithm>
 #include <unordered_set>
 #include <fstream>
 #include <functional>
@@ -23,6 +24,8 @@
 #include "details/ie_exception_conversion.hpp"
 #include "details/ie_so_pointer.hpp"
 #include "file_utils.h"
+#include "ie_compile_profiler.hpp"
+#include "ie_compiled_model_cache.hpp"
 #include "ie_icore.hpp"
 #include "ie_plugin.hpp"
 #include "ie_plugin_config.hpp"
@@ -99,6 +102,37 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     return {deviceName_, config_};
 }
 
+// the bin file with the same name as the model, empty if it does not exist
+std::string getDefaultWeightsPath(const std::string& modelPath) {
+    std::string binPath = modelPath;
+    auto pos = binPath.rfind('.');
+    if (pos != std::string::npos) binPath = binPath.substr(0, pos);
+    binPath += ".bin";
+
+    if (!FileUtils::fileExist(binPath)) binPath.clear();
+    return binPath;
+}
+
+// version and opsets of an extension added with Core::AddExtension, the library path is not known here
+std::string describeExtension(IExtension& extension) {
+    std::stringstream description;
+    const Version* version = nullptr;
+    extension.GetVersion(version);
+    if (version != nullptr) {
+        description << version->apiVersion.major << "." << version->apiVersion.minor << " "
+                    << (version->buildNumber ? version->buildNumber : "") << " "
+                    << (version->description ? version->description : "");
+    }
+    for (auto&& opset : extension.getOpSets()) {
+        description << " " << opset.first;
+    }
+    return description.str();
+}
+
+bool isCompiledModelCacheKey(const std::string& key) {
+    return key == CONFIG_KEY(CACHE_DIR) || key == CONFIG_KEY(CACHE_MAX_SIZE);
+}
+
 Parameter copyParameterValue(const Parameter & value) {
     if (value.is<bool>()) {
         return { value.as<bool>() };
@@ -227,6 +261,8 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    CompiledModelCache compiledModelCache;
+
 public:
     Impl();
     ~Impl() override;
@@ -311,6 +347,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         IE_PROFILING_AUTO_SCOPE(Core::ReadNetwork)
+        IE_COMPILE_PHASE("ReadNetwork");
         IE_SUPPRESS_DEPRECATED_START
         ResponseDesc desc;
         CNNNetReaderPtr cnnReader(createCnnReaderLoader());
@@ -322,12 +359,7 @@ public:
         }
         std::string bPath = binPath;
         if (bPath.empty()) {
-            bPath = modelPath;
-            auto pos = bPath.rfind('.');
-            if (pos != std::string::npos) bPath = bPath.substr(0, pos);
-            bPath += ".bin";
-
-            if (!FileUtils::fileExist(bPath)) bPath.clear();
+            bPath = getDefaultWeightsPath(modelPath);
         }
 
         if (!bPath.empty()) {
@@ -345,6 +377,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
         IE_PROFILING_AUTO_SCOPE(Core::ReadNetwork)
+        IE_COMPILE_PHASE("ReadNetwork");
         IE_SUPPRESS_DEPRECATED_START
         ResponseDesc desc;
         CNNNetReaderPtr cnnReader(createCnnReaderLoader());
@@ -368,12 +401,79 @@ public:
     ExecutableNetwork LoadNetwork(const CNNNetwork& network, const std::string& deviceName,
                                   const std::map<std::string, std::string>& config) override {
         IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork)
+        IE_COMPILE_PHASE("LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         IE_SUPPRESS_DEPRECATED_START
         return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
         IE_SUPPRESS_DEPRECATED_END
     }
 
+    ExecutableNetwork LoadNetwork(const std::string& modelPath, const std::string& deviceName,
+                                  const std::map<std::string, std::string>& config) {
+        IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork)
+        IE_COMPILE_PHASE("LoadNetwork");
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        if (!compiledModelCache.enabled() || !DeviceSupportsImportExport(parsed._deviceName)) {
+            // the plugin is called directly, so reading of the model is a phase of the same LoadNetwork
+            IE_SUPPRESS_DEPRECATED_START
+            return GetCPPPluginByName(parsed._deviceName).LoadNetwork(ReadNetwork(modelPath, std::string()),
+                                                                      parsed._config);
+            IE_SUPPRESS_DEPRECATED_END
+        }
+
+        IE_SUPPRESS_DEPRECATED_START
+        auto cppPlugin = GetCPPPluginByName(parsed._deviceName);
+        const Version* version = cppPlugin.GetVersion();
+        IE_SUPPRESS_DEPRECATED_END
+
+        std::vector<std::string> modelFiles = {modelPath};
+        auto binPath = getDefaultWeightsPath(modelPath);
+        if (!binPath.empty()) modelFiles.push_back(binPath);
+        std::string pluginVersion = version->buildNumber;
+        pluginVersion += version->description;
+        // the config set for the device with SetConfig and the extensions affect the compilation as well
+        std::map<std::string, std::string> keyConfig;
+        std::vector<std::string> keyExtensions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            const auto& desc = pluginRegistry.at(parsed._deviceName);
+            keyConfig = desc.defaultConfig;
+            for (auto&& extensionLocation : desc.listOfExtentions) {
+                modelFiles.push_back(FileUtils::fromFilePath(extensionLocation));
+            }
+            for (auto&& extension : extensions) {
+                keyExtensions.push_back(describeExtension(*extension));
+            }
+        }
+        for (auto&& entry : parsed._config) {
+            keyConfig[entry.first] = entry.second;
+        }
+        std::string key;
+        {
+            IE_COMPILE_PHASE("ComputeCacheKey");
+            key = CompiledModelCache::computeKey(modelFiles, deviceName, pluginVersion, keyConfig, keyExtensions);
+        }
+
+        IE_SUPPRESS_DEPRECATED_START
+        return compiledModelCache.load(key,
+            [&] { return cppPlugin.LoadNetwork(ReadNetwork(modelPath, std::string()), parsed._config); },
+            [&](const std::string& blobPath) {
+                IE_COMPILE_PHASE("ImportNetwork");
+                return cppPlugin.ImportNetwork(blobPath, parsed._config);
+            });
+        IE_SUPPRESS_DEPRECATED_END
+    }
+
+    bool DeviceSupportsImportExport(const std::string& deviceName) const {
+        try {
+            auto supportedMetrics = GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+            auto it = std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+            return it != supportedMetrics.end() && GetMetric(deviceName, METRIC_KEY(IMPORT_EXPORT_SUPPORT)).as<bool>();
+        } catch (const details::InferenceEngineException&) {
+            return false;
+        }
+    }
+
     IE_SUPPRESS_DEPRECATED_START
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -636,6 +736,14 @@ public:
     const std::vector<IExtensionPtr>& GetExtensions() const {
         return extensions;
     }
+
+    /**
+     * @brief Provides the compiled model cache used by LoadNetwork with a model path
+     * @return A reference to the cache
+     */
+    CompiledModelCache& GetCompiledModelCache() {
+        return compiledModelCache;
+    }
 };
 
 Core::Impl::Impl() {
@@ -714,6 +822,11 @@ ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, const std::string
     return _impl->LoadNetwork(network, deviceName, config);
 }
 
+ExecutableNetwork Core::LoadNetwork(const std::string& modelPath, const std::string& deviceName,
+                                    const std::map<std::string, std::string>& config) {
+    return _impl->LoadNetwork(modelPath, deviceName, config);
+}
+
 void Core::AddExtension(const IExtensionPtr& extension) {
     _impl->AddExtension(extension);
 }
@@ -721,6 +834,7 @@ void Core::AddExtension(const IExtensionPtr& extension) {
 ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, RemoteContext::Ptr context,
                                     const std::map<std::string, std::string>& config) {
     IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork)
+    IE_COMPILE_PHASE("LoadNetwork");
     std::map<std::string, std::string> config_ = config;
 
     if (context == nullptr) {
@@ -872,14 +986,46 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
     }
 
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        std::map<std::string, std::string> pluginsConfig;
+        for (auto&& entry : config) {
+            if (entry.first == CONFIG_KEY(CACHE_DIR)) {
+                _impl->GetCompiledModelCache().setDir(entry.second);
+            } else if (entry.first == CONFIG_KEY(CACHE_MAX_SIZE)) {
+                int maxSize = -1;
+                try {
+                    maxSize = std::stoi(entry.second);
+                } catch (const std::exception&) {
+                }
+                if (maxSize < 0) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CACHE_MAX_SIZE)
+                                       << ". Expected only non negative integer numbers";
+                }
+                _impl->GetCompiledModelCache().setMaxSize(static_cast<std::uint64_t>(maxSize) << 20);
+            } else {
+                pluginsConfig.insert(entry);
+            }
+        }
+        _impl->SetConfigForPlugins(pluginsConfig, std::string());
     } else {
+        for (auto&& entry : config) {
+            if (isCompiledModelCacheKey(entry.first)) {
+                THROW_IE_EXCEPTION << entry.first << " is a Core config key, it can be set only without a device name";
+            }
+        }
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
     }
 }
 
 Parameter Core::GetConfig(const std::string& deviceName, const std::string& name) const {
+    if (deviceName.empty() && isCompiledModelCacheKey(name)) {
+        auto& cache = _impl->GetCompiledModelCache();
+        if (name == CONFIG_KEY(CACHE_DIR)) {
+            return cache.getDir();
+        }
+        return std::to_string(cache.getMaxSize() >> 20);
+    }
+
     // HETERO case
     {
         if (deviceName.find("HETERO:") == 0) {
@@ -914,6 +1060,16 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
 }
 
 Parameter Core::GetMetric(const std::string& deviceName, const std::string& name) const {
+    if (deviceName.empty() && name == METRIC_KEY(COMPILED_MODEL_CACHE_STATISTICS)) {
+        auto statistics = _impl->GetCompiledModelCache().getStatistics();
+        std::map<std::string, float> result = {
+            {"HITS", static_cast<float>(statistics.hits)},
+            {"MISSES", static_cast<float>(statistics.misses)},
+            {"SAVED_COMPILE_TIME_MS", statistics.savedCompileTime},
+        };
+        return result;
+    }
+
     return _impl->GetMetric(deviceName, name);
 }
 
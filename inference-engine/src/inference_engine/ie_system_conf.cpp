@@ -139,6 +139,10 @@ bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
 // for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) implementation is OS-specific
 // (see cpp files in corresponding folders), for __APPLE__ it is default :
 int getNumberOfCPUCores() { return parallel_get_max_threads();}
+std::vector<int> getNUMANodeCPUs(int) { return {}; }
+int getNUMANodeOfCPU(int) { return -1; }
+bool moveMemoryToNUMANodes(const void*, size_t, const std::vector<int>&) { return false; }
+std::map<int, size_t> getMemoryNUMAPlacement(const void*, size_t) { return {}; }
 #if !((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() { return {0}; }
 #endif
@@ -2,16 +2,21 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
 #include "details/ie_exception.hpp"
 #include <numeric>
+#include <sstream>
 
 
 namespace InferenceEngine {
@@ -84,4 +89,101 @@ int getNumberOfCPUCores() {
     return CPU_COUNT(&currentCoreSet);
 }
 
+std::vector<int> getNUMANodeCPUs(int numaNode) {
+    // the list has "0-3,8-11" format
+    std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(numaNode) + "/cpulist");
+    std::vector<int> cpus;
+    std::string range;
+    while (std::getline(cpulist, range, ',')) {
+        if (range.empty() || range == "\n") continue;
+        auto delimeter = range.find('-');
+        int first = std::stoi(range.substr(0, delimeter));
+        int last = (delimeter == std::string::npos) ? first : std::stoi(range.substr(delimeter + 1));
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+int getNUMANodeOfCPU(int cpu) {
+    static const std::map<int, int> cpuToNode = [] {
+        std::map<int, int> result;
+        for (auto node : getAvailableNUMANodes()) {
+            for (auto nodeCpu : getNUMANodeCPUs(node)) {
+                result[nodeCpu] = node;
+            }
+        }
+        return result;
+    }();
+    auto found = cpuToNode.find(cpu);
+    return found == cpuToNode.end() ? -1 : found->second;
+}
+
+#if defined(SYS_move_pages)
+namespace {
+constexpr int kMoveMemoryFlag = 1 << 1;  // MPOL_MF_MOVE
+constexpr size_t kPagesPerCall = 1024;
+
+// Calls move_pages for all pages of the buffer by chunks. If numaNodes is empty, placement is only queried.
+// Only pages which lie fully inside the buffer are visited, as the rest of partially covered pages belongs
+// to other allocations.
+template <typename Consumer>
+bool forEachPagesChunk(const void* ptr, size_t size, const std::vector<int>& numaNodes, const Consumer& consume) {
+    if (nullptr == ptr || 0 == size) return true;
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) & ~(pageSize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(pageSize - 1);
+    if (end <= begin) return true;
+    const size_t pagesNum = (end - begin) / pageSize;
+
+    std::vector<void*> pages;
+    std::vector<int> nodes;
+    std::vector<int> status;
+    bool result = true;
+    for (size_t first = 0; first < pagesNum; first += kPagesPerCall) {
+        const size_t count = std::min(kPagesPerCall, pagesNum - first);
+        pages.resize(count);
+        status.assign(count, -1);
+        nodes.resize(numaNodes.empty() ? 0 : count);
+        for (size_t i = 0; i < count; i++) {
+            pages[i] = reinterpret_cast<void*>(begin + (first + i) * pageSize);
+            if (!numaNodes.empty()) nodes[i] = numaNodes[(first + i) % numaNodes.size()];
+        }
+        if (0 != syscall(SYS_move_pages, 0, count, pages.data(), nodes.empty() ? nullptr : nodes.data(),
+                         status.data(), numaNodes.empty() ? 0 : kMoveMemoryFlag)) {
+            result = false;
+        }
+        consume(status);
+    }
+    return result;
+}
+}  // namespace
+
+bool moveMemoryToNUMANodes(const void* ptr, size_t size, const std::vector<int>& numaNodes) {
+    if (numaNodes.empty()) return false;
+    bool allMoved = true;
+    bool result = forEachPagesChunk(ptr, size, numaNodes, [&](const std::vector<int>& status) {
+        for (auto s : status) allMoved &= s >= 0;
+    });
+    return result && allMoved;
+}
+
+std::map<int, size_t> getMemoryNUMAPlacement(const void* ptr, size_t size) {
+    std::map<int, size_t> placement;
+    forEachPagesChunk(ptr, size, {}, [&](const std::vector<int>& status) {
+        for (auto s : status) placement[s < 0 ? -1 : s]++;
+    });
+    return placement;
+}
+#else
+bool moveMemoryToNUMANodes(const void*, size_t, const std::vector<int>&) {
+    return false;
+}
+
+std::map<int, size_t> getMemoryNUMAPlacement(const void*, size_t) {
+    return {};
+}
+#endif
+
 }  // namespace InferenceEngine
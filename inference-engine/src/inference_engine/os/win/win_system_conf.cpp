@@ -3,6 +3,7 @@
 //
 
 #include <windows.h>
+#include <map>
 #include <memory>
 #include <vector>
 #include "ie_system_conf.h"
@@ -36,4 +37,9 @@ int getNumberOfCPUCores() {
 std::vector<int> getAvailableNUMANodes() { return std::vector<int>(1, 0); }
 #endif
 
+std::vector<int> getNUMANodeCPUs(int) { return {}; }
+int getNUMANodeOfCPU(int) { return -1; }
+bool moveMemoryToNUMANodes(const void*, size_t, const std::vector<int>&) { return false; }
+std::map<int, size_t> getMemoryNUMAPlacement(const void*, size_t) { return {}; }
+
 }  // namespace InferenceEngine
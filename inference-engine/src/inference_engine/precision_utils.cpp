@@ -4,24 +4,163 @@
 
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
 
+#include <algorithm>
 #include <stdint.h>
 
+#ifdef HAVE_AVX2_F16C
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+// Arrays are split into blocks of this size which are converted in parallel,
+// smaller arrays are converted in the calling thread to avoid threading overhead
+constexpr size_t kParallelBlockSize = 16 * 1024;
+
+template <typename Convert>
+void convertByBlocks(size_t nelem, const Convert& convert) {
+    if (nelem <= kParallelBlockSize) {
+        convert(0, nelem);
+        return;
     }
+    const size_t blocksNum = (nelem + kParallelBlockSize - 1) / kParallelBlockSize;
+    parallel_for(blocksNum, [&](size_t block) {
+        const size_t start = block * kParallelBlockSize;
+        convert(start, (std::min)(kParallelBlockSize, nelem - start));
+    });
+}
+
+// scale and bias are not applied when they do not change the value to keep the sign of zero
+inline float scaleShift(float value, float scale, float bias) {
+    return (scale == 1.f && bias == 0.f) ? value : value * scale + bias;
+}
+
+#ifdef HAVE_AVX2_F16C
+bool useAvx2() {
+    // all known AVX2 capable processors support F16C as well
+    static const bool avx2 = with_cpu_x86_avx2();
+    return avx2;
+}
+#endif
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            f16tof32Arrays_avx2(dst + start, src + start, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = scaleShift(PrecisionUtils::f16tof32(src[i]), scale, bias);
+        }
+    });
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            f32tof16Arrays_avx2(dst + start, src + start, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = PrecisionUtils::f32tof16(scaleShift(src[i], scale, bias));
+        }
+    });
+}
+
+void bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem) {
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            bf16tof32Arrays_avx2(dst + start, src + start, count);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = PrecisionUtils::bf16tof32(src[i]);
+        }
+    });
+}
+
+void f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem) {
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            f32tobf16Arrays_avx2(dst + start, src + start, count);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = PrecisionUtils::f32tobf16(src[i]);
+        }
+    });
+}
+
+void u8tof32Arrays(float* dst, const uint8_t* src, size_t nelem, float scale, float bias) {
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            u8tof32Arrays_avx2(dst + start, src + start, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = scaleShift(static_cast<float>(src[i]), scale, bias);
+        }
+    });
+}
+
+void i8tof32Arrays(float* dst, const int8_t* src, size_t nelem, float scale, float bias) {
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            i8tof32Arrays_avx2(dst + start, src + start, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = scaleShift(static_cast<float>(src[i]), scale, bias);
+        }
+    });
+}
+
+void u16tof32Arrays(float* dst, const uint16_t* src, size_t nelem, float scale, float bias) {
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            u16tof32Arrays_avx2(dst + start, src + start, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = scaleShift(static_cast<float>(src[i]), scale, bias);
+        }
+    });
+}
+
+void i16tof32Arrays(float* dst, const int16_t* src, size_t nelem, float scale, float bias) {
+    convertByBlocks(nelem, [&](size_t start, size_t count) {
+#ifdef HAVE_AVX2_F16C
+        if (useAvx2()) {
+            i16tof32Arrays_avx2(dst + start, src + start, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = start; i < start + count; i++) {
+            dst[i] = scaleShift(static_cast<float>(src[i]), scale, bias);
+        }
+    });
 }
 
 // Function to convert F32 into F16
@@ -164,5 +303,26 @@ ie_fp16 f32tof16(float x) {
     return v.u | s;
 }
 
+// BF16 is the upper half of F32, so conversion is rounding of the lower half
+// to nearest even. NAN values are kept as quiet NAN.
+ie_bf16 f32tobf16(float x) {
+    union {
+        float f;
+        uint32_t u;
+    } v;
+    v.f = x;
+
+    if ((v.u & 0x7FFFFFFF) > EXP_MASK_F32) {
+        return static_cast<ie_bf16>((v.u >> 16) | 0x0040);
+    }
+
+    v.u += 0x7FFF + ((v.u >> 16) & 1);
+    return static_cast<ie_bf16>(v.u >> 16);
+}
+
+float bf16tof32(ie_bf16 x) {
+    return asfloat(static_cast<uint32_t>(static_cast<uint16_t>(x)) << 16);
+}
+
 }  // namespace PrecisionUtils
 }  // namespace InferenceEngine
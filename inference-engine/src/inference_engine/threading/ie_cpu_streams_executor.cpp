@@ -13,6 +13,8 @@
 #include <climits>
 #include <cassert>
 #include <utility>
+#include <numeric>
+#include <algorithm>
 #include "threading/ie_thread_local.hpp"
 #include "ie_profiling.hpp"
 #include "ie_parallel.hpp"
@@ -64,9 +66,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_usedNumaNodes.at(
-                (_streamId % _impl->_config._streams)/
-                ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()));
+            _numaNodeId = _impl->_streamNumaNodes.at(_streamId % _impl->_streamNumaNodes.size());
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -149,6 +149,9 @@ struct CPUStreamsExecutor::Impl {
                                       static_cast<std::size_t>(_config._streams)),
                              numaNodes.size()),
                     std::back_inserter(_usedNumaNodes));
+        for (auto streamId = 0; streamId < std::max(1, _config._streams); ++streamId) {
+            _streamNumaNodes.push_back(GetStreamNumaNodeId(streamId));
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 annotateSetThreadName((_config._name + "_" + std::to_string(streamId)).c_str());
@@ -170,6 +173,41 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    // Returns NUMA node the stream threads run on, which is derived from the actual cores topology
+    int GetStreamNumaNodeId(int streamId) const {
+        const int streams = std::max(1, _config._streams);
+        if (ThreadBindingType::CORES == _config._threadBindingType) {
+            // the node of the first core the stream threads are pinned to
+            CpuSet processMask;
+            int    ncpus = 0;
+            std::tie(processMask, ncpus) = GetProcessMask();
+            const int threadsPerStream = std::max(1, _config._threadsPerStream);
+            const int cpu = GetVacantCoreId(streamId * threadsPerStream + _config._threadBindingOffset,
+                                            _config._threadBindingStep, ncpus, processMask);
+            const int numaNode = getNUMANodeOfCPU(cpu);
+            const auto numaNodes = getAvailableNUMANodes();
+            if (std::find(std::begin(numaNodes), std::end(numaNodes), numaNode) != std::end(numaNodes)) {
+                return numaNode;
+            }
+        }
+        // streams are distributed over the used nodes proportionally to the number of processors of the nodes
+        std::vector<std::size_t> nodeCpus;
+        for (auto numaNode : _usedNumaNodes) {
+            nodeCpus.push_back(std::max(static_cast<std::size_t>(1), getNUMANodeCPUs(numaNode).size()));
+        }
+        const auto totalCpus = std::accumulate(std::begin(nodeCpus), std::end(nodeCpus), static_cast<std::size_t>(0));
+        // position of the stream center in the [0, totalCpus) range
+        const double position = (streamId + 0.5) * totalCpus / streams;
+        std::size_t nodeEnd = 0;
+        for (std::size_t i = 0; i < _usedNumaNodes.size(); ++i) {
+            nodeEnd += nodeCpus[i];
+            if (position < nodeEnd) {
+                return _usedNumaNodes[i];
+            }
+        }
+        return _usedNumaNodes.back();
+    }
+
     void Enqueue(Task task) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
@@ -216,6 +254,7 @@ struct CPUStreamsExecutor::Impl {
     std::queue<Task>                        _taskQueue;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
+    std::vector<int>                        _streamNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
 
@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "details/ie_exception.hpp"
 #include "threading/ie_executor_manager.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
 
@@ -22,6 +24,17 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+namespace {
+bool isSameExecutorConfig(const IStreamsExecutor::Config& lhs, const IStreamsExecutor::Config& rhs) {
+    return lhs._name == rhs._name &&
+           lhs._streams == rhs._streams &&
+           lhs._threadsPerStream == rhs._threadsPerStream &&
+           lhs._threadBindingType == rhs._threadBindingType &&
+           lhs._threadBindingStep == rhs._threadBindingStep &&
+           lhs._threadBindingOffset == rhs._threadBindingOffset;
+}
+}  // namespace
+
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
@@ -29,13 +42,7 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name &&
-            executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+        if (isSameExecutorConfig(it.first, config))
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -43,6 +50,30 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+SharedStreamsScheduler::Ptr ExecutorManagerImpl::getSharedCPUStreamsScheduler(const IStreamsExecutor::Config& config,
+                                                                             std::size_t maxInFlight) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    for (const auto& it : sharedCpuStreamsSchedulers) {
+        if (!isSameExecutorConfig(it.first, config))
+            continue;
+        // the limit is shared by all clients, so one of them must not change it for the others
+        const auto currentMaxInFlight = it.second->getOccupancy().maxInFlight;
+        if (maxInFlight != 0 && maxInFlight != currentMaxInFlight) {
+            THROW_IE_EXCEPTION << "The shared executor " << config._name << " admits " << currentMaxInFlight
+                               << " tasks at once, the limit of " << maxInFlight << " conflicts with it";
+        }
+        return it.second;
+    }
+    // admitting a task per stream keeps the rest in the scheduler queues, where weights and quotas apply
+    if (0 == maxInFlight) {
+        maxInFlight = static_cast<size_t>(std::max(config._streams, 1));
+    }
+    auto newScheduler = std::make_shared<SharedStreamsScheduler>(std::make_shared<CPUStreamsExecutor>(config),
+                                                                 maxInFlight);
+    sharedCpuStreamsSchedulers.emplace_back(std::make_pair(config, newScheduler));
+    return newScheduler;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -59,6 +90,7 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedCpuStreamsSchedulers.clear();
     } else {
         executors.erase(id);
         cpuStreamsExecutors.erase(
@@ -67,6 +99,12 @@ void ExecutorManagerImpl::clear(const std::string& id) {
                               return it.first._name == id;
                            }),
             cpuStreamsExecutors.end());
+        sharedCpuStreamsSchedulers.erase(
+            std::remove_if(sharedCpuStreamsSchedulers.begin(), sharedCpuStreamsSchedulers.end(),
+                           [&](const std::pair<IStreamsExecutor::Config, SharedStreamsScheduler::Ptr>& it) {
+                              return it.first._name == id;
+                           }),
+            sharedCpuStreamsSchedulers.end());
     }
 }
 
@@ -131,4 +169,9 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+SharedStreamsScheduler::Ptr ExecutorManager::getSharedCPUStreamsScheduler(const IStreamsExecutor::Config& config,
+                                                                         std::size_t maxInFlight) {
+    return _impl.getSharedCPUStreamsScheduler(config, maxInFlight);
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,211 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <utility>
+
+#include "details/ie_exception.hpp"
+#include "threading/ie_shared_streams_executor.hpp"
+
+namespace InferenceEngine {
+
+struct SharedStreamsScheduler::Client {
+    Client(unsigned int weight, std::size_t quota) :
+        _weight{std::max(weight, 1u)},
+        _quota{quota} {
+    }
+
+    bool ready() const {
+        return !_tasks.empty() && (0 == _quota || _inFlight < _quota);
+    }
+
+    unsigned int        _weight;
+    std::size_t         _quota;
+    std::queue<Task>    _tasks;
+    std::size_t         _inFlight = 0;
+    std::uint64_t       _completed = 0;
+    // weighted number of admitted tasks, the client with the least value is admitted first
+    double              _virtualTime = 0.;
+    bool                _removed = false;
+};
+
+SharedStreamsScheduler::SharedStreamsScheduler(IStreamsExecutor::Ptr executor, std::size_t maxInFlight) :
+    _executor{std::move(executor)},
+    _maxInFlight{maxInFlight} {
+    if (nullptr == _executor) {
+        THROW_IE_EXCEPTION << "SharedStreamsScheduler requires an executor";
+    }
+}
+
+SharedStreamsScheduler::~SharedStreamsScheduler() {
+    // admitted tasks refer to the scheduler, so the executor is destroyed only after they are finished
+    std::unique_lock<std::mutex> lock{_mutex};
+    _idleCondVar.wait(lock, [this] { return 0 == _inFlight; });
+}
+
+SharedStreamsExecutor::Ptr SharedStreamsScheduler::createClient(unsigned int weight, std::size_t quota) {
+    auto client = std::make_shared<Client>(weight, quota);
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _clients.push_back(client);
+    }
+    return SharedStreamsExecutor::Ptr{new SharedStreamsExecutor{shared_from_this(), client}};
+}
+
+void SharedStreamsScheduler::setMaxInFlight(std::size_t maxInFlight) {
+    Admitted admitted;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _maxInFlight = maxInFlight;
+        admit(admitted);
+    }
+    runAdmitted(admitted);
+}
+
+SharedStreamsScheduler::Occupancy SharedStreamsScheduler::getOccupancy() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    Occupancy occupancy;
+    occupancy.inFlight = _inFlight;
+    occupancy.maxInFlight = _maxInFlight;
+    occupancy.completed = _completed;
+    for (auto&& client : _clients) {
+        occupancy.queued += client->_tasks.size();
+        if (!client->_removed) {
+            occupancy.clients++;
+        }
+    }
+    return occupancy;
+}
+
+SharedStreamsScheduler::Occupancy SharedStreamsScheduler::getOccupancy(const std::shared_ptr<Client>& client) const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    Occupancy occupancy;
+    occupancy.inFlight = client->_inFlight;
+    occupancy.queued = client->_tasks.size();
+    occupancy.maxInFlight = client->_quota;
+    occupancy.completed = client->_completed;
+    occupancy.clients = 1;
+    return occupancy;
+}
+
+void SharedStreamsScheduler::submit(const std::shared_ptr<Client>& client, Task task) {
+    Admitted admitted;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        // an idle client does not accumulate credit, otherwise it would monopolize the executor on return
+        if (client->_tasks.empty() && 0 == client->_inFlight) {
+            client->_virtualTime = std::max(client->_virtualTime, _virtualTime);
+        }
+        client->_tasks.push(std::move(task));
+        admit(admitted);
+    }
+    runAdmitted(admitted);
+}
+
+void SharedStreamsScheduler::finish(const std::shared_ptr<Client>& client) {
+    Admitted admitted;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        client->_inFlight--;
+        client->_completed++;
+        _inFlight--;
+        _completed++;
+        if (0 == _inFlight) {
+            _idleCondVar.notify_all();
+        }
+        if (client->_removed && client->_tasks.empty() && 0 == client->_inFlight) {
+            _clients.erase(std::remove(_clients.begin(), _clients.end(), client), _clients.end());
+        }
+        admit(admitted);
+    }
+    runAdmitted(admitted);
+}
+
+void SharedStreamsScheduler::remove(const std::shared_ptr<Client>& client) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    client->_removed = true;
+    // the client is kept until its tasks are finished
+    if (client->_tasks.empty() && 0 == client->_inFlight) {
+        _clients.erase(std::remove(_clients.begin(), _clients.end(), client), _clients.end());
+    }
+}
+
+void SharedStreamsScheduler::admit(Admitted& admitted) {
+    while (0 == _maxInFlight || _inFlight < _maxInFlight) {
+        std::shared_ptr<Client> next;
+        for (auto&& client : _clients) {
+            if (client->ready() && (nullptr == next || client->_virtualTime < next->_virtualTime)) {
+                next = client;
+            }
+        }
+        if (nullptr == next) {
+            break;
+        }
+
+        _virtualTime = next->_virtualTime;
+        next->_virtualTime += 1. / next->_weight;
+        next->_inFlight++;
+        _inFlight++;
+        admitted.emplace_back(next, std::move(next->_tasks.front()));
+        next->_tasks.pop();
+    }
+}
+
+void SharedStreamsScheduler::runAdmitted(Admitted& admitted) {
+    if (admitted.empty()) {
+        return;
+    }
+    for (auto&& clientTask : admitted) {
+        auto client = clientTask.first;
+        auto task = std::move(clientTask.second);
+        _executor->run([this, client, task] {
+            struct Finish {
+                ~Finish() {
+                    _scheduler->finish(_client);
+                }
+                SharedStreamsScheduler* _scheduler;
+                std::shared_ptr<Client> _client;
+            } finish{this, client};
+            task();
+        });
+    }
+}
+
+SharedStreamsExecutor::SharedStreamsExecutor(SharedStreamsScheduler::Ptr scheduler,
+                                             std::shared_ptr<SharedStreamsScheduler::Client> client) :
+    _scheduler{std::move(scheduler)},
+    _client{std::move(client)} {
+}
+
+SharedStreamsExecutor::~SharedStreamsExecutor() {
+    _scheduler->remove(_client);
+}
+
+void SharedStreamsExecutor::run(Task task) {
+    _scheduler->submit(_client, std::move(task));
+}
+
+void SharedStreamsExecutor::Execute(Task task) {
+    _scheduler->_executor->Execute(std::move(task));
+}
+
+int SharedStreamsExecutor::GetStreamId() {
+    return _scheduler->_executor->GetStreamId();
+}
+
+int SharedStreamsExecutor::GetNumaNodeId() {
+    return _scheduler->_executor->GetNumaNodeId();
+}
+
+SharedStreamsScheduler::Occupancy SharedStreamsExecutor::getOccupancy() const {
+    return _scheduler->getOccupancy(_client);
+}
+
+SharedStreamsScheduler::Ptr SharedStreamsExecutor::getScheduler() const {
+    return _scheduler;
+}
+
+}  // namespace InferenceEngine
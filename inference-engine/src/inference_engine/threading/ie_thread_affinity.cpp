@@ -42,9 +42,9 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
     return 0 == sched_setaffinity(0, CPU_ALLOC_SIZE(ncores), procMask.get());
 }
 
-bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
+int GetVacantCoreId(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
     if (procMask == nullptr)
-        return false;
+        return -1;
     const size_t size = CPU_ALLOC_SIZE(ncores);
     const int num_cpus = CPU_COUNT_S(size, procMask.get());
     thrIdx %= num_cpus;  // To limit unique number in [; num_cpus-1] range
@@ -62,7 +62,15 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
         if (CPU_ISSET_S(++mapped_idx, size, procMask.get()))
             --cpu_idx;
     }
+    return mapped_idx;
+}
+
+bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
+    const int mapped_idx = GetVacantCoreId(thrIdx, hyperthreads, ncores, procMask);
+    if (mapped_idx < 0)
+        return false;
 
+    const size_t size = CPU_ALLOC_SIZE(ncores);
     CpuSet targetMask{CPU_ALLOC(ncores)};
     CPU_ZERO_S(size, targetMask.get());
     CPU_SET_S(mapped_idx, size, targetMask.get());
@@ -82,8 +90,15 @@ bool PinCurrentThreadToSocket(int socket) {
     const size_t size = CPU_ALLOC_SIZE(ncpus);
     CPU_ZERO_S(size, targetMask.get());
 
-    for (int core = socket*cores_per_socket; core < (socket+1)*cores_per_socket; core++) {
-        CPU_SET_S(core, size, targetMask.get());
+    // use actual processors of the node if the topology is available
+    auto node_cpus = InferenceEngine::getNUMANodeCPUs(socket);
+    if (node_cpus.empty()) {
+        for (int core = socket*cores_per_socket; core < (socket+1)*cores_per_socket; core++) {
+            node_cpus.push_back(core);
+        }
+    }
+    for (auto cpu : node_cpus) {
+        if (cpu < ncpus) CPU_SET_S(cpu, size, targetMask.get());
     }
     // respect the user-defined mask for the entire process
     CPU_AND_S(size, targetMask.get(), targetMask.get(), mask.get());
@@ -99,6 +114,9 @@ std::tuple<CpuSet, int> GetProcessMask() {
 }
 void ReleaseProcessMask(cpu_set_t*) {}
 
+int GetVacantCoreId(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
+    return -1;
+}
 bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
     return false;
 }
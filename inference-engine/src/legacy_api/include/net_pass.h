@@ -6,6 +6,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ie_icnn_network.hpp"
@@ -101,5 +102,18 @@ IE_SUPPRESS_DEPRECATED_END
  */
 INFERENCE_ENGINE_API_CPP(void) ConvertPrecision(ICNNNetwork& net, Precision from, Precision to);
 
+/**
+ * Precision conversion pass for several precisions at once
+ *
+ * Performs the same conversion as the pass above for every pair of precisions in a single traversal
+ * of the network. Every tensor is converted once, so conversions are not chained. Const blobs are
+ * converted in parallel.
+ *
+ * @param net is network to apply conversion
+ * @param precisions pairs of precisions of tensors required conversion and resulting precisions
+ */
+INFERENCE_ENGINE_API_CPP(void) ConvertPrecision(ICNNNetwork& net,
+                                                const std::vector<std::pair<Precision, Precision>>& precisions);
+
 }  // namespace NetPass
 }  // namespace InferenceEngine
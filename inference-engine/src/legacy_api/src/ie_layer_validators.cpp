@@ -2233,6 +2233,31 @@ void CTCGreedyDecoderValidator::checkShapes(const CNNLayer* layer, const std::ve
 
 CTCGreedyDecoderValidator::CTCGreedyDecoderValidator(const std::string& _type): LayerValidator(_type) {}
 
+void CTCBeamSearchDecoderValidator::parseParams(CNNLayer* layer) {
+    // layers created by shape inference have no outputs, the number is taken from the network layer
+    if (layer->params.find("num_outputs") == layer->params.end() && !layer->outData.empty()) {
+        layer->params["num_outputs"] = std::to_string(layer->outData.size());
+    }
+}
+
+void CTCBeamSearchDecoderValidator::checkParams(const CNNLayer* layer) {
+    unsigned int beam_width = layer->GetParamAsUInt("beam_width", 10);
+    unsigned int top_paths = layer->GetParamAsUInt("top_paths", 1);
+    if (beam_width == 0 || top_paths == 0 || top_paths > beam_width) {
+        THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer parameters beam_width or top_paths are invalid";
+    }
+    unsigned int num_outputs = layer->GetParamAsUInt("num_outputs", 1);
+    if (num_outputs == 0 || num_outputs > 2) {
+        THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer parameter num_outputs is invalid";
+    }
+}
+
+void CTCBeamSearchDecoderValidator::checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const {
+    checkNumOfInput(inShapes, {1, 2});
+}
+
+CTCBeamSearchDecoderValidator::CTCBeamSearchDecoderValidator(const std::string& _type): LayerValidator(_type) {}
+
 void DetectionOutputValidator::parseParams(CNNLayer* layer) {
     unsigned int num_classes = layer->GetParamAsUInt("num_classes");
     if (num_classes == 0) {
@@ -3182,6 +3207,7 @@ LayerValidators::LayerValidators() {
     REG_LAYER_VALIDATOR_FOR_TYPE(ArgMaxValidator, ArgMax);
     REG_LAYER_VALIDATOR_FOR_TYPE(BatchNormalizationValidator, BatchNormalization);
     REG_LAYER_VALIDATOR_FOR_TYPE(CTCGreedyDecoderValidator, CTCGreedyDecoder);
+    REG_LAYER_VALIDATOR_FOR_TYPE(CTCBeamSearchDecoderValidator, CTCBeamSearchDecoder);
     REG_LAYER_VALIDATOR_FOR_TYPE(ClampValidator, Clamp);
     REG_LAYER_VALIDATOR_FOR_TYPE(ConcatValidator, Concat);
     REG_LAYER_VALIDATOR_FOR_TYPE(ConstValidator, Const);
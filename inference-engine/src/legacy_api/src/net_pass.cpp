@@ -18,6 +18,7 @@
 #include "blob_factory.hpp"
 #include "details/ie_cnn_network_tools.h"
 #include "graph_tools.hpp"
+#include "ie_parallel.hpp"
 #include "ie_layers_internal.hpp"
 #include "ie_memcpy.h"
 #include "precision_utils.h"
@@ -1298,14 +1299,20 @@ bool UnrollRNN_if(TensorIterator::Body& net, const std::function<bool(const RNNC
 
 namespace {
 
+// Blobs are converted by blocks of this size in parallel
+constexpr size_t kConvertBlockSize = 16 * 1024;
+
 template <Precision::ePrecision PREC_FROM, Precision::ePrecision PREC_TO>
 void convertArrayPrecision(typename PrecisionTrait<PREC_TO>::value_type* dst,
                            const typename PrecisionTrait<PREC_FROM>::value_type* src, size_t nelem) {
     using dst_type = typename PrecisionTrait<PREC_TO>::value_type;
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = static_cast<dst_type>(src[i]);
-    }
+    parallel_for((nelem + kConvertBlockSize - 1) / kConvertBlockSize, [&](size_t block) {
+        const size_t end = (std::min)(nelem, (block + 1) * kConvertBlockSize);
+        for (size_t i = block * kConvertBlockSize; i < end; i++) {
+            dst[i] = static_cast<dst_type>(src[i]);
+        }
+    });
 }
 
 template <>
@@ -1327,47 +1334,85 @@ Blob::Ptr convertBlobPrecision(const Blob::Ptr& blob) {
     return new_blob;
 }
 
-// forward declaration to use in convertLayerPrecision<>()
-template <Precision::ePrecision PREC_FROM, Precision::ePrecision PREC_TO, typename NET>
-void convertPrecisionForAll(NET &net);
+struct PrecisionConversion {
+    Precision to;
+    Blob::Ptr (*convertBlob)(const Blob::Ptr&);
+};
+
+using PrecisionConversions = std::map<Precision::ePrecision, PrecisionConversion>;
+
+PrecisionConversion getPrecisionConversion(Precision from, Precision to) {
+    switch (getPrecisionMask(from, to)) {
+        case getPrecisionMask(Precision::U64, Precision::I32):
+            return {to, convertBlobPrecision<Precision::U64, Precision::I32>};
+        case getPrecisionMask(Precision::I64, Precision::I32):
+            return {to, convertBlobPrecision<Precision::I64, Precision::I32>};
+        case getPrecisionMask(Precision::BOOL, Precision::U8):
+            return {to, convertBlobPrecision<Precision::BOOL, Precision::U8>};
+        case getPrecisionMask(Precision::BOOL, Precision::I32):
+            return {to, convertBlobPrecision<Precision::BOOL, Precision::I32>};
+        case getPrecisionMask(Precision::FP16, Precision::FP32):
+            return {to, convertBlobPrecision<Precision::FP16, Precision::FP32>};
+        case getPrecisionMask(Precision::U8, Precision::I32):
+            return {to, convertBlobPrecision<Precision::U8, Precision::I32>};
+        default:
+            THROW_IE_EXCEPTION << "Precision conversion from " << from << " to " << to
+                               << " currently is not supported. You may expand precision"
+                                  " conversion pass.";
+    }
+}
+
+// Blobs are collected during the traversal of the network and converted in parallel afterwards
+struct BlobConversion {
+    Blob::Ptr* blob;
+    Blob::Ptr (*convert)(const Blob::Ptr&);
+};
+
+// forward declaration to use in convertLayerPrecision()
+template <typename NET>
+void convertPrecisionForAll(NET &net, const PrecisionConversions& conversions);
+
+void convertLayerPrecision(const CNNLayerPtr& layer, const PrecisionConversions& conversions,
+                           std::unordered_set<Data*>& convertedData, std::vector<BlobConversion>& blobs) {
+    // every tensor is converted once, so conversions are not chained
+    auto convertData = [&](const DataPtr& data) {
+        auto conversion = conversions.find(data->getPrecision());
+        if (conversion != conversions.end() && convertedData.insert(data.get()).second)
+            data->setPrecision(conversion->second.to);
+    };
+    auto convertBlob = [&](Blob::Ptr& blob) {
+        if (blob) {
+            auto conversion = conversions.find(blob->getTensorDesc().getPrecision());
+            if (conversion != conversions.end())
+                blobs.push_back({&blob, conversion->second.convertBlob});
+        }
+    };
 
-template <Precision::ePrecision PREC_FROM, Precision::ePrecision PREC_TO>
-void convertLayerPrecision(const CNNLayerPtr& layer) {
     for (auto &out_data : layer->outData) {
-        if (PREC_FROM == out_data->getPrecision())
-            out_data->setPrecision(PREC_TO);
+        convertData(out_data);
     }
     for (auto &in_data : layer->insData) {
-        if (PREC_FROM == in_data.lock()->getPrecision())
-            in_data.lock()->setPrecision(PREC_TO);
+        convertData(in_data.lock());
     }
 
-    if (layer->precision == PREC_FROM)
-        layer->precision = PREC_TO;
+    auto layer_conversion = conversions.find(layer->precision);
+    if (layer_conversion != conversions.end())
+        layer->precision = layer_conversion->second.to;
 
     if (HasInternalSubnet(layer)) {
         // apply the same conversion pass for internal graph
         auto layer_subnet = GetInternalSubnet(layer);
-        convertPrecisionForAll<PREC_FROM, PREC_TO>(layer_subnet);
+        convertPrecisionForAll(layer_subnet, conversions);
     }
 
     auto wLayer = dynamic_cast<InferenceEngine::WeightableLayer *>(layer.get());
     if (wLayer) {
-        if (wLayer->_weights && wLayer->_weights->getTensorDesc().getPrecision() == PREC_FROM) {
-            wLayer->_weights = convertBlobPrecision<PREC_FROM, PREC_TO>(wLayer->_weights);
-        }
-        if (wLayer->_biases && wLayer->_biases->getTensorDesc().getPrecision() == PREC_FROM) {
-            wLayer->_biases = convertBlobPrecision<PREC_FROM, PREC_TO>(wLayer->_biases);
-        }
+        convertBlob(wLayer->_weights);
+        convertBlob(wLayer->_biases);
     }
 
     for (auto &blob : layer->blobs) {
-        auto &data = blob.second;
-        if (nullptr != data) {
-            if (data->getTensorDesc().getPrecision() == PREC_FROM) {
-                data = convertBlobPrecision<PREC_FROM, PREC_TO>(data);
-            }
-        }
+        convertBlob(blob.second);
     }
 }
 
@@ -1397,11 +1442,29 @@ void fixConvertLayers(NET &net) {
     }
 }
 
-template <Precision::ePrecision PREC_FROM, Precision::ePrecision PREC_TO, typename NET>
-void convertPrecisionForAll(NET &net) {
+template <typename NET>
+void convertPrecisionForAll(NET &net, const PrecisionConversions& conversions) {
+    std::unordered_set<Data*> convertedData;
+    std::vector<BlobConversion> blobs;
     auto all_layers = TopolSort(net);
     for (auto &layer : all_layers) {
-        convertLayerPrecision<PREC_FROM, PREC_TO>(layer);
+        convertLayerPrecision(layer, conversions, convertedData, blobs);
+    }
+
+    // weights and biases of a layer are usually kept in its blobs as well, so each blob is converted once
+    std::unordered_map<Blob*, size_t> uniqueBlobs;
+    std::vector<size_t> sources;
+    for (size_t i = 0; i < blobs.size(); i++) {
+        if (uniqueBlobs.emplace(blobs[i].blob->get(), sources.size()).second)
+            sources.push_back(i);
+    }
+    std::vector<Blob::Ptr> converted(sources.size());
+    parallel_for(sources.size(), [&](size_t i) {
+        auto &conversion = blobs[sources[i]];
+        converted[i] = conversion.convert(*conversion.blob);
+    });
+    for (auto &conversion : blobs) {
+        *conversion.blob = converted[uniqueBlobs[conversion.blob->get()]];
     }
     fixConvertLayers(net);
 }
@@ -1422,31 +1485,17 @@ details::CNNSubnet GetInternalSubnet(const CNNLayerPtr &layer) {
 }
 
 void ConvertPrecision(ICNNNetwork& net, Precision from, Precision to) {
-    auto compare = getPrecisionMask(from, to);
-    switch (compare) {
-        case getPrecisionMask(Precision::U64, Precision::I32):
-            convertPrecisionForAll<Precision::U64, Precision::I32>(net);
-            break;
-        case getPrecisionMask(Precision::I64, Precision::I32):
-            convertPrecisionForAll<Precision::I64, Precision::I32>(net);
-            break;
-        case getPrecisionMask(Precision::BOOL, Precision::U8):
-            convertPrecisionForAll<Precision::BOOL, Precision::U8>(net);
-            break;
-        case getPrecisionMask(Precision::BOOL, Precision::I32):
-            convertPrecisionForAll<Precision::BOOL, Precision::I32>(net);
-            break;
-        case getPrecisionMask(Precision::FP16, Precision::FP32):
-            convertPrecisionForAll<Precision::FP16, Precision::FP32>(net);
-            break;
-        case getPrecisionMask(Precision::U8, Precision::I32):
-            convertPrecisionForAll<Precision::U8, Precision::I32>(net);
-            break;
-        default:
-            THROW_IE_EXCEPTION << "Precision conversion from " << from << " to " << to
-                               << " currently is not supported. You may expand precision"
-                                  " conversion pass.";
+    ConvertPrecision(net, {{from, to}});
+}
+
+void ConvertPrecision(ICNNNetwork& net, const std::vector<std::pair<Precision, Precision>>& precisions) {
+    PrecisionConversions conversions;
+    for (auto &precision : precisions) {
+        if (!conversions.emplace(precision.first, getPrecisionConversion(precision.first, precision.second)).second) {
+            THROW_IE_EXCEPTION << "Precision " << precision.first << " is converted more than once";
+        }
     }
+    convertPrecisionForAll(net, conversions);
 }
 
 }  // namespace NetPass
@@ -14,6 +14,7 @@
 #include "ie_concat_shape_infer.hpp"
 #include "ie_conv_shape_infer.hpp"
 #include "ie_crop_shape_infer.hpp"
+#include "ie_ctc_beam_search_decoder_shape_infer.hpp"
 #include "ie_ctc_greedy_decoder_shape_infer.hpp"
 #include "ie_deconv_shape_infer.hpp"
 #include "ie_deformable_conv_shape_infer.hpp"
@@ -172,6 +173,7 @@ REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Mul);
 REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Add);
 REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Div);
 REG_SHAPE_INFER_FOR_TYPE(CTCGreedyDecoderShapeProp, CTCGreedyDecoder);
+REG_SHAPE_INFER_FOR_TYPE(CTCBeamSearchDecoderShapeProp, CTCBeamSearchDecoder);
 REG_SHAPE_INFER_FOR_TYPE(ProposalShapeProp, Proposal);
 REG_SHAPE_INFER_FOR_TYPE(ReorgYoloShapeProp, ReorgYolo);
 REG_SHAPE_INFER_FOR_TYPE(RegionYoloShapeProp, RegionYolo);
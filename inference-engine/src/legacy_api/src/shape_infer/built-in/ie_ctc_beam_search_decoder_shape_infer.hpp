@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ie_built_in_impl.hpp"
+
+namespace InferenceEngine {
+namespace ShapeInfer {
+
+/**
+ *@brief Implementation of Shape inference for CTCBeamSearchDecoder layer
+ */
+class CTCBeamSearchDecoderShapeProp : public BuiltInShapeInferImpl {
+public:
+    explicit CTCBeamSearchDecoderShapeProp(const std::string& type): BuiltInShapeInferImpl(type) {}
+
+    void inferShapesImpl(const std::vector<Blob::CPtr>& inBlobs, const std::map<std::string, std::string>& params,
+                         const std::map<std::string, Blob::Ptr>& blobs, std::vector<SizeVector>& outShapes) override {
+        outShapes.clear();
+        LayerParams lp {};
+        CNNLayer cnnLayer(lp);
+        cnnLayer.params = params;
+        cnnLayer.type = _type;
+        validate(&cnnLayer, inBlobs, params, blobs);
+
+        size_t topPaths = cnnLayer.GetParamAsUInt("top_paths", 1);
+        auto num_outputs = cnnLayer.GetParamAsUInt("num_outputs", 1);
+        outShapes.push_back({inShapes[0][1], topPaths, inShapes[0][0]});
+        if (num_outputs == 2)
+            outShapes.push_back({inShapes[0][1], topPaths});
+    }
+};
+
+}  // namespace ShapeInfer
+}  // namespace InferenceEngine
@@ -39,6 +39,18 @@ class ConvertConstInfer : public ConstInferImpl {
         });
     }
 
+    void exec_fp16_to_fp32_cast(const Blob::CPtr &inData, Blob::Ptr &outData) {
+        const ie_fp16 *src_data =
+                inData->cbuffer().as<ie_fp16 *>() + inData->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        float *dst_data =
+                outData->buffer().as<float *>() + outData->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        if (inData->size() != outData->size())
+            THROW_IE_EXCEPTION << " Convert constant inference error: Input and output buffers have different sizes! "
+                                  "Input buffer size = `"
+                               << inData->size() << "` output buffer size = `" << outData->size() << "`";
+        PrecisionUtils::f16tof32Arrays(dst_data, src_data, inData->size());
+    }
+
     template<typename dst_d>
     void exec_from_fp16_cast(const Blob::CPtr &inData, Blob::Ptr &outData) {
         const ie_fp16 *src_data =
@@ -54,19 +66,16 @@ class ConvertConstInfer : public ConstInferImpl {
         });
     }
 
-    template<typename src_d>
-    void exec_to_fp16_cast(const Blob::CPtr &inData, Blob::Ptr &outData) {
-        const src_d* src_data =
-                inData->cbuffer().as<src_d*>() + inData->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    void exec_fp32_to_fp16_cast(const Blob::CPtr &inData, Blob::Ptr &outData) {
+        const float* src_data =
+                inData->cbuffer().as<float*>() + inData->getTensorDesc().getBlockingDesc().getOffsetPadding();
         ie_fp16* dst_data =
                 outData->buffer().as<ie_fp16*>() + outData->getTensorDesc().getBlockingDesc().getOffsetPadding();
         if (inData->size() != outData->size())
             THROW_IE_EXCEPTION << " Convert constant inference error: Input and output buffers have different sizes! "
                                   "Input buffer size = `"
                                << inData->size() << "` output buffer size = `" << outData->size() << "`";
-        parallel_for(inData->size(), [&](size_t i) {
-            dst_data[i] = PrecisionUtils::f32tof16(static_cast<float>(src_data[i]));
-        });
+        PrecisionUtils::f32tof16Arrays(dst_data, src_data, inData->size());
     }
 
 public:
@@ -147,7 +156,7 @@ public:
                     inData[0], outData[0]);
             break;
         case getPrecisionMask(Precision::FP16, Precision::FP32):
-            exec_from_fp16_cast<PrecisionTrait<Precision::FP32>::value_type>(inData[0], outData[0]);
+            exec_fp16_to_fp32_cast(inData[0], outData[0]);
             break;
         case getPrecisionMask(Precision::FP16, Precision::I32):
             exec_from_fp16_cast<PrecisionTrait<Precision::I32>::value_type>(inData[0], outData[0]);
@@ -165,7 +174,7 @@ public:
             exec_from_fp16_cast<PrecisionTrait<Precision::BOOL>::value_type>(inData[0], outData[0]);
             break;
         case getPrecisionMask(Precision::FP32, Precision::FP16):
-            exec_to_fp16_cast<PrecisionTrait<Precision::FP32>::value_type>(inData[0], outData[0]);
+            exec_fp32_to_fp16_cast(inData[0], outData[0]);
             break;
         default:
             THROW_IE_EXCEPTION << " Convert constant inference error: Unsupported precision configuration! "
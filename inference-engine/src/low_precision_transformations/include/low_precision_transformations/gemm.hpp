@@ -0,0 +1,39 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include "low_precision_transformations/fully_connected.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+IE_SUPPRESS_DEPRECATED_START
+
+/**
+ * GEMM with constant weights is transformed as FullyConnected.
+ * GEMM of two activations, e.g. attention of transformer models, is executed on quantized inputs: U8 or I8 on
+ * the first input and I8 on the second one. Dequantization ScaleShifts of both inputs are moved after the layer,
+ * a zero point of the first input is kept by Eltwise Sub with Const which the plugin fuses into the layer.
+ * The second input is requantized to 7 bits, [-63, 63]: int8 GEMM without VNNI sums pairs of U8 x I8 products
+ * in saturated s16 which overflows for full range I8 values.
+ */
+class INFERENCE_ENGINE_API_CLASS(GemmTransformation) : public FullyConnectedTransformation {
+public:
+    GemmTransformation(const Params& params) : FullyConnectedTransformation(params) {}
+    ~GemmTransformation() override {};
+    void transform(TransformationContext& context, CNNLayer& layer) const override;
+    bool isQuantized(const CNNLayer& layer) const noexcept override;
+
+    static bool isActivationsProduct(const CNNLayer& layer) noexcept;
+
+private:
+    static CNNLayerPtr getFakeQuantize(const CNNLayer& dequantization);
+};
+
+IE_SUPPRESS_DEPRECATED_END
+
+}  // namespace details
+}  // namespace InferenceEngine
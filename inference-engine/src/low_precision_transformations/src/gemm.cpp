@@ -0,0 +1,254 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformations/gemm.hpp"
+
+#include <algorithm>
+#include <details/caseless.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_common.h>
+#include "low_precision_transformations/network_helper.hpp"
+#include "low_precision_transformations/quantization_details.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+// the second input of an int8 product is limited to 7 bits, so the s8 input of the kernel does not overflow
+static const float maxOutputB = 63.f;
+
+bool GemmTransformation::isActivationsProduct(const CNNLayer& layer) noexcept {
+    if (layer.insData.size() != 2ul) {
+        return false;
+    }
+
+    for (const auto& insData : layer.insData) {
+        const DataPtr data = insData.lock();
+        if (data == nullptr) {
+            return false;
+        }
+
+        const CNNLayerPtr parent = data->getCreatorLayer().lock();
+        if ((parent == nullptr) || CaselessEq<std::string>()(parent->type, "Const")) {
+            return false;
+        }
+
+        if (CaselessEq<std::string>()(parent->type, "FakeQuantize") && std::all_of(
+            parent->insData.begin(),
+            parent->insData.end(),
+            [](const DataWeakPtr& parentInsData) {
+                const DataPtr data = parentInsData.lock();
+                const CNNLayerPtr constLayer = data == nullptr ? nullptr : data->getCreatorLayer().lock();
+                return (constLayer != nullptr) && CaselessEq<std::string>()(constLayer->type, "Const");
+            })) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+CNNLayerPtr GemmTransformation::getFakeQuantize(const CNNLayer& dequantization) {
+    // dequantization is moved through layers which do not change values
+    static const std::vector<std::string> skippedTypes = { "Reshape", "Permute", "Squeeze", "Unsqueeze" };
+    CNNLayerPtr parent = CNNNetworkHelper::getParent(dequantization, 0);
+    while ((parent != nullptr) && (parent->outData.size() == 1ul) && (parent->outData[0]->getInputTo().size() == 1ul)) {
+        if (CaselessEq<std::string>()(parent->type, "FakeQuantize")) {
+            return parent;
+        }
+
+        if (std::none_of(
+            skippedTypes.begin(),
+            skippedTypes.end(),
+            [&](const std::string& type) { return CaselessEq<std::string>()(parent->type, type); })) {
+            return nullptr;
+        }
+        parent = CNNNetworkHelper::getParent(*parent, 0);
+    }
+    return nullptr;
+}
+
+bool GemmTransformation::isQuantized(const CNNLayer& layer) const noexcept {
+    return isActivationsProduct(layer) || FullyConnectedTransformation::isQuantized(layer);
+}
+
+void GemmTransformation::transform(TransformationContext& context, CNNLayer& gemm) const {
+    if (!CaselessEq<std::string>()(gemm.type, "GEMM")) {
+        THROW_IE_EXCEPTION << "layer '" << gemm.name << "' is not correct";
+    }
+
+    if (!isActivationsProduct(gemm)) {
+        FullyConnectedTransformation::transform(context, gemm);
+        return;
+    }
+
+    if (!LayerTransformation::canBeTransformed(context, gemm)) {
+        return;
+    }
+
+    if (gemm.outData.size() != 1) {
+        THROW_IE_EXCEPTION << "layer outputs '" << gemm.outData.size() << "' is not correct";
+    }
+
+    const CNNLayerPtr scaleShiftA = CNNNetworkHelper::getParent(gemm, 0);
+    const CNNLayerPtr scaleShiftB = CNNNetworkHelper::getParent(gemm, 1);
+    if (scaleShiftA == scaleShiftB) {
+        return;
+    }
+    for (const CNNLayerPtr& scaleShift : { scaleShiftA, scaleShiftB }) {
+        if ((scaleShift == nullptr) || (scaleShift->type != "ScaleShift") || (scaleShift->outData.size() != 1ul) ||
+            (scaleShift->outData[0]->getInputTo().size() != 1ul)) {
+            return;
+        }
+    }
+
+    // integer GEMM multiplies U8 or I8 by I8
+    const Precision precisionA = CNNNetworkHelper::getPrecisionParent(*scaleShiftA);
+    const Precision precisionB = CNNNetworkHelper::getPrecisionParent(*scaleShiftB);
+    if (((precisionA != Precision::U8) && (precisionA != Precision::I8)) || (precisionB != Precision::I8)) {
+        return;
+    }
+
+    std::vector<float> scalesA;
+    std::vector<float> shiftsA;
+    fillFromDequantizationLayer(*scaleShiftA, scalesA, shiftsA);
+    std::vector<float> scalesB;
+    std::vector<float> shiftsB;
+    fillFromDequantizationLayer(*scaleShiftB, scalesB, shiftsB);
+
+    if (std::any_of(shiftsB.begin(), shiftsB.end(), [](const float value) { return value != 0.f; })) {
+        return;
+    }
+
+    // channels of 4D tensors are a batch dimension of the product, so dequantization by channels is moved after
+    // the layer, otherwise channels are rows or columns of matrices and the values must be the same
+    const size_t dimsSize = gemm.outData[0]->getDims().size();
+    const auto isPerTensor = [](const std::vector<float>& values) {
+        return std::all_of(values.begin(), values.end(), [&](const float value) { return value == values[0]; });
+    };
+    if ((dimsSize != 4ul) && (!isPerTensor(scalesA) || !isPerTensor(shiftsA) || !isPerTensor(scalesB))) {
+        return;
+    }
+
+    // the second input is requantized to 7 bits: the value which is quantized to zero is kept
+    // and the input interval becomes symmetric around it
+    const CNNLayerPtr fakeQuantizeB = getFakeQuantize(*scaleShiftB);
+    if (fakeQuantizeB == nullptr) {
+        return;
+    }
+    const QuantizationDetails detailsB = QuantizationDetails::getDetails(*fakeQuantizeB);
+    const bool requantizeB = (detailsB.minOutputLow() < -maxOutputB) || (detailsB.maxOutputHigh() > maxOutputB);
+    const size_t intervalsCountB = std::max(detailsB.inputLowValues.size(), detailsB.outputLowValues.size());
+    std::vector<float> inputLowValuesB(intervalsCountB);
+    std::vector<float> inputHighValuesB(intervalsCountB);
+    std::vector<float> scalesRatiosB(intervalsCountB);
+    for (size_t i = 0; requantizeB && (i < intervalsCountB); ++i) {
+        const float inputLow = detailsB.getInputLowValue(i);
+        const float inputHigh = detailsB.getInputHighValue(i);
+        const float outputLow = detailsB.getOutputLowValue(i);
+        const float outputHigh = detailsB.getOutputHighValue(i);
+        if ((inputLow == inputHigh) || (outputLow == outputHigh)) {
+            return;
+        }
+
+        const float step = (inputHigh - inputLow) / (outputHigh - outputLow);
+        const float zero = inputLow - outputLow * step;
+        const float halfInterval = std::max(zero - inputLow, inputHigh - zero);
+        inputLowValuesB[i] = zero - halfInterval;
+        inputHighValuesB[i] = zero + halfInterval;
+        scalesRatiosB[i] = halfInterval / (maxOutputB * step);
+    }
+
+    if (requantizeB) {
+        if (isPerTensor(scalesRatiosB)) {
+            for (float& scale : scalesB) {
+                scale *= scalesRatiosB[0];
+            }
+        } else if ((CNNNetworkHelper::getParent(*scaleShiftB, 0) == fakeQuantizeB) &&
+                   (scalesB.size() == intervalsCountB)) {
+            for (size_t i = 0; i < scalesB.size(); ++i) {
+                scalesB[i] *= scalesRatiosB[i];
+            }
+        } else {
+            return;
+        }
+    }
+
+    std::vector<float> dataShifts(shiftsA.size());
+    for (size_t i = 0; i < dataShifts.size(); ++i) {
+        dataShifts[i] = -shiftsA[i] / scalesA[i];
+    }
+
+    const std::shared_ptr<float> dataZeroPoints = CNNNetworkHelper::convertFloatData(
+        dataShifts.data(),
+        dataShifts.size(),
+        precisionA);
+    if (std::any_of(dataZeroPoints.get(), dataZeroPoints.get() + dataShifts.size(), [](const float value) { return value != 0.f; })) {
+        // zero points are supported for U8 only, Eltwise Sub is created for NC and NCHW layouts
+        if (!supportAsymmetricQuantization || (precisionA != Precision::U8) || (dimsSize == 3ul)) {
+            return;
+        }
+
+        createAsymmetric(
+            context,
+            *scaleShiftA,
+            gemm,
+            PrecisionsInfo(scaleShiftA->outData[0]->getPrecision(), precisionA),
+            dataShifts,
+            false);
+    }
+
+    if (requantizeB) {
+        CNNNetworkHelper::updateBlobs(*fakeQuantizeB, 1, inputLowValuesB);
+        CNNNetworkHelper::updateBlobs(*fakeQuantizeB, 2, inputHighValuesB);
+        CNNNetworkHelper::updateBlobs(*fakeQuantizeB, 3, -maxOutputB);
+        CNNNetworkHelper::updateBlobs(*fakeQuantizeB, 4, maxOutputB);
+
+        fakeQuantizeB->params["levels"] = "127";
+        QuantizeLayer* layer = dynamic_cast<QuantizeLayer*>(fakeQuantizeB.get());
+        if (layer == nullptr) {
+            THROW_IE_EXCEPTION << "incorrect type for layer " << fakeQuantizeB->name;
+        }
+        layer->levels = 127;
+    }
+
+    const size_t outputChannelsCount = CNNNetworkHelper::getOutputChannelsCount(gemm);
+    std::vector<float> dequantizationScales(outputChannelsCount);
+    for (size_t channel = 0; channel < outputChannelsCount; ++channel) {
+        const float scaleA = scalesA.size() == outputChannelsCount ? scalesA[channel] : scalesA[0];
+        const float scaleB = scalesB.size() == outputChannelsCount ? scalesB[channel] : scalesB[0];
+        dequantizationScales[channel] = scaleA * scaleB;
+    }
+    const std::vector<float> dequantizationShifts(outputChannelsCount, 0.f);
+
+    for (const CNNLayerPtr& scaleShift : { scaleShiftA, scaleShiftB }) {
+        CNNNetworkHelper::removeLayer(context.network, scaleShift);
+        context.removeLayer(*scaleShift);
+    }
+
+    const std::vector<CNNLayerPtr> children = CNNNetworkHelper::getChildren(gemm);
+    if (children.size() == 0) {
+        const std::string originalName = gemm.name;
+        CNNNetworkHelper::renameLayer(context.network, gemm.name, gemm.name + LayerTransformation::lastLayerPrefix);
+
+        CNNLayerPtr dequantizationLayer = CNNNetworkHelper::addScaleShiftBetween(
+            context,
+            std::make_shared<CNNLayer>(gemm),
+            nullptr,
+            DequantizationDetails(dequantizationScales, dequantizationShifts, outputChannelsCount),
+            originalName);
+        context.dequantizationLayersNames.insert(dequantizationLayer->name);
+    } else {
+        for (const CNNLayerPtr& child : children) {
+            CNNLayerPtr dequantizationLayer = CNNNetworkHelper::addScaleShiftBetween(
+                context,
+                std::make_shared<CNNLayer>(gemm),
+                child,
+                DequantizationDetails(dequantizationScales, dequantizationShifts, outputChannelsCount));
+            context.dequantizationLayersNames.insert(dequantizationLayer->name);
+        }
+    }
+}
@@ -30,6 +30,7 @@
 #include "low_precision_transformations/fake_quantize.hpp"
 #include "low_precision_transformations/fully_connected.hpp"
 #include "low_precision_transformations/fuse_fake_quantize_and_scale_shift.hpp"
+#include "low_precision_transformations/gemm.hpp"
 #include "low_precision_transformations/mvn.hpp"
 #include "low_precision_transformations/permute.hpp"
 #include "low_precision_transformations/pooling.hpp"
@@ -181,7 +182,7 @@ LowPrecisionTransformations LowPrecisionTransformer::getAllTransformations(const
             { "FakeQuantize", LayerTransformationPtr(new FakeQuantizeTransformation(params)) },
             { "Reshape", LayerTransformationPtr(new ReshapeTransformation(params)) },
             { "FullyConnected", LayerTransformationPtr(new FullyConnectedTransformation(params)) },
-            { "GEMM", LayerTransformationPtr(new FullyConnectedTransformation(params)) },
+            { "GEMM", LayerTransformationPtr(new GemmTransformation(params)) },
             { "Permute", LayerTransformationPtr(new PermuteTransformation(params)) },
             { "Squeeze", LayerTransformationPtr(new SqueezeTransformation(params)) },
             { "ReLU", LayerTransformationPtr(new ActivationTransformation(params)) },
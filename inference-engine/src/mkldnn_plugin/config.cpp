@@ -78,6 +78,78 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_LATENCY_HISTOGRAMS) {
+            if (val == PluginConfigParams::YES) collectLatencyHistograms = true;
+            else if (val == PluginConfigParams::NO) collectLatencyHistograms = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_LATENCY_HISTOGRAMS
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_NUMA_POLICY) {
+            if (val == PluginConfigParams::CPU_WEIGHTS_AUTO) numaWeightsPolicy = NumaWeightsPolicy::Auto;
+            else if (val == PluginConfigParams::CPU_WEIGHTS_REPLICATE) numaWeightsPolicy = NumaWeightsPolicy::Replicate;
+            else if (val == PluginConfigParams::CPU_WEIGHTS_INTERLEAVE) numaWeightsPolicy = NumaWeightsPolicy::Interleave;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_NUMA_POLICY
+                    << ". Expected only CPU_WEIGHTS_AUTO/CPU_WEIGHTS_REPLICATE/CPU_WEIGHTS_INTERLEAVE";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_EXECUTOR) {
+            if (val == PluginConfigParams::YES) sharedExecutor = true;
+            else if (val == PluginConfigParams::NO) sharedExecutor = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_EXECUTOR
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_WEIGHT ||
+                   key == PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_QUOTA ||
+                   key == PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_MAX_IN_FLIGHT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only integer numbers";
+            }
+            const bool isWeight = key == PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_WEIGHT;
+            if (val_i < (isWeight ? 1 : 0))
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only "
+                    << (isWeight ? "positive" : "non-negative") << " numbers";
+            if (isWeight) sharedExecutorWeight = val_i;
+            else if (key == PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_QUOTA) sharedExecutorQuota = val_i;
+            else
+                sharedExecutorMaxInFlight = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_AUTOTUNE) {
+            if (val == PluginConfigParams::YES) streamsAutotune = true;
+            else if (val == PluginConfigParams::NO) streamsAutotune = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_AUTOTUNE
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_AUTOTUNE_MAX_LATENCY) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only non-negative numbers";
+            streamsAutotuneMaxLatency = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY) {
+            float val_f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only floating point numbers";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only numbers in range [0, 1]";
+            sparseWeightsDensity = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_JIT_KERNEL_CACHE_CAPACITY) {
+            long long val_ll;
+            try {
+                val_ll = std::stoll(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only integer numbers";
+            }
+            if (val_ll < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only non-negative numbers";
+            jitKernelCacheCapacity = static_cast<size_t>(val_ll);
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -122,6 +194,35 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (collectLatencyHistograms)
+            _config.insert({ PluginConfigParams::KEY_LATENCY_HISTOGRAMS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_LATENCY_HISTOGRAMS, PluginConfigParams::NO });
+        switch (numaWeightsPolicy) {
+            case NumaWeightsPolicy::Auto:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_NUMA_POLICY, PluginConfigParams::CPU_WEIGHTS_AUTO });
+            break;
+            case NumaWeightsPolicy::Replicate:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_NUMA_POLICY, PluginConfigParams::CPU_WEIGHTS_REPLICATE });
+            break;
+            case NumaWeightsPolicy::Interleave:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_NUMA_POLICY, PluginConfigParams::CPU_WEIGHTS_INTERLEAVE });
+            break;
+        }
+        if (sharedExecutor)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_EXECUTOR, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_EXECUTOR, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_WEIGHT, std::to_string(sharedExecutorWeight) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_QUOTA, std::to_string(sharedExecutorQuota) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_EXECUTOR_MAX_IN_FLIGHT, std::to_string(sharedExecutorMaxInFlight) });
+        if (streamsAutotune)
+            _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_AUTOTUNE, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_AUTOTUNE, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_AUTOTUNE_MAX_LATENCY, std::to_string(streamsAutotuneMaxLatency) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY, std::to_string(sparseWeightsDensity) });
+        _config.insert({ PluginConfigParams::KEY_CPU_JIT_KERNEL_CACHE_CAPACITY, std::to_string(jitKernelCacheCapacity) });
     }
 }
 
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <threading/ie_istreams_executor.hpp>
+#include "mkldnn_jit_kernel_cache.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -25,6 +26,12 @@ struct Config {
         On,
     };
 
+    enum NumaWeightsPolicy {
+        Auto,
+        Replicate,
+        Interleave,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -33,6 +40,16 @@ struct Config {
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
     bool enforceBF16 = false;
+    bool collectLatencyHistograms = false;
+    NumaWeightsPolicy numaWeightsPolicy = NumaWeightsPolicy::Auto;
+    bool sharedExecutor = false;
+    int sharedExecutorWeight = 1;
+    int sharedExecutorQuota = 0;
+    int sharedExecutorMaxInFlight = 0;
+    bool streamsAutotune = false;
+    int streamsAutotuneMaxLatency = 0;
+    float sparseWeightsDensity = 0.f;
+    size_t jitKernelCacheCapacity = MKLDNNJitKernelCache::kDefaultCapacity;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -31,6 +31,8 @@ enum impl_desc_type {
     reorder = 1<<19,
     // winograd
     winograd = 1<<20,
+    // packed sparse weights
+    sparse = 1<<21,
     // real types
     ref_any             = ref  | any,
 
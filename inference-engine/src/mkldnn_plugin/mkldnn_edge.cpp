@@ -548,6 +548,13 @@ MKLDNNMemoryPtr &MKLDNNEdge::getMemoryPtr() {
 InferenceEngine::Blob::Ptr MKLDNNEdge::getBlob() {
     if (!memoryPtr)
         THROW_IE_EXCEPTION << "Cannot get blob! Edge isn't initialized.";
+
+    // Wrapper is created again only if memory of the edge or its data pointer is changed
+    std::lock_guard<std::mutex> lock{blobCacheMutex};
+    void* data = memoryPtr->GetData();
+    if (blobCache && blobCacheMemory == memoryPtr.get() && blobCacheData == data)
+        return blobCache;
+
     InferenceEngine::TensorDesc desc = getDesc();
 
     if (desc.getLayout() == InferenceEngine::Layout::ANY)
@@ -555,7 +562,10 @@ InferenceEngine::Blob::Ptr MKLDNNEdge::getBlob() {
     else
         desc = InferenceEngine::TensorDesc(desc.getPrecision(), dims.ToSizeVector(), desc.getBlockingDesc());
 
-    return make_blob_with_precision(desc, memoryPtr->GetData());
+    blobCache = make_blob_with_precision(desc, data);
+    blobCacheMemory = memoryPtr.get();
+    blobCacheData = data;
+    return blobCache;
 }
 
 void MKLDNNEdge::sharedMemFrom(const MKLDNNEdgePtr &edge) {
@@ -9,6 +9,7 @@
 #include "mkldnn_memory.h"
 #include "mkldnn_dims.h"
 #include <map>
+#include <mutex>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -74,6 +75,13 @@ private:
     MKLDNNMemoryPtr memoryPtr;
     Status status = Status::Uninitialized;
 
+    // Blob wrapper of the edge memory returned by getBlob(), the parent and the child
+    // may request it concurrently when primitives are created in parallel
+    std::mutex blobCacheMutex;
+    InferenceEngine::Blob::Ptr blobCache;
+    const MKLDNNMemory* blobCacheMemory = nullptr;
+    const void* blobCacheData = nullptr;
+
     InferenceEngine::TensorDesc getInputDesc();
     InferenceEngine::TensorDesc getOutputDesc();
     InferenceEngine::TensorDesc getSpecifiedInputDesc(std::map<mkldnn::memory::format, size_t> formats, size_t enterCountUp = 1, size_t enterCountDown = 0);
@@ -46,10 +46,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()} {
+    _compilePhases = CompilePhaseScope::root();
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
     // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
+    {
+        IE_COMPILE_PHASE("CloneNet");
+        _clonedNetwork = cloneNet(network);
+    }
 
     IE_SUPPRESS_DEPRECATED_START
     if (Precision::FP16 == network.getPrecision()) {
@@ -60,16 +64,21 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     // CPU Plugin doesn't natively support some precision like int64/fp16/bool
     // so will convert all layer/tensors fp16->fp32 , bool->u8.
     // Default int64->int32 conversion is already applied in IE common module.
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::I64, Precision::I32);
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::U64, Precision::I32);
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::FP16, Precision::FP32);
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::BOOL, Precision::U8);
+    {
+        IE_COMPILE_PHASE("ConvertPrecision");
+        NetPass::ConvertPrecision(*_clonedNetwork, {{Precision::I64, Precision::I32},
+                                                    {Precision::U64, Precision::I32},
+                                                    {Precision::FP16, Precision::FP32},
+                                                    {Precision::BOOL, Precision::U8}});
+    }
 
     if (s == StatusCode::OK && pstats && !pstats->isEmpty()) {
+        IE_COMPILE_PHASE("Int8Normalizer");
         CNNNetworkInt8Normalizer cnnorm;
         cnnorm.NormalizeNetwork(*_clonedNetwork, *pstats);
     } else {
         if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+            IE_COMPILE_PHASE("LowPrecisionTransformations");
             auto params = LayerTransformation::Params(true,  // updatePrecisions
                                                       true,  // quantizeOutputs
                                                       true,  // weightsToConst
@@ -114,7 +123,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
-    MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    {
+        IE_COMPILE_PHASE("ApplyUnrollPasses");
+        MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    }
 
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
@@ -138,7 +150,15 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                                                 ? std::max(1, threads/streamExecutorConfig._streams)
                                                 : threads;
         streamExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
+        if (cfg.sharedExecutor) {
+            auto scheduler = ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(
+                streamExecutorConfig, static_cast<size_t>(cfg.sharedExecutorMaxInFlight));
+            _sharedExecutor = scheduler->createClient(static_cast<unsigned int>(cfg.sharedExecutorWeight),
+                                                      static_cast<size_t>(cfg.sharedExecutorQuota));
+            _taskExecutor = _sharedExecutor;
+        } else {
+            _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
+        }
     }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
@@ -147,7 +167,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _callbackExecutor = _taskExecutor;
     }
 
-    _graphs = decltype(_graphs){[&] {
+    if (_cfg.collectLatencyHistograms) {
+        _latencyHistograms = std::make_shared<NodesLatencyHistograms>();
+    }
+
+    const bool interleaveWeights = useInterleavedWeights(_cfg);
+
+    // graphs are created in threads of streams, so their phases are attached to the phase of this thread explicitly
+    auto compilePhase = CompilePhaseScope::current();
+    _graphs = decltype(_graphs){[&, interleaveWeights, compilePhase] {
+        CompilePhaseScope createGraphPhase{"CreateGraph", compilePhase};
         // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
         //       is fixed and does not change content of network passed (CVS-26420)
         auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
@@ -161,29 +190,47 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         if (nullptr != streamExecutor) {
             numaNode = streamExecutor->GetNumaNodeId();
         }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
+        graph->numaNodeId = numaNode;
+        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager,
+                           interleaveWeights ? numaNodesWeights.interleaved() : numaNodesWeights[numaNode]);
+        if (_latencyHistograms) {
+            // nodes with the same name from graphs of all streams share the same histogram
+            for (auto &node : graph->GetNodes()) {
+                node->PerfCounter().setHistogram(_latencyHistograms->get(node->getName()));
+            }
+        }
         return graph;
     }};
 
     _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+}
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : _graphs.begin()->get()->GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto state_store = node->getChildEdgeAt(0)->getMemoryPtr();
-                auto state_name = node->getName();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
+bool MKLDNNExecNetwork::useInterleavedWeights(const Config& cfg) const {
+    const auto numaNodesNum = getAvailableNUMANodes().size();
+    const auto streams = static_cast<std::size_t>(cfg.streamExecutorConfig._streams);
+    // weights are not shared if there is a single stream or all streams run on the same node
+    if (cfg.exclusiveAsyncRequests || streams <= 1 || numaNodesNum <= 1)
+        return false;
+
+    switch (cfg.numaWeightsPolicy) {
+    case Config::NumaWeightsPolicy::Replicate:
+        return false;
+    case Config::NumaWeightsPolicy::Interleave:
+        return true;
+    default: {
+        // copies on every used node should not take too much memory
+        const std::size_t replicatedWeightsSizeLimit = std::size_t(1) << 30;
+        std::size_t weightsSize = 0;
+        CNNNetworkIterator i(static_cast<ICNNNetwork*>(_clonedNetwork.get()));
+        while (i != CNNNetworkIterator()) {
+            for (auto &blob : (*i)->blobs) {
+                if (blob.second)
+                    weightsSize += blob.second->byteSize();
             }
+            i++;
         }
+        return weightsSize * std::min(streams, numaNodesNum) > replicatedWeightsSizeLimit;
+    }
     }
 }
 
@@ -214,6 +261,23 @@ void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &grap
     graphPtr = _graphs.begin()->get()->dump();
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config, ResponseDesc *resp) {
+    if (config.empty()) {
+        THROW_IE_EXCEPTION << "The list of configuration values is empty";
+    }
+    for (auto &&item : config) {
+        if (item.first == CONFIG_KEY(LATENCY_HISTOGRAMS) && item.second.as<std::string>() == CONFIG_VALUE(RESET)) {
+            if (!_latencyHistograms)
+                THROW_IE_EXCEPTION << "Latency histograms are not collected. Load the network with "
+                                   << CONFIG_KEY(LATENCY_HISTOGRAMS) << " set to YES";
+            _latencyHistograms->reset();
+        } else {
+            THROW_IE_EXCEPTION << "The following config value cannot be changed dynamically for ExecutableNetwork: "
+                               << item.first;
+        }
+    }
+}
+
 void MKLDNNExecNetwork::GetConfig(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -240,6 +304,20 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(WEIGHTS_NUMA_PLACEMENT));
+        if (_latencyHistograms) {
+            metrics.push_back(METRIC_KEY(LAYERS_LATENCY_PERCENTILES));
+            metrics.push_back(METRIC_KEY(LAYERS_LATENCY_HISTOGRAMS));
+        }
+        if (_sharedExecutor) {
+            metrics.push_back(METRIC_KEY(SHARED_EXECUTOR_OCCUPANCY));
+        }
+        if (!_streamsAutotuneResults.empty()) {
+            metrics.push_back(METRIC_KEY(STREAMS_AUTOTUNE_RESULTS));
+        }
+        if (_compilePhases) {
+            metrics.push_back(METRIC_KEY(COMPILE_PHASES));
+        }
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -254,6 +332,42 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(WEIGHTS_NUMA_PLACEMENT)) {
+        std::map<int, std::map<int, std::size_t>> placement;
+        // streams running on the same node share weights, so every buffer is counted once per node
+        std::map<int, std::unordered_set<const void*>> visited;
+        for (auto &&graph : _graphs) {
+            auto &nodePlacement = placement[graph->numaNodeId];
+            for (auto &memory : graph->GetWeightsMemory()) {
+                if (!memory || !memory->GetPrimitivePtr() || !visited[graph->numaNodeId].insert(memory->GetData()).second)
+                    continue;
+                for (auto &pages : getMemoryNUMAPlacement(memory->GetData(), memory->GetSize()))
+                    nodePlacement[pages.first] += pages.second;
+            }
+        }
+        result = IE_SET_METRIC(WEIGHTS_NUMA_PLACEMENT, placement);
+    } else if (name == METRIC_KEY(LAYERS_LATENCY_PERCENTILES) && _latencyHistograms) {
+        result = IE_SET_METRIC(LAYERS_LATENCY_PERCENTILES, _latencyHistograms->percentiles());
+    } else if (name == METRIC_KEY(LAYERS_LATENCY_HISTOGRAMS) && _latencyHistograms) {
+        result = IE_SET_METRIC(LAYERS_LATENCY_HISTOGRAMS, _latencyHistograms->histograms());
+    } else if (name == METRIC_KEY(SHARED_EXECUTOR_OCCUPANCY) && _sharedExecutor) {
+        auto network = _sharedExecutor->getOccupancy();
+        auto total = _sharedExecutor->getScheduler()->getOccupancy();
+        std::map<std::string, uint64_t> occupancy = {
+            {"IN_FLIGHT", network.inFlight},
+            {"QUEUED", network.queued},
+            {"COMPLETED", network.completed},
+            {"TOTAL_IN_FLIGHT", total.inFlight},
+            {"TOTAL_QUEUED", total.queued},
+            {"TOTAL_COMPLETED", total.completed},
+            {"MAX_IN_FLIGHT", total.maxInFlight},
+            {"NETWORKS", total.clients},
+        };
+        result = IE_SET_METRIC(SHARED_EXECUTOR_OCCUPANCY, occupancy);
+    } else if (name == METRIC_KEY(STREAMS_AUTOTUNE_RESULTS) && !_streamsAutotuneResults.empty()) {
+        result = IE_SET_METRIC(STREAMS_AUTOTUNE_RESULTS, _streamsAutotuneResults);
+    } else if (name == METRIC_KEY(COMPILE_PHASES) && _compilePhases) {
+        result = IE_SET_METRIC(COMPILE_PHASES, getCompilePhaseDurations(_compilePhases));
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -314,6 +428,47 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
     return check_result;
 }
 
+std::string MKLDNNExecNetwork::memoryStateName(const std::string& memoryInputName) {
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = memoryInputName.find("/id=");
+    return memoryInputName.substr(0, suffix_idx);
+}
+
+void MKLDNNExecNetwork::registerMemoryState(const MKLDNNMemoryState::Ptr& state) {
+    std::lock_guard<std::mutex> lock{_memoryStatesMutex};
+    _requestsMemoryStates.erase(std::remove_if(_requestsMemoryStates.begin(), _requestsMemoryStates.end(),
+                                               [] (const std::weak_ptr<MKLDNNMemoryState>& s) { return s.expired(); }),
+                                _requestsMemoryStates.end());
+    _requestsMemoryStates.push_back(state);
+}
+
+void MKLDNNExecNetwork::setStreamsAutotuneResults(const std::map<int, std::pair<float, float>>& results) {
+    _streamsAutotuneResults = results;
+}
+
+std::vector<MKLDNNMemoryState::Ptr> MKLDNNExecNetwork::getRequestsMemoryStates(const std::string& name) {
+    std::lock_guard<std::mutex> lock{_memoryStatesMutex};
+    std::vector<MKLDNNMemoryState::Ptr> states;
+    for (auto& weakState : _requestsMemoryStates) {
+        auto state = weakState.lock();
+        if (state && state->GetName() == name)
+            states.push_back(state);
+    }
+    return states;
+}
+
 std::vector<IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
+    if (_graphs.size() == 0)
+        THROW_IE_EXCEPTION << "No graph was found";
+
+    std::weak_ptr<MKLDNNExecNetwork> network = std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this());
+    std::vector<IMemoryStateInternal::Ptr> memoryStates;
+    for (auto &node : _graphs.begin()->get()->GetMemoryInputNodes()) {
+        auto name = memoryStateName(node.first);
+        memoryStates.emplace_back(new MKLDNNNetworkMemoryState(name, [network, name] {
+            auto self = network.lock();
+            return self ? self->getRequestsMemoryStates(name) : std::vector<MKLDNNMemoryState::Ptr>{};
+        }));
+    }
     return memoryStates;
 }
@@ -8,7 +8,11 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_latency_histogram.hpp"
+#include "mkldnn_memory_state.h"
 #include <threading/ie_thread_local.hpp>
+#include <ie_compile_profiler.hpp>
+#include <threading/ie_shared_streams_executor.hpp>
 
 #include <vector>
 #include <memory>
@@ -36,28 +40,53 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config, InferenceEngine::ResponseDesc *resp) override;
+
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
 
     void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    /**
+     * @brief States of the executable network apply changes to the states of all infer requests.
+     * Use InferRequest::QueryState to control state of a single request.
+     */
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
+    /** Name of memory state kept by MemoryInput node */
+    static std::string memoryStateName(const std::string& memoryInputName);
+
+    void registerMemoryState(const MKLDNNMemoryState::Ptr& state);
+
+    /** Measurements the number of streams was chosen by, reported by STREAMS_AUTOTUNE_RESULTS metric */
+    void setStreamsAutotuneResults(const std::map<int, std::pair<float, float>>& results);
+
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
-    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
+    std::mutex                                  _memoryStatesMutex;
+    // memory states of all infer requests created by the network
+    std::vector<std::weak_ptr<MKLDNNMemoryState>> _requestsMemoryStates;
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    NodesLatencyHistograms::Ptr                 _latencyHistograms;
+    // set if requests run in the executor shared with other networks
+    InferenceEngine::SharedStreamsExecutor::Ptr _sharedExecutor;
+    // throughput and latency per candidate number of streams if the streams were autotuned
+    std::map<int, std::pair<float, float>>      _streamsAutotuneResults;
+    // phases of LoadNetwork which compiled the network, the tree is complete when LoadNetwork returns
+    InferenceEngine::CompilePhase::Ptr          _compilePhases;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+    std::vector<MKLDNNMemoryState::Ptr> getRequestsMemoryStates(const std::string& name);
+    bool useInterleavedWeights(const Config& cfg) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -20,7 +20,9 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
 #include <nodes/mkldnn_input_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
 
 #include <graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -28,6 +30,8 @@
 #include <net_pass.h>
 #include <details/ie_cnn_network_tools.h>
 #include <ie_memcpy.h>
+#include <ie_compile_profiler.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn_network_int8_normalizer.hpp"
 
@@ -93,7 +97,10 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    Replicate(net, extMgr);
+    {
+        IE_COMPILE_PHASE("Replicate");
+        Replicate(net, extMgr);
+    }
     InitGraph();
     status = Ready;
 }
@@ -169,6 +176,7 @@ void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNEx
 
         graphNodes.push_back(node);
         outputNodes.push_back(node);
+        outputNodesMap[output->getName()] = node;
 
         unused_data.erase(output);
     }
@@ -276,6 +284,24 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
         }
     }
 
+    // Pair MemoryOutput nodes with MemoryInput nodes of the same memory id,
+    // MemoryOutput writes directly into the output of its sibling
+    std::map<std::string, MKLDNNNode*> memoryInputs;
+    for (auto &node : graphNodes) {
+        auto memoryNode = dynamic_cast<MKLDNNMemoryNode*>(node.get());
+        if (memoryNode && node->getType() == MemoryInput)
+            memoryInputs[memoryNode->getId()] = node.get();
+    }
+    for (auto &node : graphNodes) {
+        auto memoryNode = dynamic_cast<MKLDNNMemoryNode*>(node.get());
+        if (!memoryNode || node->getType() != MemoryOutput)
+            continue;
+        auto memoryInput = memoryInputs.find(memoryNode->getId());
+        if (memoryInput == memoryInputs.end())
+            THROW_IE_EXCEPTION << "Cannot find MemoryInput node for " << node->getName();
+        memoryNode->setInputNode(memoryInput->second);
+    }
+
     std::map<std::string, DataPtr> outputs;
     network.getOutputsInfo(outputs);
 
@@ -296,6 +322,7 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
 
         graphNodes.push_back(node);
         outputNodes.push_back(node);
+        outputNodesMap[output.first] = node;
 
         unused_data.erase(data);
     }
@@ -340,24 +367,48 @@ void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
 
     SortTopologically();
-    InitNodes();
-    optimizer.ApplyCommonGraphOptimizations(*this);
+    {
+        IE_COMPILE_PHASE("InitNodes");
+        InitNodes();
+    }
+    {
+        IE_COMPILE_PHASE("CommonGraphOptimizations");
+        optimizer.ApplyCommonGraphOptimizations(*this);
+    }
     SortTopologically();
 
-    InitDescriptors();
+    {
+        IE_COMPILE_PHASE("InitDescriptors");
+        InitDescriptors();
+    }
 
-    for (auto &node : graphNodes) {
-        node->initOptimalPrimitiveDescriptor();
+    {
+        IE_COMPILE_PHASE("InitOptimalPrimitiveDescriptors");
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
+    }
+    {
+        IE_COMPILE_PHASE("InitEdges");
+        InitEdges();
     }
-    InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    {
+        IE_COMPILE_PHASE("ImplSpecificGraphOptimizations");
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    }
 
     SortTopologically();
 
-    Allocate();
+    {
+        IE_COMPILE_PHASE("Allocate");
+        Allocate();
+    }
 
-    CreatePrimitives();
+    {
+        IE_COMPILE_PHASE("CreatePrimitives");
+        CreatePrimitives();
+    }
 
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
@@ -406,22 +457,55 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    {
+        // reorders of weights are constant nodes, so they run here
+        IE_COMPILE_PHASE("ExecuteConstantNodes");
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (auto &graphNode : graphNodes) {
+            if (!graphNode->isConstant())
+                continue;
+            graphNode->execute(stream);
+        }
+    }
+
+    CreateExecutionPlan();
+}
+
+void MKLDNNGraph::CreateExecutionPlan() {
+    executableGraphNodes.clear();
+    memoryInputNodes.clear();
+    currentBatchLimit = -1;
     for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
+        if (graphNode->getType() == MemoryInput)
+            memoryInputNodes[graphNode->getName()] = graphNode;
+        if (graphNode->isConstant() || !graphNode->isExecutable())
             continue;
-        graphNode->execute(stream);
+        executableGraphNodes.push_back(graphNode);
     }
 }
 
 void MKLDNNGraph::InitNodes() {
     for (auto &node : graphNodes) {
+#if defined (COMPILED_CPU_MKLDNN_FULLYCONNECTED_NODE)
+        if (node->getType() == FullyConnected && config.sparseWeightsDensity > 0.f) {
+            auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+            if (fcNode)
+                fcNode->setSparseWeightsDensity(config.sparseWeightsDensity);
+        }
+#endif
         node->init();
     }
 }
 
 void MKLDNNGraph::InitDescriptors() {
-    for (auto &node : graphNodes) {
+    // Dimensions of edges are resolved lazily, resolve them before nodes of both ends read them concurrently
+    for (auto &edge : graphEdges) {
+        edge->getDims();
+    }
+
+    // Supported descriptors depend on the node and dimensions only, so mkldnn primitive descriptors
+    // of all nodes are queried in parallel
+    parallelForNodes(graphNodes, [&](const MKLDNNNodePtr &node) {
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
@@ -433,8 +517,9 @@ void MKLDNNGraph::InitDescriptors() {
 
         node->initSupportedPrimitiveDescriptors();
         node->filterSupportedPrimitiveDescriptors();
-    }
+    });
 
+    // Selection depends on the choice of parents and, for Concat and Split, of siblings, so it stays serial
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
     }
@@ -698,9 +783,11 @@ void MKLDNNGraph::Allocate() {
 }
 
 void MKLDNNGraph::CreatePrimitives() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::CreatePrimitives)
-    for (auto& node : graphNodes) {
+    // Memory of all edges is allocated at this point and a node only reads memory of its edges,
+    // so primitives including JIT kernels are generated in parallel
+    parallelForNodes(graphNodes, [](const MKLDNNNodePtr &node) {
         node->createPrimitive();
-    }
+    });
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -708,8 +795,6 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
-        MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
-
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
@@ -726,6 +811,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         // todo: make sure 'name' exists in this map...
         if (_meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
+                MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
                 THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
@@ -740,9 +826,9 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
 
-    for (MKLDNNNodePtr &node : outputNodes) {
-        // remove out_ from node name
-        std::string name = node->getName().substr(4);
+    for (auto &outputNode : outputNodesMap) {
+        const std::string& name = outputNode.first;
+        const MKLDNNNodePtr& node = outputNode.second;
         const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
         if (out.find(name) == out.end()) {
             // TODO: Create blob from MemoryDesc
@@ -770,7 +856,7 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         // That is the same memory. No need to copy
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
-        int MB = intr_blob.GetDims()[0];
+        int MB = intr_blob.GetDescriptor().data.dims[0];
         int MB_to_process = node->batchToProcess();
         // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
         if (config.batchLimit)
@@ -786,22 +872,37 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    // Batch limit is propagated to all nodes (not only executable ones) to keep
+    // validation of dynamic batch support, but only when it is changed
+    if (batch > 0 && batch != currentBatchLimit) {
+        for (auto &graphNode : graphNodes)
+            graphNode->setDynamicBatchLim(batch);
+        currentBatchLimit = batch;
+    }
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    // Eager stream keeps all primitives submitted to it, so it can not be reused between inferences
+    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+#ifdef BLOB_DUMP_PATH
+    // Dump requires visiting of all nodes including skipped by execution plan
+    for (auto &graphNode : graphNodes) {
+        PERF(graphNode);
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+        ENABLE_DUMP(do_before(DUMP_DIR, graphNode));
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+        if (!graphNode->isConstant()) {
+            IE_PROFILING_AUTO_SCOPE_TASK(graphNode->profilingTask)
+            graphNode->execute(stream);
         }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        ENABLE_DUMP(do_after(DUMP_DIR, graphNode));
+    }
+#else
+    for (auto &graphNode : executableGraphNodes) {
+        PERF(graphNode);
+        IE_PROFILING_AUTO_SCOPE_TASK(graphNode->profilingTask)
+        graphNode->execute(stream);
     }
+#endif
 
     if (infer_count != -1) infer_count++;
 }
@@ -890,6 +991,14 @@ void MKLDNNGraph::SortTopologically() {
     }
 }
 
+std::vector<MKLDNNMemoryPtr> MKLDNNGraph::GetWeightsMemory() const {
+    std::vector<MKLDNNMemoryPtr> memory;
+    for (auto &node : graphNodes) {
+        memory.insert(memory.end(), node->internalBlobMemory.begin(), node->internalBlobMemory.end());
+    }
+    return memory;
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
@@ -946,9 +1055,8 @@ void MKLDNNGraph::getInputBlobs(InferenceEngine::BlobMap &resp) {
 }
 
 void MKLDNNGraph::getOutputBlobs(InferenceEngine::BlobMap &resp) {
-    for (auto &it : outputNodes) {
-        std::string name = it->getName().substr(4);
-        resp[name] = it->getParentEdgeAt(0)->getBlob();
+    for (auto &it : outputNodesMap) {
+        resp[it.first] = it.second->getParentEdgeAt(0)->getBlob();
     }
 }
 
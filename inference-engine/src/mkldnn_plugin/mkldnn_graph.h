@@ -12,6 +12,7 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include <exception>
 #include <map>
 #include <string>
 #include <vector>
@@ -19,10 +20,31 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Runs func for every node in parallel. Exceptions are collected and the one of the first failed node
+ * in the graph order is rethrown, so errors are the same as for the serial loop.
+ */
+template <typename T, typename F>
+void parallelForNodes(const std::vector<T> &nodes, const F &func) {
+    std::vector<std::exception_ptr> errors(nodes.size());
+    InferenceEngine::parallel_for(nodes.size(), [&](size_t i) {
+        try {
+            func(nodes[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (auto &&error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    int numaNodeId = 0;  // NUMA node of the stream the graph is executed by
 
     enum Status {
         NotReady = 0,
@@ -78,6 +100,13 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    const std::map<std::string, MKLDNNNodePtr>& GetMemoryInputNodes() const {
+        return memoryInputNodes;
+    }
+
+    /** Memory of weights and other internal blobs of all nodes */
+    std::vector<MKLDNNMemoryPtr> GetWeightsMemory() const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -101,8 +130,12 @@ protected:
 
         inputNodes.clear();
         outputNodes.clear();
+        outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executableGraphNodes.clear();
+        memoryInputNodes.clear();
+        currentBatchLimit = -1;
         _meanImages.clear();
     }
     Status status;
@@ -118,9 +151,18 @@ protected:
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
+    // Output nodes by names of network outputs
+    std::map<std::string, MKLDNNNodePtr> outputNodesMap;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Execution plan: non constant nodes which do real work in Infer(), in execution order
+    std::vector<MKLDNNNodePtr> executableGraphNodes;
+    // Dynamic batch limit currently applied to the graph nodes. -1 - not set.
+    int currentBatchLimit = -1;
+    // MemoryInput nodes by name. Output of these nodes keeps state bound by an infer request
+    std::map<std::string, MKLDNNNodePtr> memoryInputNodes;
+
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
@@ -135,6 +177,7 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void CreateExecutionPlan();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -13,10 +13,13 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_gemm_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_resample_node.h"
+#include "nodes/mkldnn_embedding_bag_node.h"
+#include "nodes/mkldnn_reduce_node.h"
 
 #include <blob_factory.hpp>
 #include <ie_layers_internal.hpp>
@@ -57,6 +60,11 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseBroadcastAndEltwise(graph);
     graph.RemoveDroppedNodes();
 
+#if defined(COMPILED_CPU_MKLDNN_EMBEDDING_BAG_NODE)
+    FuseGatherAndSparseReduce(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
     FuseClampAndQuantize(graph);
     graph.RemoveDroppedNodes();
 
@@ -69,6 +77,14 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
+    FuseGemmAndZeroPoints(graph);
+    graph.RemoveDroppedNodes();
+
+#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
+    FuseGemmAndDepthwise(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
     FuseConvolutionAndDepthwise(graph);
     graph.RemoveDroppedNodes();
@@ -135,6 +151,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseNormalizeAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseReduceAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
@@ -412,6 +431,78 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseGemmAndZeroPoints(MKLDNNGraph &graph) {
+    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
+        auto& edges = graph.GetEdges();
+        for (auto it = edges.begin(); it != edges.end(); it++) {
+            if ((*it) == edge) {
+                edges.erase(it);
+                return;
+            }
+        }
+    };
+
+    auto& graphNodes = graph.GetNodes();
+
+    auto initializeInputZeroPoints = [](MKLDNNNodePtr node, MKLDNNNodePtr parent0) {
+        auto* gemmNode = dynamic_cast<MKLDNNGemmNode*>(node.get());
+        if (gemmNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get gemm node " << node->getName();
+
+        if (parent0->getType() != Eltwise || parent0->getChildEdges().size() != 1)
+            return false;
+
+        auto* eltwiseLayer = dynamic_cast<EltwiseLayer*>(parent0->getCnnLayer().get());
+        if (eltwiseLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get eltwise layer " << parent0->getName();
+
+        if (eltwiseLayer->_operation != EltwiseLayer::Sub || parent0->getParentEdges().size() != 2)
+            return false;
+
+        auto arg0 = parent0->getParentEdgesAtPort(1)[0]->getParent();
+        if (arg0->getCnnLayer()->type != "Const" || arg0->getCnnLayer()->outData[0]->getPrecision() != Precision::U8)
+            return false;
+
+        auto arg1 = parent0->getParentEdgesAtPort(0)[0]->getParent();
+        if (arg1->getCnnLayer()->outData[0]->getPrecision() != Precision::U8)
+            return false;
+
+        auto zeroPointsBlob = dynamic_cast<TBlob<uint8_t>*>(arg0->getCnnLayer()->blobs["custom"].get());
+        if (zeroPointsBlob == nullptr)
+            return false;
+
+        // per channel zero points are supported for 4D inputs only where channels are a batch dimension
+        auto inDims = node->getParentEdgesAtPort(0)[0]->getDims();
+        auto zeroPointsData = zeroPointsBlob->buffer().as<uint8_t*>();
+        auto zeroPointsCount = static_cast<int>(zeroPointsBlob->size());
+        bool isPerTensor = std::all_of(zeroPointsData, zeroPointsData + zeroPointsCount,
+                                       [&](uint8_t value) { return value == zeroPointsData[0]; });
+        if (!isPerTensor && (inDims.ndims() != 4 || zeroPointsCount != inDims[1]))
+            return false;
+
+        gemmNode->inputZeroPoints.assign(zeroPointsData, zeroPointsData + (isPerTensor ? 1 : zeroPointsCount));
+        if (!gemmNode->isInt8()) {
+            gemmNode->inputZeroPoints.clear();
+            return false;
+        }
+
+        return true;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto gemm = graphNodes[i];
+        if (gemm->getType() != Gemm || gemm->getParentEdges().size() != 2) continue;
+
+        auto dataEltwise = gemm->getParentEdgesAtPort(0)[0]->getParent();
+        if (initializeInputZeroPoints(gemm, dataEltwise)) {
+            auto p_edge = dataEltwise->getParentEdgesAtPort(1)[0];
+            removeEdge(graph, p_edge);
+
+            graph.DropNode(dataEltwise);
+        }
+    }
+}
+
 void MKLDNNGraphOptimizer::MergeGroupConvolution(MKLDNNGraph &graph) {
     for (auto node : graph.GetNodes()) {
         // Split with at least 2 Convolutions
@@ -886,6 +977,55 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
         graph.DropNode(depthwise0);
     }
 }
+
+void MKLDNNGraphOptimizer::FuseGemmAndDepthwise(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Gemm || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* gemmNode = dynamic_cast<MKLDNNGemmNode *>(node.get());
+        if (gemmNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get gemm node " << node->getName();
+        return gemmNode->isInt8();
+    };
+
+    auto isSuitableChildNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Depthwise || node->getParentEdges().size() != 1)
+            return false;
+
+        if (!node->getCnnLayer())
+            return false;
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get depthwise node " << node->getName();
+        return depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift;
+    };
+
+    // dequantization of s32 results is applied by the gemm itself
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto gemm = graphNodes[i];
+        if (!isSuitableParentNode(gemm)) continue;
+
+        auto depthwise0 = gemm->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(depthwise0)) continue;
+
+        gemm->fuseWith(depthwise0);
+
+        if (depthwise0->getChildEdges().size() == 1) {
+            auto depthwise1 = depthwise0->getChildEdgeAt(0)->getChild();
+
+            if (isSuitableChildNode(depthwise1)) {
+                gemm->fuseWith(depthwise1);
+                graph.DropNode(depthwise1);
+            }
+        }
+
+        graph.DropNode(depthwise0);
+    }
+}
 #endif
 
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
@@ -1778,6 +1918,98 @@ void MKLDNNGraphOptimizer::FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseReduceAndSimpleOperation(MKLDNNGraph &graph) {
+    auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
+        for (auto a : algs) {
+            if (alg == a) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
+        auto& edges = graph.GetEdges();
+        for (auto it = edges.begin(); it != edges.end(); it++) {
+            if ((*it) == edge) {
+                edges.erase(it);
+                return;
+            }
+        }
+    };
+
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        // integer data is reduced by the reference implementation which has no post ops
+        bool isSutableReduce = node->getType() == Reduce && node->getCnnLayer() &&
+                               node->getCnnLayer()->insData[0].lock()->getPrecision() != Precision::I32 &&
+                               mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::sse42);
+
+        if (isSutableReduce) {
+            return node->getChildEdges().size() == 1;
+        } else {
+            return false;
+        }
+    };
+
+    auto isSutableChildNode = [&](MKLDNNNodePtr node) {
+        if (!node->getCnnLayer())
+            return false;
+
+        if (node->getType() == Quantize) {
+            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+            if (quantizeNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
+            return !quantizeNode->isBinarization();
+        } else if (node->getType() == Depthwise) {
+            auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
+            if (depthwiseNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get depthwise layer " << node->getName();
+            return ((depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift && depthwiseNode->isWithBiases()) ||
+                    (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu));
+        } else if (node->getType() == Activation) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
+            if (activationNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
+            return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_gelu, eltwise_elu, eltwise_logistic,
+                eltwise_bounded_relu, eltwise_clamp, eltwise_tanh, eltwise_swish, eltwise_linear, eltwise_abs,
+                eltwise_square, eltwise_sqrt});
+        }
+        return false;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSutableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSutableChildNode(childNode)) {
+            parent++;
+            continue;
+        }
+
+        parentNode->fuseWith(childNode);
+
+        if (childNode->getType() == Quantize) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent()->getType() == Reduce)
+                    continue;
+
+                removeEdge(graph, p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
         for (auto a : algs) {
@@ -2140,6 +2372,116 @@ void MKLDNNGraphOptimizer::FuseBroadcastAndEltwise(MKLDNNGraph &graph) {
     }
 }
 
+#if defined(COMPILED_CPU_MKLDNN_EMBEDDING_BAG_NODE)
+void MKLDNNGraphOptimizer::FuseGatherAndSparseReduce(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+    std::vector<MKLDNNNodePtr> newNodes;
+
+    auto isSutableGather = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Generic || node->getTypeStr() != "Gather" ||
+            node->getParentEdges().size() != 2 || node->getChildEdges().size() != 1)
+            return false;
+
+        // Only rows of the table are gathered by 1D indices
+        auto& tableDims = node->getParentEdgesAtPort(0)[0]->getDims();
+        int axis = node->getCnnLayer()->GetParamAsInt("axis", 0);
+        if (axis < 0)
+            axis += tableDims.ndims();
+        if (axis != 0 || node->getParentEdgesAtPort(1)[0]->getDims().ndims() != 1)
+            return false;
+
+        // Tables of other precisions are not read by the fused node directly
+        Precision tablePrecision = node->getCnnLayer()->insData[0].lock()->getPrecision();
+        return tablePrecision == Precision::FP32 || tablePrecision == Precision::BF16 ||
+               tablePrecision == Precision::I8 || tablePrecision == Precision::U8;
+    };
+
+    auto isSutableConvert = [](const MKLDNNNodePtr& node) {
+        return node->getTypeStr() == "Convert" && node->getParentEdges().size() == 1 &&
+               node->getChildEdges().size() == 1 && node->getCnnLayer()->outData[0]->getPrecision() == Precision::FP32;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto gatherNode = graphNodes[i];
+        if (!isSutableGather(gatherNode))
+            continue;
+
+        // Gathered rows of integer tables are converted to FP32 before reduction
+        MKLDNNNodePtr convertNode;
+        auto reduceEdge = gatherNode->getChildEdgeAt(0);
+        if (isSutableConvert(reduceEdge->getChild())) {
+            convertNode = reduceEdge->getChild();
+            reduceEdge = convertNode->getChildEdgeAt(0);
+        }
+        auto reduceNode = reduceEdge->getChild();
+        if (reduceNode->getType() != Generic || !MKLDNNEmbeddingBagNode::isSupportedReduce(reduceNode->getTypeStr()) ||
+            reduceEdge->getOutputNum() != MKLDNNEmbeddingBagNode::tablePort(reduceNode->getTypeStr()))
+            continue;
+
+        auto gatherLayer = gatherNode->getCnnLayer();
+        auto reduceLayer = reduceNode->getCnnLayer();
+        const size_t tablePort = MKLDNNEmbeddingBagNode::tablePort(reduceLayer->type);
+
+        // Inputs of the reduce layer with the table instead of gathered rows and indices of Gather as the last input
+        CNNLayerPtr embeddingBagLayer(new CNNLayer({reduceLayer->name, "EmbeddingBag", reduceLayer->precision}));
+        embeddingBagLayer->params["reduce"] = reduceLayer->type;
+        embeddingBagLayer->insData = reduceLayer->insData;
+        embeddingBagLayer->insData[tablePort] = gatherLayer->insData[0];
+        embeddingBagLayer->insData.push_back(gatherLayer->insData[1]);
+        embeddingBagLayer->outData = reduceLayer->outData;
+        MKLDNNNodePtr embeddingBagNode(new MKLDNNEmbeddingBagNode(embeddingBagLayer, graph.getEngine(), graph.weightsCache));
+
+        std::vector<MKLDNNEdgePtr> parentEdges;
+        for (size_t port = 0; port < reduceLayer->insData.size(); port++) {
+            parentEdges.push_back(port == tablePort ? gatherNode->getParentEdgesAtPort(0)[0]
+                                                    : reduceNode->getParentEdgesAtPort(port)[0]);
+        }
+        parentEdges.push_back(gatherNode->getParentEdgesAtPort(1)[0]);
+        std::vector<MKLDNNEdgePtr> childEdges;
+        for (size_t j = 0; j < reduceNode->getChildEdges().size(); j++)
+            childEdges.push_back(reduceNode->getChildEdgeAt(j));
+
+        // Edges of the fused nodes are replaced by edges of the new node in the same order of ports
+        auto& edges = graph.GetEdges();
+        for (auto& node : {gatherNode, convertNode, reduceNode}) {
+            if (!node)
+                continue;
+            auto nodeEdges = node->parentEdges;
+            nodeEdges.insert(nodeEdges.end(), node->childEdges.begin(), node->childEdges.end());
+            for (auto& edgeWeak : nodeEdges) {
+                auto edge = edgeWeak.lock();
+                if (!edge)
+                    continue;
+                edge->drop();
+                edges.erase(std::remove(edges.begin(), edges.end(), edge), edges.end());
+            }
+        }
+
+        for (size_t port = 0; port < parentEdges.size(); port++) {
+            MKLDNNEdgePtr newEdge(new MKLDNNEdge(parentEdges[port]->getParent(), embeddingBagNode,
+                                                 parentEdges[port]->getInputNum(), static_cast<int>(port)));
+            embeddingBagNode->addEdge(newEdge);
+            edges.push_back(newEdge);
+        }
+        for (auto& childEdge : childEdges) {
+            MKLDNNEdgePtr newEdge(new MKLDNNEdge(embeddingBagNode, childEdge->getChild(),
+                                                 childEdge->getInputNum(), childEdge->getOutputNum()));
+            embeddingBagNode->addEdge(newEdge);
+            edges.push_back(newEdge);
+        }
+
+        embeddingBagNode->addOriginalLayer(gatherLayer);
+        if (convertNode)
+            embeddingBagNode->addOriginalLayer(convertNode->getCnnLayer());
+        embeddingBagNode->addOriginalLayer(reduceLayer);
+        newNodes.push_back(embeddingBagNode);
+    }
+
+    for (auto& node : newNodes)
+        graphNodes.push_back(node);
+}
+#endif
+
 void MKLDNNGraphOptimizer::FuseClampAndQuantize(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
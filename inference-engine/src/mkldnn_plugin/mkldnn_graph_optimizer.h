@@ -29,6 +29,7 @@ private:
 #endif
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
     void FuseConvolutionAndDepthwise(MKLDNNGraph &graph);
+    void FuseGemmAndDepthwise(MKLDNNGraph &graph);
 #endif
     void FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
@@ -44,6 +45,7 @@ private:
     void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void FuseResampleAndSimpleOperation(MKLDNNGraph &graph);
     void FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseReduceAndSimpleOperation(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
@@ -52,7 +54,11 @@ private:
     void DropConvertReorder(MKLDNNGraph& graph);
 #endif
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
+    void FuseGemmAndZeroPoints(MKLDNNGraph &graph);
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
+#if defined(COMPILED_CPU_MKLDNN_EMBEDDING_BAG_NODE)
+    void FuseGatherAndSparseReduce(MKLDNNGraph &graph);
+#endif
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FuseScaleShiftAndQuantize(MKLDNNGraph &graph);
     void FuseClampAndQuantize(MKLDNNGraph &graph);
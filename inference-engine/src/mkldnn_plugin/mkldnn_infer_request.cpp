@@ -4,6 +4,7 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <cstring>
 #include <vector>
 #include <string>
 #include <map>
@@ -11,8 +12,10 @@
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
+#include <precision_utils.h>
 #include "inference_engine.hpp"
 #include "mkldnn_exec_network.h"
+#include "mkldnn_memory_state.h"
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
@@ -34,6 +37,17 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
     }
+
+    // Every request keeps its own memory states, so requests can process independent sequences
+    for (auto& node : graph->memoryInputNodes) {
+        auto storage = std::make_shared<MKLDNNMemory>(graph->getEngine());
+        storage->Create(node.second->getChildEdgeAt(0)->getMemory().GetDescriptor());
+        storage->FillZero();
+
+        auto state = std::make_shared<MKLDNNMemoryState>(MKLDNNExecNetwork::memoryStateName(node.first), storage);
+        memoryStates.emplace_back(node.first, state);
+        execNetwork->registerMemoryState(state);
+    }
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
@@ -57,6 +71,18 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
 namespace {
 
+void convertToFloat(float* dst, const uint8_t* src, size_t size) {
+    InferenceEngine::PrecisionUtils::u8tof32Arrays(dst, src, size);
+}
+
+void convertToFloat(float* dst, const uint16_t* src, size_t size) {
+    InferenceEngine::PrecisionUtils::u16tof32Arrays(dst, src, size);
+}
+
+void convertToFloat(float* dst, const int16_t* src, size_t size) {
+    InferenceEngine::PrecisionUtils::i16tof32Arrays(dst, src, size);
+}
+
 template <typename T>
 void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
     if (!dst) {
@@ -72,11 +98,23 @@ void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
     if (srcPtr == nullptr) {
         THROW_IE_EXCEPTION << "Input data was not allocated.";
     }
-    for (size_t i = 0; i < t_blob->size(); i++) dst[i] = srcPtr[i];
+    convertToFloat(dst, srcPtr, t_blob->size());
 }
 
 }  // namespace
 
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::getConvertedInput(const std::string& name,
+                                                                              const InferenceEngine::TensorDesc& desc) {
+    // FP32 blob is kept by the request and reused while shape and layout of the input are the same
+    auto& converted = convertedInputs[name];
+    if (!converted || converted->getTensorDesc().getDims() != desc.getDims() ||
+        converted->getTensorDesc().getLayout() != desc.getLayout()) {
+        converted = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, desc.getDims(), desc.getLayout()});
+        converted->allocate();
+    }
+    return converted;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     IE_PROFILING_AUTO_SCOPE_TASK(profilingTask)
     graph = execNetwork->_graphs.local().get();
@@ -85,17 +123,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
         changeDefaultPtr();
 
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-        for (auto input : _inputs) {
-            if (!_networkInputs[input.first]) {
+        for (auto& input : _inputs) {
+            if (_networkInputs.find(input.first) == _networkInputs.end()) {
                 THROW_IE_EXCEPTION <<
                                     "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                     << input.first;
             }
 
             InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
                 case InferenceEngine::Precision::FP32:
                     pushInput<float>(input.first, input.second);
@@ -108,29 +143,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                     break;
                 case InferenceEngine::Precision::U16:
                     // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                        input.second->getTensorDesc().getDims(),
-                                                                        input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    copyToFloat<uint16_t>(in_f->data(), input.second.get());
+                    iconv = getConvertedInput(input.first, input.second->getTensorDesc());
+                    copyToFloat<uint16_t>(iconv->buffer().as<float*>(), input.second.get());
                     pushInput<float>(input.first, iconv);
                     break;
                 case InferenceEngine::Precision::I16:
                     if (graph->hasMeanImageFor(input.first)) {
                         // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<int16_t>(in_f->data(), input.second.get());
+                        iconv = getConvertedInput(input.first, input.second->getTensorDesc());
+                        copyToFloat<int16_t>(iconv->buffer().as<float*>(), input.second.get());
                         pushInput<float>(input.first, iconv);
                     } else {
                         // Instead we can send I16 directly
@@ -141,15 +162,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                 case InferenceEngine::Precision::BOOL:
                     if (graph->hasMeanImageFor(input.first)) {
                         // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<uint8_t>(in_f->data(), input.second.get());
+                        iconv = getConvertedInput(input.first, input.second->getTensorDesc());
+                        copyToFloat<uint8_t>(iconv->buffer().as<float*>(), input.second.get());
                         pushInput<float>(input.first, iconv);
                     } else {
                         // Instead we can send I8 directly
@@ -162,7 +176,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         }
     }
 
-    graph->Infer(m_curBatch);
+    // The graph refers to state memory of the request only while the request is inferred
+    pushStates();
+    try {
+        graph->Infer(m_curBatch);
+    } catch (...) {
+        pullStates();
+        throw;
+    }
+    pullStates();
 
     graph->PullOutputData(_outputs);
 }
@@ -330,52 +352,54 @@ static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
+// Checks whether memory of all output edges of an input node can be replaced by external memory
+static bool canChangeChildEdgesPtr(const MKLDNNPlugin::MKLDNNNodePtr &node) {
+    // Input cannot be in-place with other primitives
+    bool canBeInPlace = true;
+    for (size_t i = 0; canBeInPlace && i < node->getChildEdges().size(); i++) {
+        auto& child = node->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            canBeInPlace = false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+        auto* concat = dynamic_cast<MKLDNNPlugin::MKLDNNConcatNode *>(child.get());
+        if (canBeInPlace && concat && concat->isOptimized())
+            canBeInPlace = false;
+#endif
+        // Cannot be in-place before split because split is using different ptrs without offsets
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+        auto* split = dynamic_cast<MKLDNNPlugin::MKLDNNSplitNode *>(child.get());
+        if (canBeInPlace && split)
+            canBeInPlace = false;
+#endif
+
+        if (child->isInplace())
+            canBeInPlace = false;
+        for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    node->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                canBeInPlace = false;
+        }
+    }
+    return canBeInPlace;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         auto input = graph->inputNodes.find(it.first);
         if (input != graph->inputNodes.end()) {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-#endif
-                // Cannot be in-place before split because split is using different ptrs without offsets
-#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-#endif
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
+            if (canChangeChildEdgesPtr(input->second)) {
+                for (size_t i = 0; i < input->second->getChildEdges().size(); i++) {
+                    changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
                 }
             }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
-            }
             continue;
         }
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
-                break;
-            }
-        }
-        if (output) {
+        auto outputNode = graph->outputNodesMap.find(it.first);
+        if (outputNode != graph->outputNodesMap.end()) {
+            auto& output = outputNode->second;
             if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
             bool canBeInPlace = true;
@@ -405,6 +429,51 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::pushStates() {
+    for (auto& state : memoryStates) {
+        auto node = graph->memoryInputNodes.find(state.first);
+        if (node == graph->memoryInputNodes.end())
+            THROW_IE_EXCEPTION << "Cannot find memory input node: " << state.first;
+
+        void* statePtr = state.second->GetStorage()->GetData();
+        auto& edgeMemory = node->second->getChildEdgeAt(0)->getMemory();
+        if (edgeMemory.GetData() == statePtr)
+            continue;
+
+        // Bind state of the request to the graph. Otherwise it is copied in and copied back after inference
+        if (canChangeChildEdgesPtr(node->second)) {
+            for (size_t i = 0; i < node->second->getChildEdges().size(); i++) {
+                auto edge = node->second->getChildEdgeAt(i);
+                boundStateEdges.emplace_back(edge, edge->getMemory().GetData());
+                changeEdgePtr(edge, statePtr);
+            }
+        } else {
+            memcpy(edgeMemory.GetData(), statePtr, edgeMemory.GetSize());
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::pullStates() {
+    for (auto& state : memoryStates) {
+        void* statePtr = state.second->GetStorage()->GetData();
+        auto& edgeMemory = graph->memoryInputNodes[state.first]->getChildEdgeAt(0)->getMemory();
+        if (edgeMemory.GetData() != statePtr)
+            memcpy(statePtr, edgeMemory.GetData(), edgeMemory.GetSize());
+    }
+
+    // Return the graph its own memory, so it never keeps pointers to states of destroyed requests
+    for (auto& edge : boundStateEdges)
+        changeEdgePtr(edge.first, edge.second);
+    boundStateEdges.clear();
+}
+
+std::vector<InferenceEngine::IMemoryStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> states;
+    for (auto& state : memoryStates)
+        states.push_back(state.second);
+    return states;
+}
+
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
     if (!graph->getProperty().enableDynamicBatch)
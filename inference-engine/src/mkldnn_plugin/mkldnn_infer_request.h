@@ -5,9 +5,12 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_memory_state.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <utility>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -43,13 +46,24 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
+    InferenceEngine::Blob::Ptr getConvertedInput(const std::string& name, const InferenceEngine::TensorDesc& desc);
     void changeDefaultPtr();
+    void pushStates();
+    void pullStates();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
     InferenceEngine::ProfilingTask      profilingTask;
+    // memory states of the request by names of MemoryInput nodes
+    std::vector<std::pair<std::string, MKLDNNMemoryState::Ptr>> memoryStates;
+    // edges bound to memory states of the request during inference and their own memory
+    std::vector<std::pair<MKLDNNEdgePtr, void*>> boundStateEdges;
+    // FP32 copies of inputs with precisions unsupported by the graph, retained until infer finish
+    std::map<std::string, InferenceEngine::Blob::Ptr> convertedInputs;
 };
 }  // namespace MKLDNNPlugin
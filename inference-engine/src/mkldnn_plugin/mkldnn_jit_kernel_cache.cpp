@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_jit_kernel_cache.hpp"
+
+#include <string>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+constexpr size_t MKLDNNJitKernelCache::kDefaultCapacity;
+
+MKLDNNJitKernelCache& MKLDNNJitKernelCache::instance() {
+    static MKLDNNJitKernelCache cache;
+    return cache;
+}
+
+std::shared_ptr<void> MKLDNNJitKernelCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = kernels.find(key);
+    if (found == kernels.end()) {
+        statistics.misses++;
+        return nullptr;
+    }
+    statistics.hits++;
+    lru.splice(lru.begin(), lru, found->second.lruPosition);
+    return found->second.kernel;
+}
+
+std::shared_ptr<void> MKLDNNJitKernelCache::insert(const std::string& key, std::shared_ptr<void> kernel, size_t size) {
+    std::lock_guard<std::mutex> lock(guard);
+    // the same kernel may be generated by another thread meanwhile, the first one is shared
+    auto found = kernels.find(key);
+    if (found != kernels.end())
+        return found->second.kernel;
+    if (size > capacity)
+        return kernel;
+
+    lru.push_front(key);
+    kernels[key] = Entry{kernel, size, lru.begin()};
+    statistics.kernels++;
+    statistics.codeSize += size;
+    evict();
+    return kernel;
+}
+
+void MKLDNNJitKernelCache::evict() {
+    while (statistics.codeSize > capacity) {
+        auto found = kernels.find(lru.back());
+        statistics.codeSize -= found->second.size;
+        statistics.kernels--;
+        statistics.evictions++;
+        kernels.erase(found);
+        lru.pop_back();
+    }
+}
+
+void MKLDNNJitKernelCache::setCapacity(size_t bytes) {
+    std::lock_guard<std::mutex> lock(guard);
+    capacity = bytes;
+    evict();
+}
+
+MKLDNNJitKernelCache::Statistics MKLDNNJitKernelCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return statistics;
+}
+
+void MKLDNNJitKernelCache::clear() {
+    std::lock_guard<std::mutex> lock(guard);
+    kernels.clear();
+    lru.clear();
+    statistics.kernels = 0;
+    statistics.codeSize = 0;
+}
+
+}  // namespace MKLDNNPlugin
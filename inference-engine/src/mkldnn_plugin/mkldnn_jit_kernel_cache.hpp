@@ -0,0 +1,126 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides a declaration of the process wide cache of JIT kernels
+ * @file
+ */
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Key of a JIT kernel: a kernel name followed by the binary values of all parameters used by its generator
+ *
+ * A kernel is selected by the ISA of the host, which is the same for the whole process, so keys do not contain it.
+ */
+class JitKernelKey {
+public:
+    explicit JitKernelKey(const char* name) : key(name) {
+        key.push_back('\0');
+    }
+
+    template <typename T>
+    JitKernelKey& operator<<(const T& value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only scalar parameters can be added to a JIT kernel key");
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        return *this;
+    }
+
+    template <typename T>
+    JitKernelKey& operator<<(const std::vector<T>& values) {
+        *this << values.size();
+        for (const auto& value : values)
+            *this << value;
+        return *this;
+    }
+
+    const std::string& str() const { return key; }
+
+private:
+    std::string key;
+};
+
+/**
+ * Caching store of generated JIT kernels shared by nodes of all graphs and networks
+ * Will return a cached kernel or generate a new one
+ *
+ * Kernels are immutable after generation, so a kernel may be executed by several nodes concurrently.
+ * Only kernels which do not embed pointers to node data may be cached, e.g. kernels with post ops
+ * reference weights of fused nodes and must not be shared.
+ * The least recently used kernels are dropped from the cache when the size of their code exceeds the capacity,
+ * nodes which use them keep them alive.
+ *
+ * Is a thread safe
+ */
+class MKLDNNJitKernelCache {
+public:
+    static constexpr size_t kDefaultCapacity = 16 * 1024 * 1024;
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t kernels = 0;
+        size_t codeSize = 0;
+    };
+
+    explicit MKLDNNJitKernelCache(size_t capacity = kDefaultCapacity) : capacity(capacity) {}
+
+    /** Cache used by all nodes of the process */
+    static MKLDNNJitKernelCache& instance();
+
+    /**
+     * @param key Parameters of the kernel
+     * @param create Generates the kernel and returns a raw pointer to it, the kernel must provide getSize()
+     *        returning the size of its code. It is called without a lock, so kernels are generated in parallel.
+     */
+    template <typename Kernel, typename Create>
+    std::shared_ptr<Kernel> findOrCreate(const JitKernelKey& key, const Create& create) {
+        auto found = find(key.str());
+        if (found)
+            return std::static_pointer_cast<Kernel>(found);
+
+        auto* impl = create();
+        std::shared_ptr<Kernel> kernel(impl);
+        return std::static_pointer_cast<Kernel>(insert(key.str(), kernel, impl->getSize()));
+    }
+
+    /** Sets maximal total size of code of cached kernels in bytes, zero disables caching */
+    void setCapacity(size_t bytes);
+
+    Statistics getStatistics() const;
+
+    void clear();
+
+private:
+    struct Entry {
+        std::shared_ptr<void> kernel;
+        size_t size;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    std::shared_ptr<void> find(const std::string& key);
+    std::shared_ptr<void> insert(const std::string& key, std::shared_ptr<void> kernel, size_t size);
+    void evict();
+
+    mutable std::mutex guard;
+    std::unordered_map<std::string, Entry> kernels;
+    std::list<std::string> lru;  // the most recently used keys first
+    size_t capacity;
+    Statistics statistics;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_latency_histogram.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace MKLDNNPlugin {
+
+constexpr int LatencyHistogram::kSubBucketBits;
+constexpr int LatencyHistogram::kMaxValueBits;
+constexpr size_t LatencyHistogram::kSubBucketCount;
+constexpr size_t LatencyHistogram::kBucketsNum;
+
+static inline int msb(uint64_t value) {
+    int pos = 0;
+    if (value >> 32) { value >>= 32; pos += 32; }
+    if (value >> 16) { value >>= 16; pos += 16; }
+    if (value >> 8)  { value >>= 8;  pos += 8; }
+    if (value >> 4)  { value >>= 4;  pos += 4; }
+    if (value >> 2)  { value >>= 2;  pos += 2; }
+    if (value >> 1)  { pos += 1; }
+    return pos;
+}
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t valueNs) {
+    const uint64_t maxValue = (uint64_t(1) << kMaxValueBits) - 1;
+    valueNs = std::min(valueNs, maxValue);
+    if (valueNs < kSubBucketCount)
+        return static_cast<size_t>(valueNs);
+
+    int shift = msb(valueNs) - kSubBucketBits;
+    // (valueNs >> shift) is in [kSubBucketCount, 2 * kSubBucketCount)
+    return (static_cast<size_t>(shift + 1) << kSubBucketBits) + static_cast<size_t>((valueNs >> shift) - kSubBucketCount);
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    if (index < kSubBucketCount)
+        return index;
+
+    int shift = static_cast<int>(index >> kSubBucketBits) - 1;
+    uint64_t sub = (index & (kSubBucketCount - 1)) + kSubBucketCount;
+    return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t valueNs) {
+    _buckets[bucketIndex(valueNs)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(valueNs, std::memory_order_relaxed);
+
+    uint64_t cur = _min.load(std::memory_order_relaxed);
+    while (valueNs < cur && !_min.compare_exchange_weak(cur, valueNs, std::memory_order_relaxed)) {}
+    cur = _max.load(std::memory_order_relaxed);
+    while (valueNs > cur && !_max.compare_exchange_weak(cur, valueNs, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    _count.store(0, std::memory_order_relaxed);
+    _sum.store(0, std::memory_order_relaxed);
+    _min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count() const {
+    return _count.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::min() const {
+    return count() ? _min.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t LatencyHistogram::max() const {
+    return _max.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::sum() const {
+    return _sum.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::percentile(double percentile) const {
+    // Buckets are summed up independently from _count to get a consistent snapshot
+    // in case the histogram is updated concurrently
+    uint64_t total = 0;
+    for (auto& bucket : _buckets)
+        total += bucket.load(std::memory_order_relaxed);
+    if (total == 0)
+        return 0;
+
+    percentile = std::min(100.0, std::max(0.0, percentile));
+    auto target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * total));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < kBucketsNum; i++) {
+        accumulated += _buckets[i].load(std::memory_order_relaxed);
+        if (accumulated >= target)
+            return std::min(bucketUpperBound(i), max());
+    }
+    return max();
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> LatencyHistogram::buckets() const {
+    std::vector<std::pair<uint64_t, uint64_t>> result;
+    for (size_t i = 0; i < kBucketsNum; i++) {
+        auto num = _buckets[i].load(std::memory_order_relaxed);
+        if (num != 0)
+            result.emplace_back(bucketUpperBound(i), num);
+    }
+    return result;
+}
+
+LatencyHistogram* NodesLatencyHistograms::get(const std::string& nodeName) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& histogram = _histograms[nodeName];
+    if (!histogram)
+        histogram.reset(new LatencyHistogram());
+    return histogram.get();
+}
+
+void NodesLatencyHistograms::reset() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (auto& histogram : _histograms)
+        histogram.second->reset();
+}
+
+std::map<std::string, std::map<std::string, float>> NodesLatencyHistograms::percentiles() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::map<std::string, std::map<std::string, float>> result;
+    for (auto& item : _histograms) {
+        const auto& histogram = *item.second;
+        auto count = histogram.count();
+        auto& summary = result[item.first];
+        summary["count"] = static_cast<float>(count);
+        summary["min"] = histogram.min() / 1000.f;
+        summary["mean"] = count ? static_cast<float>(histogram.sum()) / count / 1000.f : 0.f;
+        summary["p50"] = histogram.percentile(50) / 1000.f;
+        summary["p90"] = histogram.percentile(90) / 1000.f;
+        summary["p99"] = histogram.percentile(99) / 1000.f;
+        summary["max"] = histogram.max() / 1000.f;
+    }
+    return result;
+}
+
+std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> NodesLatencyHistograms::histograms() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> result;
+    for (auto& item : _histograms)
+        result[item.first] = item.second->buckets();
+    return result;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides a declaration of per node latency histograms
+ * @file
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Log-linear (HDR-style) histogram of latency values in nanoseconds.
+ *
+ * Values below 2^kSubBucketBits are stored with exact resolution. Every following
+ * power of two interval is split into 2^kSubBucketBits equal sub-buckets, so the
+ * relative error of any reported value is bounded by 2^-kSubBucketBits.
+ *
+ * All counters are relaxed atomics, so a single histogram may be updated
+ * concurrently from several streams without locking.
+ */
+class LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 3;
+    static constexpr int kMaxValueBits = 36;  // ~68 seconds
+    static constexpr size_t kSubBucketCount = size_t(1) << kSubBucketBits;
+    static constexpr size_t kBucketsNum = (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount;
+
+    LatencyHistogram();
+
+    void record(uint64_t valueNs);
+    void reset();
+
+    uint64_t count() const;
+    uint64_t min() const;
+    uint64_t max() const;
+    uint64_t sum() const;
+
+    /**
+     * @brief Returns upper bound of the bucket containing requested percentile
+     * @param percentile Value in range [0, 100]
+     */
+    uint64_t percentile(double percentile) const;
+
+    /** Non empty buckets as pairs of {bucket upper bound in ns, number of samples} */
+    std::vector<std::pair<uint64_t, uint64_t>> buckets() const;
+
+    static size_t bucketIndex(uint64_t valueNs);
+    static uint64_t bucketUpperBound(size_t index);
+
+private:
+    std::atomic<uint64_t> _buckets[kBucketsNum];
+    std::atomic<uint64_t> _count;
+    std::atomic<uint64_t> _sum;
+    std::atomic<uint64_t> _min;
+    std::atomic<uint64_t> _max;
+};
+
+/**
+ * @brief Collection of latency histograms per graph node.
+ *
+ * Graphs of different streams of the same executable network contain nodes with the same names,
+ * so the nodes of all streams are bound to the same histogram and results are merged on the fly.
+ *
+ * Lookup is thread safe, recording into returned histograms is lock free.
+ */
+class NodesLatencyHistograms {
+public:
+    typedef std::shared_ptr<NodesLatencyHistograms> Ptr;
+
+    LatencyHistogram* get(const std::string& nodeName);
+    void reset();
+
+    /** Per node summary: "count", "min", "mean", "p50", "p90", "p99", "max" in microseconds */
+    std::map<std::string, std::map<std::string, float>> percentiles() const;
+    /** Per node non empty buckets: {bucket upper bound in ns, number of samples} */
+    std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> histograms() const;
+
+private:
+    mutable std::mutex _mutex;
+    std::map<std::string, std::unique_ptr<LatencyHistogram>> _histograms;
+};
+
+}  // namespace MKLDNNPlugin
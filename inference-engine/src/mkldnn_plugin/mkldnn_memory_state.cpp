@@ -4,6 +4,7 @@
 
 #include "mkldnn_memory_state.h"
 #include "mkldnn_extension_utils.h"
+#include <blob_factory.hpp>
 
 using namespace InferenceEngine;
 
@@ -14,22 +15,84 @@ std::string  MKLDNNMemoryState::GetName() const {
 }
 
 void  MKLDNNMemoryState::Reset() {
+    // the blob set by the user is not modified, the state returns to own storage
+    releaseSharedState();
     storage->FillZero();
 }
 
+void MKLDNNMemoryState::releaseSharedState() {
+    storage = ownStorage;
+    sharedMemory.reset();
+    sharedState.reset();
+}
+
+bool MKLDNNMemoryState::canShare(const Blob::Ptr& newState) const {
+    auto memoryBlob = as<MemoryBlob>(newState);
+    if (!memoryBlob || memoryBlob->byteSize() != ownStorage->GetSize())
+        return false;
+
+    const auto& desc = newState->getTensorDesc();
+    auto prec = MKLDNNExtensionUtils::DataTypeToIEPrecision(ownStorage->GetDataType());
+    if (desc.getPrecision() != prec || desc.getLayout() == Layout::ANY)
+        return false;
+
+    return MKLDNNMemoryDesc(desc) == MKLDNNMemoryDesc(ownStorage->GetDescriptor());
+}
+
 void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
+    if (!canShare(newState)) {
+        CopyState(newState);
+        return;
+    }
+
+    releaseSharedState();
+    // the blob stays mapped while the state uses its memory
+    sharedMemory.reset(new LockedMemory<void>(as<MemoryBlob>(newState)->rwmap()));
+    sharedState = newState;
+    storage = std::make_shared<MKLDNNMemory>(ownStorage->GetPrimitiveDescriptor().get_engine());
+    storage->Create(ownStorage->GetDescriptor(), sharedMemory->as<void*>());
+}
+
+void MKLDNNMemoryState::CopyState(const Blob::Ptr& newState) {
     auto prec = newState->getTensorDesc().getPrecision();
     auto data_type = MKLDNNExtensionUtils::IEPrecisionToDataType(prec);
     auto data_layout = MKLDNNMemory::Convert(newState->getTensorDesc().getLayout());
     auto data_ptr = newState->cbuffer().as<void*>();
     auto data_size = newState->byteSize();
 
+    releaseSharedState();
     storage->SetData(data_type, data_layout, data_ptr, data_size);
 }
 
 InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
-    THROW_IE_EXCEPTION << "GetLastState method is not implemented for MemoryState";
-    return nullptr;
+    if (sharedState)
+        return sharedState;
+
+    TensorDesc desc = MKLDNNMemoryDesc(storage->GetDescriptor());
+    return make_blob_with_precision(desc, storage->GetData());
+}
+
+std::string MKLDNNNetworkMemoryState::GetName() const {
+    return name;
+}
+
+void MKLDNNNetworkMemoryState::Reset() {
+    for (auto& state : requestsStates())
+        state->Reset();
+}
+
+void MKLDNNNetworkMemoryState::SetState(Blob::Ptr newState) {
+    // states of different requests cannot share the same blob
+    for (auto& state : requestsStates())
+        state->CopyState(newState);
+}
+
+InferenceEngine::Blob::CPtr MKLDNNNetworkMemoryState::GetLastState() const {
+    auto states = requestsStates();
+    if (states.size() != 1)
+        THROW_IE_EXCEPTION << "GetLastState method of executable network state is available only if a single "
+                              "infer request is created, use InferRequest::QueryState instead";
+    return states.front()->GetLastState();
 }
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -7,23 +7,73 @@
 #include "cpp_interfaces/impl/ie_memory_state_internal.hpp"
 #include "mkldnn_memory.h"
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief State of a MemoryInput node owned by an infer request. It is bound to the graph
+ * of the stream which executes the request right before inference.
+ */
 class MKLDNNMemoryState : public InferenceEngine::IMemoryStateInternal {
 public:
+    typedef std::shared_ptr<MKLDNNMemoryState> Ptr;
+
     MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name), storage(storage) {}
+            name(name), ownStorage(storage), storage(storage) {}
 
     std::string GetName() const override;
     void Reset() override;
+    /**
+     * @brief Blob with the same layout as the state is used as the state storage without copying,
+     * so following inferences update the blob in place. Other blobs are copied into own storage.
+     */
     void SetState(InferenceEngine::Blob::Ptr newState) override;
+    /**
+     * @brief Returns a blob which shares memory with the state storage. It is updated by following inferences.
+     */
     InferenceEngine::Blob::CPtr GetLastState() const override;
 
+    /** Copies data of the blob into own storage of the state */
+    void CopyState(const InferenceEngine::Blob::Ptr& newState);
+
+    const MKLDNNMemoryPtr& GetStorage() const {
+        return storage;
+    }
+
 private:
+    bool canShare(const InferenceEngine::Blob::Ptr& newState) const;
+    void releaseSharedState();
+
     std::string name;
+    MKLDNNMemoryPtr ownStorage;
     MKLDNNMemoryPtr storage;
+    InferenceEngine::Blob::Ptr sharedState;
+    std::unique_ptr<InferenceEngine::LockedMemory<void>> sharedMemory;
+};
+
+/**
+ * @brief State of the executable network. Changes are applied to the states with the same name
+ * of all infer requests created by the network.
+ */
+class MKLDNNNetworkMemoryState : public InferenceEngine::IMemoryStateInternal {
+public:
+    using RequestsStates = std::function<std::vector<MKLDNNMemoryState::Ptr>()>;
+
+    MKLDNNNetworkMemoryState(std::string name, RequestsStates requestsStates) :
+            name(name), requestsStates(requestsStates) {}
+
+    std::string GetName() const override;
+    void Reset() override;
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+private:
+    std::string name;
+    RequestsStates requestsStates;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -42,6 +42,7 @@
 #include <nodes/mkldnn_mvn_node.h>
 #include <nodes/mkldnn_resample_node.h>
 #include <nodes/mkldnn_normalize_node.h>
+#include <nodes/mkldnn_embedding_bag_node.h>
 #include <nodes/mkldnn_tensoriterator_node.h>
 #include <mkldnn_types.h>
 #include "mkldnn_extension_utils.h"
@@ -115,6 +116,19 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "MVN", MVN},
         { "Resample", Resample},
         { "Normalize", Normalize},
+        { "EmbeddingBag", EmbeddingBag},
+        { "ReduceAnd", Reduce},
+        { "ReduceL1", Reduce},
+        { "ReduceL2", Reduce},
+        { "ReduceLogSum", Reduce},
+        { "ReduceLogSumExp", Reduce},
+        { "ReduceMax", Reduce},
+        { "ReduceMean", Reduce},
+        { "ReduceMin", Reduce},
+        { "ReduceOr", Reduce},
+        { "ReduceProd", Reduce},
+        { "ReduceSum", Reduce},
+        { "ReduceSumSquare", Reduce},
 };
 
 Type TypeFromName(const std::string type) {
@@ -406,6 +420,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(jit);
     SEARCH_TYPE(gemm);
     SEARCH_TYPE(ref);
+    SEARCH_TYPE(sparse);
 
     SEARCH_TYPE(avx512);
     SEARCH_TYPE(avx2);
@@ -506,7 +521,7 @@ std::vector<memory::format> MKLDNNNode::getAvailableFormatsForDims(const MKLDNND
 
 void MKLDNNNode::execute(mkldnn::stream strm) {
     if (prim) {
-        strm.submit({*prim});
+        prim.submit(strm);
     }
 }
 
@@ -75,7 +75,9 @@ enum Type {
     Convert,
     MVN,
     Resample,
-    Normalize
+    Normalize,
+    EmbeddingBag,
+    Reduce
 };
 
 Type TypeFromName(const std::string type);
@@ -158,6 +160,10 @@ static std::string NameFromType(Type type) {
             return "Resample";
         case Normalize:
             return "Normalize";
+        case EmbeddingBag:
+            return "EmbeddingBag";
+        case Reduce:
+            return "Reduce";
         default:
             return "Unknown";
     }
@@ -333,6 +339,14 @@ public:
 
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
+
+    /**
+     * @brief Returns false if execute() does nothing for the node (e.g. in-place optimized nodes).
+     * Such nodes are excluded from the graph execution plan.
+     */
+    virtual bool isExecutable() const {
+        return true;
+    }
     virtual void initSupportedPrimitiveDescriptors();
 
     /**
@@ -6,6 +6,8 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_jit_kernel_cache.hpp"
+#include "mkldnn_streams_autotuner.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -13,6 +15,7 @@
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
+#include <ie_compile_profiler.hpp>
 #include <generic_ie.hpp>
 #include <nodes/list.hpp>
 
@@ -78,7 +81,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
+    std::shared_ptr<ICNNNetwork> clonedNetwork;
+    {
+        IE_COMPILE_PHASE("CloneNetwork");
+        clonedNetwork = cloneNetwork(network);
+    }
 
     if (clonedNetwork->getFunction()) {
         const auto transformations_callback = [](const std::shared_ptr<const ::ngraph::Node> &node) -> bool {
@@ -92,26 +99,62 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         ::ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
 
         // Note: instead of running all Conversion Transformations you can make up your own transformation pipeline
-        ngraph::pass::CommonOptimizations().run_on_function(nGraphFunc);
-        ngraph::pass::ConvertOpSet3ToOpSet2(transformations_callback).run_on_function(nGraphFunc);
-        ngraph::pass::ConvertOpSet2ToOpSet1(transformations_callback).run_on_function(nGraphFunc);
-        ngraph::pass::ConvertOpSet1ToLegacy(transformations_callback).run_on_function(nGraphFunc);
+        {
+            IE_COMPILE_PHASE("CommonOptimizations");
+            ngraph::pass::CommonOptimizations().run_on_function(nGraphFunc);
+        }
+        {
+            IE_COMPILE_PHASE("ConvertOpSet3ToOpSet2");
+            ngraph::pass::ConvertOpSet3ToOpSet2(transformations_callback).run_on_function(nGraphFunc);
+        }
+        {
+            IE_COMPILE_PHASE("ConvertOpSet2ToOpSet1");
+            ngraph::pass::ConvertOpSet2ToOpSet1(transformations_callback).run_on_function(nGraphFunc);
+        }
+        {
+            IE_COMPILE_PHASE("ConvertOpSet1ToLegacy");
+            ngraph::pass::ConvertOpSet1ToLegacy(transformations_callback).run_on_function(nGraphFunc);
+        }
+        IE_COMPILE_PHASE("ConvertFunctionToICNNNetwork");
         clonedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, *clonedNetwork);
     }
 
     auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
     if (implNetwork) {
+        IE_COMPILE_PHASE("ConstTransformer");
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
     }
 
+    if (conf.streamsAutotune && !conf.exclusiveAsyncRequests) {
+        MKLDNNStreamsAutotuner::Result tuned;
+        {
+            IE_COMPILE_PHASE("StreamsAutotune");
+            tuned = MKLDNNStreamsAutotuner::tune(*clonedNetwork, conf,
+                                                 GetMetric(METRIC_KEY(FULL_DEVICE_NAME), {}).as<std::string>(),
+                                                 extensionManager, weightsSharing);
+        }
+        conf.streamExecutorConfig._streams = tuned.streams;
+        conf.streamExecutorConfig._threads = tuned.threads;
+        conf._config.clear();
+        conf.updateProperties();
+
+        std::map<int, std::pair<float, float>> results;
+        for (auto &&measurement : tuned.measurements)
+            results[measurement.first] = {measurement.second.throughput, measurement.second.latency};
+        auto execNetwork = std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+        execNetwork->setStreamsAutotuneResults(results);
+        return execNetwork;
+    }
+
     return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    MKLDNNJitKernelCache::instance().setCapacity(engConfig.jitKernelCacheCapacity);
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -149,6 +192,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(CPU_JIT_KERNEL_CACHE_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -193,6 +237,16 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(CPU_JIT_KERNEL_CACHE_STATISTICS)) {
+        const auto statistics = MKLDNNJitKernelCache::instance().getStatistics();
+        std::map<std::string, uint64_t> counters = {
+            {"HITS", statistics.hits},
+            {"MISSES", statistics.misses},
+            {"EVICTIONS", statistics.evictions},
+            {"KERNELS", statistics.kernels},
+            {"CODE_SIZE", statistics.codeSize},
+        };
+        IE_SET_METRIC_RETURN(CPU_JIT_KERNEL_CACHE_STATISTICS, counters);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -29,6 +29,28 @@ MKLDNNPrimitive &MKLDNNPrimitive::operator=(const std::shared_ptr<mkldnn::primit
     return *this;
 }
 
+static void submitToStream(mkldnn::stream& strm, size_t count, mkldnn_primitive_t* primitives) {
+    mkldnn_primitive_t errorPrimitive = nullptr;
+    auto status = mkldnn_stream_submit(strm.get(), count, primitives, &errorPrimitive);
+    // the message is built only on failure to keep submission free of allocations
+    if (status != mkldnn_success)
+        mkldnn::error::wrap_c_api(status, "could not submit primitives to a stream", &errorPrimitive);
+}
+
+void MKLDNNPrimitive::submit(mkldnn::stream& strm, const std::vector<mkldnn_primitive_t>& primitives) {
+    if (!primitives.empty())
+        submitToStream(strm, primitives.size(), const_cast<mkldnn_primitive_t*>(primitives.data()));
+}
+
+void MKLDNNPrimitive::submit(mkldnn::stream& strm, const mkldnn::primitive& primitive) {
+    mkldnn_primitive_t handle = primitive.get();
+    submitToStream(strm, 1, &handle);
+}
+
+void MKLDNNPrimitive::submit(mkldnn::stream& strm) {
+    submit(strm, *prim);
+}
+
 void MKLDNNPrimitive::setBatchLimit(int batch, size_t inputNum, size_t outputNum) {
     bool success = true;
     auto * primDesc = prim->get_primitive_desc();
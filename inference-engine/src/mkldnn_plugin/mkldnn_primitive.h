@@ -23,6 +23,14 @@ public:
     void reset(mkldnn::primitive* prim);
     void setBatchLimit(int batch, size_t inputNum, size_t outputNum);
 
+    /**
+     * Submits primitives to the stream. Unlike mkldnn::stream::submit() it does not copy
+     * primitives into temporary lists, so a prepared list can be submitted on every inference.
+     */
+    static void submit(mkldnn::stream& strm, const std::vector<mkldnn_primitive_t>& primitives);
+    static void submit(mkldnn::stream& strm, const mkldnn::primitive& primitive);
+    void submit(mkldnn::stream& strm);
+
 private:
     std::shared_ptr<mkldnn::primitive> prim;
     std::vector<int> originInputBatches;
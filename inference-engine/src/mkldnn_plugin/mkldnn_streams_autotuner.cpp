@@ -0,0 +1,235 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_streams_autotuner.h"
+#include "mkldnn_exec_network.h"
+
+#include <details/ie_cnn_network_tools.h>
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// time every candidate runs after the warm-up inference of each request
+constexpr auto kMeasureTime = std::chrono::milliseconds(200);
+constexpr size_t kMinIterations = 2;
+
+std::mutex& cacheMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::string, MKLDNNStreamsAutotuner::Result>& cache() {
+    static std::map<std::string, MKLDNNStreamsAutotuner::Result> results;
+    return results;
+}
+
+// the same number of threads the executable network splits between streams in the throughput mode
+int throughputThreads(const Config &cfg) {
+    if (cfg.streamExecutorConfig._threads)
+        return cfg.streamExecutorConfig._threads;
+    const int envThreads = parallel_get_env_threads();
+    if (envThreads)
+        return envThreads;
+    return getAvailableNUMANodes().size() == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+}
+
+void fillBlob(const Blob::Ptr &blob) {
+    auto data = blob->buffer().as<uint8_t*>();
+    if (blob->getTensorDesc().getPrecision() == Precision::FP32) {
+        auto values = reinterpret_cast<float*>(data);
+        for (size_t i = 0; i < blob->size(); i++)
+            values[i] = static_cast<float>(i % 255) / 255.f;
+    } else {
+        // zeros are valid for the index-like integer inputs as well
+        std::fill(data, data + blob->byteSize(), 0);
+    }
+}
+
+void infer(const IInferRequest::Ptr &request) {
+    ResponseDesc resp;
+    StatusCode sts = request->StartAsync(&resp);
+    if (OK == sts)
+        sts = request->Wait(IInferRequest::WaitMode::RESULT_READY, &resp);
+    if (OK != sts)
+        THROW_IE_EXCEPTION << "Streams autotuning failed to run the network: " << resp.msg;
+}
+
+MKLDNNStreamsAutotuner::Measurement measure(MKLDNNExecNetwork &network, int streams) {
+    std::vector<IInferRequest::Ptr> requests(streams);
+    for (auto &&request : requests) {
+        network.CreateInferRequest(request);
+        for (auto &&input : network.GetInputsInfo()) {
+            Blob::Ptr blob;
+            ResponseDesc resp;
+            if (OK != request->GetBlob(input.first.c_str(), blob, &resp))
+                THROW_IE_EXCEPTION << "Streams autotuning failed to get an input blob: " << resp.msg;
+            fillBlob(blob);
+        }
+        // the first inference creates the graph of the stream, so it is not measured
+        infer(request);
+    }
+
+    std::vector<std::vector<float>> latencies(streams);
+    std::vector<std::exception_ptr> errors(streams);
+    std::vector<std::thread> threads;
+    const auto start = Clock::now();
+    const auto deadline = start + kMeasureTime;
+    for (int i = 0; i < streams; i++) {
+        threads.emplace_back([&, i] {
+            try {
+                auto now = Clock::now();
+                while (now < deadline || latencies[i].size() < kMinIterations) {
+                    const auto begin = now;
+                    infer(requests[i]);
+                    now = Clock::now();
+                    latencies[i].push_back(std::chrono::duration<float, std::milli>(now - begin).count());
+                }
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto &&thread : threads)
+        thread.join();
+    const auto elapsed = std::chrono::duration<float>(Clock::now() - start).count();
+    for (auto &&error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::vector<float> all;
+    for (auto &&requestLatencies : latencies)
+        all.insert(all.end(), requestLatencies.begin(), requestLatencies.end());
+    auto median = all.begin() + all.size() / 2;
+    std::nth_element(all.begin(), median, all.end());
+
+    MKLDNNStreamsAutotuner::Measurement measurement;
+    measurement.throughput = all.size() / elapsed;
+    measurement.latency = *median;
+    return measurement;
+}
+
+}  // namespace
+
+MKLDNNStreamsAutotuner::Result MKLDNNStreamsAutotuner::tune(const ICNNNetwork &network, const Config &cfg,
+                                                            const std::string &cpuName,
+                                                            const MKLDNNExtensionManager::Ptr &extMgr,
+                                                            NumaNodesWeights &weightsSharing) {
+    const int threads = throughputThreads(cfg);
+    std::stringstream key;
+    key << std::hex << hashNetwork(network) << std::dec << ';' << cpuName << ';' << threads
+        << ';' << static_cast<int>(cfg.streamExecutorConfig._threadBindingType) << ';' << cfg.streamsAutotuneMaxLatency
+        << ';' << cfg.enforceBF16 << ';' << static_cast<int>(cfg.lpTransformsMode);
+
+    // the candidates of concurrent loads would compete for the cores, so they are measured one by one
+    std::lock_guard<std::mutex> lock{cacheMutex()};
+    auto cached = cache().find(key.str());
+    if (cached != cache().end())
+        return cached->second;
+
+    Config tuningCfg = cfg;
+    tuningCfg.streamsAutotune = false;
+    tuningCfg.sharedExecutor = false;
+    tuningCfg.collectPerfCounters = false;
+    tuningCfg.collectLatencyHistograms = false;
+    tuningCfg.dumpToDot = "";
+    tuningCfg.streamExecutorConfig._threads = threads;
+
+    Result result;
+    result.threads = threads;
+    for (auto streams : candidateStreams(threads)) {
+        tuningCfg.streamExecutorConfig._streams = streams;
+        tuningCfg._config.clear();
+        tuningCfg.updateProperties();
+        auto execNetwork = std::make_shared<MKLDNNExecNetwork>(network, tuningCfg, extMgr, weightsSharing);
+        result.measurements[streams] = measure(*execNetwork, streams);
+    }
+    result.streams = selectStreams(result.measurements, static_cast<float>(cfg.streamsAutotuneMaxLatency));
+
+    cache()[key.str()] = result;
+    return result;
+}
+
+std::vector<int> MKLDNNStreamsAutotuner::candidateStreams(int threads) {
+    std::vector<int> candidates;
+    for (int streams = 1; streams <= threads; streams++) {
+        const bool isPowerOfTwo = 0 == (streams & (streams - 1));
+        if (0 == threads % streams || isPowerOfTwo)
+            candidates.push_back(streams);
+    }
+    if (candidates.empty())
+        candidates.push_back(1);
+    return candidates;
+}
+
+int MKLDNNStreamsAutotuner::selectStreams(const std::map<int, Measurement> &measurements, float maxLatency) {
+    if (measurements.empty())
+        THROW_IE_EXCEPTION << "Streams autotuning has no measurements to select from";
+
+    auto best = measurements.end();
+    for (auto it = measurements.begin(); it != measurements.end(); ++it) {
+        if (maxLatency > 0.f && it->second.latency > maxLatency)
+            continue;
+        if (best == measurements.end() || it->second.throughput > best->second.throughput)
+            best = it;
+    }
+    if (best == measurements.end()) {
+        best = std::min_element(measurements.begin(), measurements.end(),
+                                [](const std::pair<const int, Measurement> &a, const std::pair<const int, Measurement> &b) {
+                                    return a.second.latency < b.second.latency;
+                                });
+    }
+    return best->first;
+}
+
+uint64_t MKLDNNStreamsAutotuner::hashNetwork(const ICNNNetwork &network) {
+    const auto &crc = MKLDNNWeightsSharing::GetHashFunc();
+    std::stringstream description;
+    std::vector<uint64_t> blobHashes;
+    for (auto &&layer : CNNNetSortTopologically(network)) {
+        description << layer->type << '|' << layer->name << '|' << layer->precision.name() << '|';
+        for (auto &&param : layer->params)
+            description << param.first << '=' << param.second << ',';
+        for (auto &&data : layer->outData) {
+            description << data->getPrecision().name() << '[';
+            for (auto dim : data->getTensorDesc().getDims())
+                description << dim << ',';
+            description << ']';
+        }
+        for (auto &&blob : layer->blobs) {
+            description << blob.first << ',';
+            if (blob.second)
+                blobHashes.push_back(crc.hash(blob.second->cbuffer().as<const unsigned char*>(), blob.second->byteSize()));
+        }
+        description << '\n';
+    }
+
+    const auto text = description.str();
+    uint64_t hash = crc.hash(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+    if (!blobHashes.empty()) {
+        blobHashes.push_back(hash);
+        hash = crc.hash(reinterpret_cast<const unsigned char*>(blobHashes.data()), blobHashes.size() * sizeof(uint64_t));
+    }
+    return hash;
+}
+
+void MKLDNNStreamsAutotuner::clearCache() {
+    std::lock_guard<std::mutex> lock{cacheMutex()};
+    cache().clear();
+}
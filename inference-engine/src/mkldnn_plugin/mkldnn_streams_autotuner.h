@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_icnn_network.hpp>
+
+#include "config.h"
+#include "mkldnn_extension_mngr.h"
+#include "mkldnn_weights_cache.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Chooses the number of streams for the throughput mode by running the network with synthetic
+ * inputs for every candidate number of streams. The decision is cached per model and CPU, so
+ * the following loads of the same network skip the measurements.
+ */
+class MKLDNNStreamsAutotuner {
+public:
+    struct Measurement {
+        float throughput = 0.f;  // inferences per second
+        float latency = 0.f;     // median latency of a single inference in milliseconds
+    };
+
+    struct Result {
+        int streams = 1;
+        int threads = 0;  // threads the streams were measured with, the network must be loaded with the same number
+        std::map<int, Measurement> measurements;
+    };
+
+    static Result tune(const InferenceEngine::ICNNNetwork &network, const Config &cfg, const std::string &cpuName,
+                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+
+    // divisors of the threads number together with the powers of two
+    static std::vector<int> candidateStreams(int threads);
+
+    // the highest throughput within the latency limit (0 means no limit) or the lowest latency if none fits
+    static int selectStreams(const std::map<int, Measurement> &measurements, float maxLatency);
+
+    static uint64_t hashNetwork(const InferenceEngine::ICNNNetwork &network);
+
+    static void clearCache();
+};
+
+}  // namespace MKLDNNPlugin
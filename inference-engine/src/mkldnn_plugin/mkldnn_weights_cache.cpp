@@ -11,9 +11,24 @@ namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+void MKLDNNWeightsSharing::placeOnNumaNodes(const MKLDNNMemoryPtr& ptr) const {
+    // first touch by a thread of the stream does not guarantee placement, so pages are moved explicitly
+    if (!numaNodes.empty() && ptr && ptr->GetPrimitivePtr())
+        InferenceEngine::moveMemoryToNUMANodes(ptr->GetData(), ptr->GetSize(), numaNodes);
+}
+
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+    auto numa_nodes = InferenceEngine::getAvailableNUMANodes();
+    // there is nothing to move on single node systems
+    const bool multi_numa = numa_nodes.size() > 1;
+    for (auto numa_id : numa_nodes)
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(
+                multi_numa ? std::vector<int>{numa_id} : std::vector<int>{});
+    _interleaved = std::make_shared<MKLDNNWeightsSharing>(multi_numa ? numa_nodes : std::vector<int>{});
+}
+
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::interleaved() {
+    return _interleaved;
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
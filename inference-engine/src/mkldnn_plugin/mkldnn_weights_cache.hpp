@@ -12,6 +12,8 @@
 #include <memory>
 #include <mutex>
 #include <map>
+#include <utility>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -54,6 +56,13 @@ protected:
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
+
+    /**
+     * @param numaNodes NUMA nodes the created memory is moved to: a single node binds the memory
+     *        to the node, several nodes interleave memory pages. Memory is left as is if empty.
+     */
+    explicit MKLDNNWeightsSharing(std::vector<int> numaNodes = {}) : numaNodes(std::move(numaNodes)) {}
+
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
         std::unique_lock<std::mutex> lock(guard);
@@ -62,15 +71,21 @@ public:
         MKLDNNMemoryPtr ptr;
         if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
             ptr = create();
+            placeOnNumaNodes(ptr);
             sharedWeights[name_hash] = ptr;
         }
         return ptr;
     }
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    const std::vector<int>& GetNumaNodes() const { return numaNodes; }
+
 protected:
+    void placeOnNumaNodes(const MKLDNNMemoryPtr& ptr) const;
+
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
     std::mutex guard;
+    std::vector<int> numaNodes;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -86,8 +101,12 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /** Single store which interleaves weights over all NUMA nodes */
+    MKLDNNWeightsSharing::Ptr& interleaved();
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    MKLDNNWeightsSharing::Ptr _interleaved;
 };
 
 }  // namespace MKLDNNPlugin
@@ -10,6 +10,9 @@
 #include <cassert>
 #include "ie_parallel.hpp"
 #include "common/simple_copy.h"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -46,6 +49,15 @@ public:
             config.outConfs.push_back(outConfig);
             config.dynBatchSupport = false;
             confs.push_back(config);
+
+            // Channel blocks are copied as a whole while the channels themselves are not broadcast
+            if ((data_dims.size() == 4 || data_dims.size() == 5) && data_dims.size() == out_dims.size() &&
+                    data_dims[1] == out_dims[1] &&
+                    layer->insData[BROADCAST_INPUT].lock()->getTensorDesc().getPrecision() == dataPrecision) {
+                ConfLayout blk_layout = mayiuse(avx512_common) ? ConfLayout::BLK16 : ConfLayout::BLK8;
+                addConfig(layer, { DataConfigurator(blk_layout), DataConfigurator(ConfLayout::PLN) },
+                          { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -79,6 +91,12 @@ public:
             return PARAMETER_MISMATCH;
         }
 
+        // The blocked tensor is broadcast as a planar one with the channel block as an extra innermost dimension
+        if (outputs[0]->getTensorDesc().getLayout() == Layout::BLOCKED) {
+            dst_dims = outputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+            src_dims = inputs[BROADCAST_INPUT]->getTensorDesc().getBlockingDesc().getBlockDims();
+        }
+
         InferenceEngine::SizeVector dstStrides = outputs[0]->getTensorDesc().getBlockingDesc().getStrides();
         InferenceEngine::SizeVector src_aligned(dst_dims.size());
         InferenceEngine::SizeVector srcStrides_aligned(dst_dims.size());
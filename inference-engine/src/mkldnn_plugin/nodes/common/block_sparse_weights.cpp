@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "block_sparse_weights.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+constexpr size_t BlockSparseWeights::kBlockSize;
+constexpr size_t BlockSparseWeights::kAlignment;
+
+size_t BlockSparseWeights::pack(const float* weights, size_t outputs, size_t inputs, void* packed) {
+    const size_t blocks = (outputs + kBlockSize - 1) / kBlockSize;
+    auto isColumnUsed = [&](size_t block, size_t input) {
+        for (size_t o = block * kBlockSize; o < std::min(outputs, (block + 1) * kBlockSize); o++) {
+            if (weights[o * inputs + input] != 0.f)
+                return true;
+        }
+        return false;
+    };
+
+    std::vector<int32_t> offsets(blocks + 1, 0);
+    for (size_t block = 0; block < blocks; block++) {
+        int32_t columns = 0;
+        for (size_t i = 0; i < inputs; i++)
+            columns += isColumnUsed(block, i) ? 1 : 0;
+        offsets[block + 1] = offsets[block] + columns;
+    }
+
+    const size_t columns = offsets[blocks];
+    const size_t size = valuesOffset(blocks, columns) + columns * kBlockSize * sizeof(float);
+    if (packed == nullptr)
+        return size;
+
+    std::memset(packed, 0, size);
+    std::memcpy(packed, offsets.data(), offsets.size() * sizeof(int32_t));
+    BlockSparseWeights layout(packed, outputs);
+    auto indices = const_cast<int32_t*>(layout.indices);
+    auto values = const_cast<float*>(layout.values);
+    for (size_t block = 0; block < blocks; block++) {
+        size_t column = offsets[block];
+        for (size_t i = 0; i < inputs; i++) {
+            if (!isColumnUsed(block, i))
+                continue;
+            indices[column] = static_cast<int32_t>(i);
+            for (size_t o = block * kBlockSize; o < std::min(outputs, (block + 1) * kBlockSize); o++)
+                values[column * kBlockSize + o - block * kBlockSize] = weights[o * inputs + i];
+            column++;
+        }
+    }
+    return size;
+}
+
+float BlockSparseWeights::density(const float* weights, size_t size) {
+    if (size == 0)
+        return 0.f;
+    const size_t nonZeros = size - std::count(weights, weights + size, 0.f);
+    return static_cast<float>(nonZeros) / size;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Block-CSR layout of sparse FP32 weights [outputs x inputs] of a fully connected layer.
+ *
+ * Output channels are split into blocks of kBlockSize rows. A block keeps the inputs which have a non-zero weight
+ * in any of its rows and kBlockSize weights of the rows for each of them, so a product is computed by vector
+ * multiply-adds of the weights column with a broadcasted input value. Rows of the last block beyond the number of
+ * outputs are zeros. The packed buffer holds:
+ *   int32_t offsets[blocks + 1]     - ranges of columns of the blocks
+ *   int32_t indices[columns]        - input index of every column
+ *   float   values[columns][kBlockSize] - aligned to kAlignment bytes
+ */
+struct BlockSparseWeights {
+    static constexpr size_t kBlockSize = 16;
+    static constexpr size_t kAlignment = 64;
+
+    BlockSparseWeights(const void* packed, size_t outputs)
+        : blocks((outputs + kBlockSize - 1) / kBlockSize),
+          offsets(static_cast<const int32_t*>(packed)),
+          indices(offsets + blocks + 1),
+          values(reinterpret_cast<const float*>(static_cast<const uint8_t*>(packed) +
+                                                valuesOffset(blocks, offsets[blocks]))) {}
+
+    /**
+     * Packs dense row-major weights
+     * @param packed A buffer of the size returned by the call with nullptr
+     * @return Size of the packed weights in bytes
+     */
+    static size_t pack(const float* weights, size_t outputs, size_t inputs, void* packed);
+
+    /** Share of non-zero values */
+    static float density(const float* weights, size_t size);
+
+    static size_t valuesOffset(size_t blocks, size_t columns) {
+        const size_t size = (blocks + 1 + columns) * sizeof(int32_t);
+        return (size + kAlignment - 1) / kAlignment * kAlignment;
+    }
+
+    size_t blocks;
+    const int32_t* offsets;
+    const int32_t* indices;
+    const float* values;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,283 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * CTC prefix beam search over probabilities [T, N, C] with optional sequence indicators [T, N].
+ * The last class is blank as in CTCGreedyDecoder. Output 0 holds top_paths decoded sequences [N, top_paths, T]
+ * padded with -1, optional output 1 holds their log probabilities [N, top_paths].
+ */
+class CTCBeamSearchDecoderImpl: public ExtLayerBase {
+public:
+    explicit CTCBeamSearchDecoderImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.empty() || layer->insData.size() > 2)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges!";
+            if (layer->outData.empty() || layer->outData.size() > 2)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of output edges!";
+
+            const SizeVector& probs_dims = layer->insData[0].lock()->getTensorDesc().getDims();
+            if (probs_dims.size() != 3)
+                THROW_IE_EXCEPTION << layer->name << " Probabilities should be 3 dimension tensor [T, N, C]";
+            T = probs_dims[0];
+            N = probs_dims[1];
+            C = probs_dims[2];
+            if (C < 2)
+                THROW_IE_EXCEPTION << layer->name << " Probabilities should contain at least one class and blank";
+
+            beam_width = layer->GetParamAsUInt("beam_width", 10);
+            top_paths = layer->GetParamAsUInt("top_paths", 1);
+            if (beam_width == 0 || top_paths == 0 || top_paths > beam_width)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect beam_width or top_paths: top_paths should be in [1, beam_width]";
+
+            const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
+            if (out_dims.size() != 3 || out_dims[0] != N || out_dims[1] != top_paths || out_dims[2] != T)
+                THROW_IE_EXCEPTION << layer->name << " Output sequences should have [N, top_paths, T] shape";
+            if (layer->outData.size() == 2) {
+                const SizeVector& prob_dims = layer->outData[1]->getTensorDesc().getDims();
+                if (prob_dims.size() != 2 || prob_dims[0] != N || prob_dims[1] != top_paths)
+                    THROW_IE_EXCEPTION << layer->name << " Output log probabilities should have [N, top_paths] shape";
+            }
+
+            // execute() is noexcept, so all storage is allocated here
+            workspaces.resize(parallel_get_max_threads());
+            for (auto& workspace : workspaces)
+                workspace.init(beam_width, T, C);
+
+            std::vector<DataConfigurator> inps(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            std::vector<DataConfigurator> outs(layer->outData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, inps, outs);
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const float* probabilities = inputs[0]->cbuffer().as<const float*>() +
+            inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float* sequence_indicators = nullptr;
+        if (inputs.size() > 1)
+            sequence_indicators = inputs[1]->cbuffer().as<const float*>() +
+                inputs[1]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        float* output_sequences = outputs[0]->buffer().as<float*>() +
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        float* output_probs = nullptr;
+        if (outputs.size() > 1)
+            output_probs = outputs[1]->buffer().as<float*>() +
+                outputs[1]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        // workspaces are created for all threads of the process, a stream never has more of them
+        const int threads_num = std::min(parallel_get_max_threads(), static_cast<int>(workspaces.size()));
+
+        parallel_nt(threads_num, [&](const int ithr, const int nthr) {
+            Workspace& workspace = workspaces[ithr];
+            for_1d(ithr, nthr, N, [&](size_t n) {
+                size_t seq_len = 0;
+                while (seq_len < T && (!sequence_indicators || seq_len == 0 || sequence_indicators[seq_len * N + n] != 0))
+                    seq_len++;
+
+                decode(probabilities + n * C, seq_len, workspace);
+                writePaths(workspace, output_sequences + n * top_paths * T,
+                           output_probs ? output_probs + n * top_paths : nullptr);
+            });
+        });
+        return OK;
+    }
+
+private:
+    // Prefixes are kept in a tree, so every prefix is represented by a single node
+    struct PrefixNode {
+        int parent;
+        int label;
+        int first_child;
+        int next_sibling;
+    };
+
+    struct Beam {
+        int node;
+        float log_pb;   // probability of the prefix ending with blank
+        float log_pnb;  // probability of the prefix ending with its last label
+    };
+
+    // All storage of a decoding is allocated once per thread: the prefix tree has at most
+    // beam_width new nodes per timestep, candidates are beam_width * C extensions and stays.
+    struct Workspace {
+        std::vector<PrefixNode> nodes;
+        size_t nodes_num = 0;
+        std::vector<int> beam_of_node;
+        std::vector<Beam> beams, next_beams;
+        size_t beams_num = 0;
+        std::vector<float> log_probs;
+        std::vector<float> cand_pb, cand_pnb;
+        std::vector<int> cand_order;
+
+        void init(size_t beam_width, size_t T, size_t C) {
+            nodes.resize(beam_width * T + 1);
+            beam_of_node.assign(nodes.size(), -1);
+            beams.resize(beam_width);
+            next_beams.resize(beam_width);
+            log_probs.resize(C);
+            cand_pb.resize(beam_width * C);
+            cand_pnb.resize(beam_width * C);
+            cand_order.resize(beam_width * C);
+        }
+    };
+
+    static float logSumExp(float a, float b) {
+        if (a == -std::numeric_limits<float>::infinity())
+            return b;
+        if (b == -std::numeric_limits<float>::infinity())
+            return a;
+        return a > b ? a + std::log1p(std::exp(b - a)) : b + std::log1p(std::exp(a - b));
+    }
+
+    void decode(const float* probs, size_t seq_len, Workspace& ws) const {
+        const float neg_inf = -std::numeric_limits<float>::infinity();
+        const size_t blank = C - 1;
+
+        ws.nodes[0] = {-1, -1, -1, -1};
+        ws.nodes_num = 1;
+        ws.beams[0] = {0, 0.f, neg_inf};
+        ws.beams_num = 1;
+
+        for (size_t t = 0; t < seq_len; t++, probs += N * C) {
+            for (size_t c = 0; c < C; c++)
+                ws.log_probs[c] = std::log(probs[c]);
+
+            const size_t cands_num = ws.beams_num * C;
+            std::fill_n(ws.cand_pb.begin(), cands_num, neg_inf);
+            std::fill_n(ws.cand_pnb.begin(), cands_num, neg_inf);
+
+            // candidate b * C + blank keeps the prefix of beam b, b * C + c extends it with label c
+            for (size_t b = 0; b < ws.beams_num; b++) {
+                const Beam& beam = ws.beams[b];
+                const int last = ws.nodes[beam.node].label;
+                const float log_total = logSumExp(beam.log_pb, beam.log_pnb);
+                float* pb = &ws.cand_pb[b * C];
+                float* pnb = &ws.cand_pnb[b * C];
+
+                pb[blank] = log_total + ws.log_probs[blank];
+                if (last >= 0)
+                    pnb[blank] = beam.log_pnb + ws.log_probs[last];
+                for (size_t c = 0; c < blank; c++)
+                    pnb[c] = (static_cast<int>(c) == last ? beam.log_pb : log_total) + ws.log_probs[c];
+            }
+
+            // an extension which equals to the prefix of another beam is merged into the stay of that beam
+            for (size_t b = 0; b < ws.beams_num; b++)
+                ws.beam_of_node[ws.beams[b].node] = static_cast<int>(b);
+            for (size_t b = 0; b < ws.beams_num; b++) {
+                const PrefixNode& node = ws.nodes[ws.beams[b].node];
+                if (node.parent < 0 || ws.beam_of_node[node.parent] < 0)
+                    continue;
+                float& extension = ws.cand_pnb[ws.beam_of_node[node.parent] * C + node.label];
+                ws.cand_pnb[b * C + blank] = logSumExp(ws.cand_pnb[b * C + blank], extension);
+                extension = neg_inf;
+            }
+            for (size_t b = 0; b < ws.beams_num; b++)
+                ws.beam_of_node[ws.beams[b].node] = -1;
+
+            const size_t next_num = std::min(beam_width, cands_num);
+            selectCandidates(ws, cands_num, next_num);
+
+            size_t beams_num = 0;
+            for (size_t i = 0; i < next_num; i++) {
+                const int cand = ws.cand_order[i];
+                if (logSumExp(ws.cand_pb[cand], ws.cand_pnb[cand]) == neg_inf)
+                    break;
+                const size_t b = cand / C;
+                const size_t c = cand % C;
+                int node = ws.beams[b].node;
+                if (c != blank)
+                    node = childNode(ws, node, static_cast<int>(c));
+                ws.next_beams[beams_num++] = {node, ws.cand_pb[cand], ws.cand_pnb[cand]};
+            }
+            // keep at least one path if all candidates are impossible
+            if (beams_num == 0)
+                ws.next_beams[beams_num++] = ws.beams[0];
+
+            std::swap(ws.beams, ws.next_beams);
+            ws.beams_num = beams_num;
+        }
+    }
+
+    static int childNode(Workspace& ws, int parent, int label) {
+        int child = ws.nodes[parent].first_child;
+        while (child >= 0 && ws.nodes[child].label != label)
+            child = ws.nodes[child].next_sibling;
+        if (child >= 0)
+            return child;
+
+        child = static_cast<int>(ws.nodes_num++);
+        ws.nodes[child] = {parent, label, -1, ws.nodes[parent].first_child};
+        ws.nodes[parent].first_child = child;
+        return child;
+    }
+
+    // Orders the first next_num candidates by descending probability
+    static void selectCandidates(Workspace& ws, size_t cands_num, size_t next_num) {
+        auto total = [&ws](int cand) {
+            return logSumExp(ws.cand_pb[cand], ws.cand_pnb[cand]);
+        };
+        auto greater = [&total](int a, int b) {
+            const float pa = total(a), pb = total(b);
+            return pa > pb || (pa == pb && a < b);
+        };
+
+        for (size_t i = 0; i < cands_num; i++)
+            ws.cand_order[i] = static_cast<int>(i);
+        auto first = ws.cand_order.begin();
+        if (next_num < cands_num)
+            std::nth_element(first, first + next_num - 1, first + cands_num, greater);
+        std::sort(first, first + next_num, greater);
+    }
+
+    void writePaths(const Workspace& ws, float* sequences, float* log_probs) const {
+        std::fill_n(sequences, top_paths * T, -1.f);
+        for (size_t p = 0; p < top_paths; p++) {
+            if (p >= ws.beams_num) {
+                if (log_probs)
+                    log_probs[p] = -std::numeric_limits<float>::infinity();
+                continue;
+            }
+
+            const Beam& beam = ws.beams[p];
+            size_t length = 0;
+            for (int node = beam.node; ws.nodes[node].parent >= 0; node = ws.nodes[node].parent)
+                length++;
+            float* sequence = sequences + p * T;
+            for (int node = beam.node; ws.nodes[node].parent >= 0; node = ws.nodes[node].parent)
+                sequence[--length] = static_cast<float>(ws.nodes[node].label);
+
+            if (log_probs)
+                log_probs[p] = logSumExp(beam.log_pb, beam.log_pnb);
+        }
+    }
+
+    size_t T = 0;
+    size_t N = 0;
+    size_t C = 0;
+    size_t beam_width = 0;
+    size_t top_paths = 0;
+    std::vector<Workspace> workspaces;
+};
+
+REG_FACTORY_FOR(CTCBeamSearchDecoderImpl, CTCBeamSearchDecoder);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
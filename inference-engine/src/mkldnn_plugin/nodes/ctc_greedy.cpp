@@ -4,9 +4,11 @@
 
 #include "base.hpp"
 
+#include "ctc_greedy_imp.hpp"
 #include <cmath>
 #include <vector>
 #include <string>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -37,52 +39,46 @@ public:
             return GENERAL_ERROR;
         }
         const float* probabilities = inputs[0]->buffer();
-        const float* sequence_indicators = inputs[1]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->buffer().as<const float*>() : nullptr;
         float* output_sequences = outputs[0]->buffer();
 
         size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
-        }
-
-        for (size_t n = 0; n < N_; ++n) {
-            int prev_class_idx = -1;
-            size_t output_index = n*T_;
+        // keeps the per timestep classes without reallocation while the shape does not change
+        max_classes.resize(T_ * N_);
 
-            for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
-                int max_class_idx = 0;
+        parallel_for(N_, [&](size_t n) {
+            size_t seq_len = 1;
+            while (seq_len < T_ && (!sequence_indicators || sequence_indicators[seq_len * N_ + n] != 0))
+                seq_len++;
 
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (size_t c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = static_cast<int>(c);
-                        max_prob = *probs;
-                    }
-                }
+            int* classes = &max_classes[n * T_];
+            XARCH::ctc_argmax(probabilities + n * C_, seq_len, N_ * C_, C_, classes);
 
+            float* output = output_sequences + n * T_;
+            size_t output_index = 0;
+            int prev_class_idx = -1;
+            for (size_t t = 0; t < seq_len; ++t) {
+                int max_class_idx = classes[t];
                 if (max_class_idx < static_cast<int>(C_) - 1 &&
                         max_class_idx != prev_class_idx) {
-                    output_sequences[output_index] = static_cast<float>(max_class_idx);
+                    output[output_index] = static_cast<float>(max_class_idx);
                     output_index++;
                 }
-
                 prev_class_idx = max_class_idx;
-
-                if (t + 1 == static_cast<int>(T_) || sequence_indicators[(t + 1)*N_ + n] == 0) {
-                    break;
-                }
             }
-        }
+
+            // Fill the rest of output sequence with -1
+            for (; output_index < T_; output_index++)
+                output[output_index] = -1;
+        });
         return OK;
     }
+
+private:
+    std::vector<int> max_classes;
 };
 
 REG_FACTORY_FOR(CTCGreedyDecoderImpl, CTCGreedyDecoder);
@@ -0,0 +1,63 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ctc_greedy_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+#if defined(HAVE_AVX512F)
+    constexpr size_t block_size = 16;
+    typedef __m512 vec_type_f;
+#elif defined(HAVE_AVX2)
+    constexpr size_t block_size = 8;
+    typedef __m256 vec_type_f;
+#elif defined(HAVE_SSE42)
+    constexpr size_t block_size = 4;
+    typedef __m128 vec_type_f;
+#endif
+
+static inline float row_max(const float* src, size_t classes_num) {
+    size_t c = 0;
+    float max_val = src[0];
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (classes_num >= block_size) {
+        vec_type_f vmax_val = _mm_uni_loadu_ps(src);
+        for (c = block_size; c + block_size <= classes_num; c += block_size)
+            vmax_val = _mm_uni_max_ps(vmax_val, _mm_uni_loadu_ps(src + c));
+
+        float lanes[block_size];
+        _mm_uni_storeu_ps(lanes, vmax_val);
+        for (size_t i = 0; i < block_size; i++)
+            max_val = std::max(max_val, lanes[i]);
+    }
+#endif
+    for (; c < classes_num; c++)
+        max_val = std::max(max_val, src[c]);
+    return max_val;
+}
+
+void ctc_argmax(const float* src, size_t rows_num, size_t rows_stride, size_t classes_num, int* dst) {
+    for (size_t r = 0; r < rows_num; r++, src += rows_stride) {
+        // the maximum is found with vector instructions, the scan for its first position stops early
+        const float max_val = row_max(src, classes_num);
+        size_t c = 0;
+        while (c + 1 < classes_num && src[c] != max_val)
+            c++;
+        dst[r] = static_cast<int>(c);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,22 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * Writes index of the first maximum of each of rows_num rows with classes_num elements,
+ * rows are located rows_stride elements apart
+ */
+void ctc_argmax(const float* src, size_t rows_num, size_t rows_stride, size_t classes_num, int* dst);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
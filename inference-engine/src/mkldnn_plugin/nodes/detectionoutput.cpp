@@ -16,12 +16,6 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
-template <typename T>
-static bool SortScorePairDescend(const std::pair<float, T>& pair1,
-                                 const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
-}
-
 class DetectionOutputImpl: public ExtLayerBase {
 public:
     explicit DetectionOutputImpl(const CNNLayer* layer) {
@@ -109,6 +103,10 @@ public:
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
             _num_priors_actual->allocate();
 
+            _topk_heap.resize(static_cast<size_t>(_num) * _num_classes);
+            _topk_taken.resize(static_cast<size_t>(_num) * _num_classes);
+            _output_offsets.resize(_num);
+
             addConfig(layer, {DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
@@ -136,71 +134,64 @@ public:
         int *num_priors_actual     = _num_priors_actual->buffer();
 
         for (int n = 0; n < N; ++n) {
-            const float *ppriors = prior_data;
-            const float *prior_variances = prior_data + _num_priors*_prior_size;
-            if (_priors_batches) {
-                ppriors += _variance_encoded_in_target ? n*_num_priors*_prior_size : 2*n*_num_priors*_prior_size;
-                prior_variances += _variance_encoded_in_target ? 0 : n*_num_priors*_prior_size;
-            }
-
-            if (_share_location) {
-                const float *ploc = loc_data + n*4*_num_priors;
-                float *pboxes = decoded_bboxes_data + n*4*_num_priors;
-                float *psizes = bbox_sizes_data + n*_num_priors;
-                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
-            } else {
-                for (int c = 0; c < _num_loc_classes; ++c) {
-                    if (c == _background_label_id) {
-                        continue;
-                    }
+            num_priors_actual[n] = countActualPriors(getPriors(prior_data, n));
+        }
 
-                    const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
-                    float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
-                    float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
-                }
+        // Boxes of all images and location classes are decoded in parallel by blocks of priors
+        const int prior_blocks = (_num_priors + decode_block_size - 1) / decode_block_size;
+        parallel_for3d(N, _num_loc_classes, prior_blocks, [&](int n, int c, int block) {
+            if (!_share_location && c == _background_label_id) {
+                return;
             }
-        }
 
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                }
+            const float *ppriors = getPriors(prior_data, n);
+            const float *prior_variances = getPriorVariances(prior_data, n);
+            const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
+            float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
+            float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
+
+            const int p_start = block * decode_block_size;
+            const int p_end = (std::min)(p_start + decode_block_size, num_priors_actual[n]);
+            decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, p_start, p_end);
+        });
+
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes + c;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes + c*_num_priors;
+            for (int p = 0; p < _num_priors; ++p) {
+                preordered[p] = pconf[p*_num_classes];
             }
-        }
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        if (!_decrease_label_id) {
+            // Caffe style
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -208,41 +199,15 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
-
-            for (int c = 0; c < _num_classes; ++c) {
-                detections_total += detections_data[n*_num_classes + c];
-            }
-
-            if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
-
-                for (int c = 0; c < _num_classes; ++c) {
-                    int detections = detections_data[n*_num_classes + c];
-                    int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                    float *pconf  = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-
-                    for (int i = 0; i < detections; ++i) {
-                        int idx = pindices[i];
-                        conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
-                    }
-                }
-
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
-
-                // Store the new indices.
-                memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
+            });
+        }
 
-                for (size_t j = 0; j < conf_index_class_map.size(); ++j) {
-                    int label = conf_index_class_map[j].second.first;
-                    int idx = conf_index_class_map[j].second.second;
-                    int *pindices = indices_data + n * _num_classes * _num_priors + label * _num_priors;
-                    pindices[detections_data[n*_num_classes + label]] = idx;
-                    detections_data[n*_num_classes + label]++;
-                }
-            }
+        if (_keep_top_k > -1) {
+            parallel_for(N, [&](int n) {
+                keepTopK(reordered_conf_data + n*_num_classes*_num_priors,
+                         indices_data + n*_num_classes*_num_priors,
+                         detections_data + n*_num_classes, n);
+            });
         }
 
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
@@ -258,28 +223,34 @@ public:
 
         memset(dst_data, 0, dst_data_size);
 
+        // Detections of every image are written starting from the total count of the previous images
         int count = 0;
         for (int n = 0; n < N; ++n) {
+            _output_offsets[n] = count;
+            for (int c = 0; c < _num_classes; ++c) {
+                count += detections_data[n*_num_classes + c];
+            }
+        }
+
+        parallel_for(N, [&](int n) {
             const float *pconf   = reordered_conf_data + n * _num_priors * _num_classes;
             const float *pboxes  = decoded_bboxes_data + n*_num_priors*4*_num_loc_classes;
             const int *pindices  = indices_data + n*_num_classes*_num_priors;
+            float *pdst = dst_data + _output_offsets[n] * DETECTION_SIZE;
 
             for (int c = 0; c < _num_classes; ++c) {
                 for (int i = 0; i < detections_data[n*_num_classes + c]; ++i) {
                     int idx = pindices[c*_num_priors + i];
 
-                    dst_data[count * DETECTION_SIZE + 0] = static_cast<float>(n);
-                    dst_data[count * DETECTION_SIZE + 1] = static_cast<float>(_decrease_label_id ? c-1 : c);
-                    dst_data[count * DETECTION_SIZE + 2] = pconf[c*_num_priors + idx];
+                    pdst[0] = static_cast<float>(n);
+                    pdst[1] = static_cast<float>(_decrease_label_id ? c-1 : c);
+                    pdst[2] = pconf[c*_num_priors + idx];
 
-                    float xmin = _share_location ? pboxes[idx*4 + 0] :
-                                 pboxes[c*4*_num_priors + idx*4 + 0];
-                    float ymin = _share_location ? pboxes[idx*4 + 1] :
-                                 pboxes[c*4*_num_priors + idx*4 + 1];
-                    float xmax = _share_location ? pboxes[idx*4 + 2] :
-                                 pboxes[c*4*_num_priors + idx*4 + 2];
-                    float ymax = _share_location ? pboxes[idx*4 + 3] :
-                                 pboxes[c*4*_num_priors + idx*4 + 3];
+                    const float *pbox = _share_location ? pboxes + idx*4 : pboxes + c*4*_num_priors + idx*4;
+                    float xmin = pbox[0];
+                    float ymin = pbox[1];
+                    float xmax = pbox[2];
+                    float ymax = pbox[3];
 
                     if (_clip_after_nms) {
                         xmin = (std::max)(0.0f, (std::min)(1.0f, xmin));
@@ -288,15 +259,15 @@ public:
                         ymax = (std::max)(0.0f, (std::min)(1.0f, ymax));
                     }
 
-                    dst_data[count * DETECTION_SIZE + 3] = xmin;
-                    dst_data[count * DETECTION_SIZE + 4] = ymin;
-                    dst_data[count * DETECTION_SIZE + 5] = xmax;
-                    dst_data[count * DETECTION_SIZE + 6] = ymax;
+                    pdst[3] = xmin;
+                    pdst[4] = ymin;
+                    pdst[5] = xmax;
+                    pdst[6] = ymax;
 
-                    ++count;
+                    pdst += DETECTION_SIZE;
                 }
             }
-        }
+        });
 
         if (count < N*_keep_top_k) {
             // marker at end of boxes list
@@ -311,6 +282,8 @@ private:
     const int idx_confidence = 1;
     const int idx_priors = 2;
 
+    // number of priors decoded by a single parallel task
+    const int decode_block_size = 256;
 
     int _num_classes = 0;
     int _background_label_id = 0;
@@ -343,8 +316,25 @@ private:
         CENTER_SIZE = 2,
     };
 
+    const float* getPriors(const float *prior_data, int n) const {
+        if (!_priors_batches)
+            return prior_data;
+        return prior_data + (_variance_encoded_in_target ? n*_num_priors*_prior_size : 2*n*_num_priors*_prior_size);
+    }
+
+    const float* getPriorVariances(const float *prior_data, int n) const {
+        const float *prior_variances = prior_data + _num_priors*_prior_size;
+        if (_priors_batches && !_variance_encoded_in_target)
+            prior_variances += n*_num_priors*_prior_size;
+        return prior_variances;
+    }
+
+    int countActualPriors(const float *prior_data) const;
+
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
+                      float *decoded_bboxes, float *decoded_bbox_sizes, int p_start, int p_end);
+
+    void keepTopK(const float *conf_data, const int *indices, int *detections, int n);
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int &detections, int num_priors_actual);
@@ -359,6 +349,11 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+
+    // scratch buffers reused across calls
+    std::vector<std::pair<float, int>> _topk_heap;
+    std::vector<int> _topk_taken;
+    std::vector<int> _output_offsets;
 };
 
 struct ConfidenceComparator {
@@ -410,104 +405,133 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
-void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
-                                   const float *loc_data,
-                                   const float *variance_data,
-                                   float *decoded_bboxes,
-                                   float *decoded_bbox_sizes,
-                                   int* num_priors_actual,
-                                   int n) {
-    num_priors_actual[n] = _num_priors;
+int DetectionOutputImpl::countActualPriors(const float *prior_data) const {
     if (!_normalized) {
-        int num = 0;
-        for (; num < _num_priors; ++num) {
+        for (int num = 0; num < _num_priors; ++num) {
             float batch_id = prior_data[num * _prior_size + 0];
             if (batch_id == -1.f) {
-                num_priors_actual[n] = num;
-                break;
+                return num;
             }
         }
     }
+    return _num_priors;
+}
 
-    parallel_for(num_priors_actual[n], [&](int p) {
-        float new_xmin = 0.0f;
-        float new_ymin = 0.0f;
-        float new_xmax = 0.0f;
-        float new_ymax = 0.0f;
-
-        float prior_xmin = prior_data[p*_prior_size + 0 + _offset];
-        float prior_ymin = prior_data[p*_prior_size + 1 + _offset];
-        float prior_xmax = prior_data[p*_prior_size + 2 + _offset];
-        float prior_ymax = prior_data[p*_prior_size + 3 + _offset];
-
-        float loc_xmin = loc_data[4*p*_num_loc_classes + 0];
-        float loc_ymin = loc_data[4*p*_num_loc_classes + 1];
-        float loc_xmax = loc_data[4*p*_num_loc_classes + 2];
-        float loc_ymax = loc_data[4*p*_num_loc_classes + 3];
-
-        if (!_normalized) {
-            prior_xmin /= _image_width;
-            prior_ymin /= _image_height;
-            prior_xmax /= _image_width;
-            prior_ymax /= _image_height;
+void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
+                                   const float *loc_data,
+                                   const float *variance_data,
+                                   float *decoded_bboxes,
+                                   float *decoded_bbox_sizes,
+                                   int p_start,
+                                   int p_end) {
+    // Layer parameters are checked once per block, so the loops below are branch free
+    // and can be vectorized by the compiler
+    const float x_norm = _normalized ? 1.0f : static_cast<float>(_image_width);
+    const float y_norm = _normalized ? 1.0f : static_cast<float>(_image_height);
+    const int loc_stride = 4*_num_loc_classes;
+    const float *pprior = prior_data + _offset;
+
+    if (_code_type == CodeType::CORNER) {
+        for (int p = p_start; p < p_end; ++p) {
+            const float *var = _variance_encoded_in_target ? nullptr : variance_data + p*4;
+            for (int i = 0; i < 4; ++i) {
+                const float norm = (i % 2 == 0) ? x_norm : y_norm;
+                const float loc = loc_data[loc_stride*p + i];
+                decoded_bboxes[p*4 + i] = pprior[p*_prior_size + i] / norm + (var ? var[i] * loc : loc);
+            }
         }
+    } else if (_code_type == CodeType::CENTER_SIZE) {
+        for (int p = p_start; p < p_end; ++p) {
+            float prior_xmin = pprior[p*_prior_size + 0] / x_norm;
+            float prior_ymin = pprior[p*_prior_size + 1] / y_norm;
+            float prior_xmax = pprior[p*_prior_size + 2] / x_norm;
+            float prior_ymax = pprior[p*_prior_size + 3] / y_norm;
 
-        if (_code_type == CodeType::CORNER) {
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to add the offset predictions.
-                new_xmin = prior_xmin + loc_xmin;
-                new_ymin = prior_ymin + loc_ymin;
-                new_xmax = prior_xmax + loc_xmax;
-                new_ymax = prior_ymax + loc_ymax;
-            } else {
-                new_xmin = prior_xmin + variance_data[p*4 + 0] * loc_xmin;
-                new_ymin = prior_ymin + variance_data[p*4 + 1] * loc_ymin;
-                new_xmax = prior_xmax + variance_data[p*4 + 2] * loc_xmax;
-                new_ymax = prior_ymax + variance_data[p*4 + 3] * loc_ymax;
-            }
-        } else if (_code_type == CodeType::CENTER_SIZE) {
             float prior_width    =  prior_xmax - prior_xmin;
             float prior_height   =  prior_ymax - prior_ymin;
             float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
             float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
 
-            float decode_bbox_center_x, decode_bbox_center_y;
-            float decode_bbox_width, decode_bbox_height;
+            float loc_xmin = loc_data[loc_stride*p + 0];
+            float loc_ymin = loc_data[loc_stride*p + 1];
+            float loc_xmax = loc_data[loc_stride*p + 2];
+            float loc_ymax = loc_data[loc_stride*p + 3];
 
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
-                decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width  = std::exp(loc_xmax) * prior_width;
-                decode_bbox_height = std::exp(loc_ymax) * prior_height;
-            } else {
+            if (!_variance_encoded_in_target) {
                 // variance is encoded in bbox, we need to scale the offset accordingly.
-                decode_bbox_center_x = variance_data[p*4 + 0] * loc_xmin * prior_width + prior_center_x;
-                decode_bbox_center_y = variance_data[p*4 + 1] * loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width    = std::exp(variance_data[p*4 + 2] * loc_xmax) * prior_width;
-                decode_bbox_height   = std::exp(variance_data[p*4 + 3] * loc_ymax) * prior_height;
+                loc_xmin *= variance_data[p*4 + 0];
+                loc_ymin *= variance_data[p*4 + 1];
+                loc_xmax *= variance_data[p*4 + 2];
+                loc_ymax *= variance_data[p*4 + 3];
             }
 
-            new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
-            new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
-            new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
-            new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
+            float decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
+            float decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
+            float decode_bbox_width    = std::exp(loc_xmax) * prior_width;
+            float decode_bbox_height   = std::exp(loc_ymax) * prior_height;
+
+            decoded_bboxes[p*4 + 0] = decode_bbox_center_x - decode_bbox_width  / 2.0f;
+            decoded_bboxes[p*4 + 1] = decode_bbox_center_y - decode_bbox_height / 2.0f;
+            decoded_bboxes[p*4 + 2] = decode_bbox_center_x + decode_bbox_width  / 2.0f;
+            decoded_bboxes[p*4 + 3] = decode_bbox_center_y + decode_bbox_height / 2.0f;
         }
+    } else {
+        std::fill(decoded_bboxes + p_start*4, decoded_bboxes + (std::max)(p_start, p_end)*4, 0.0f);
+    }
 
-        if (_clip_before_nms) {
-            new_xmin = (std::max)(0.0f, (std::min)(1.0f, new_xmin));
-            new_ymin = (std::max)(0.0f, (std::min)(1.0f, new_ymin));
-            new_xmax = (std::max)(0.0f, (std::min)(1.0f, new_xmax));
-            new_ymax = (std::max)(0.0f, (std::min)(1.0f, new_ymax));
+    if (_clip_before_nms) {
+        for (int i = p_start*4; i < p_end*4; ++i) {
+            decoded_bboxes[i] = (std::max)(0.0f, (std::min)(1.0f, decoded_bboxes[i]));
         }
+    }
+
+    for (int p = p_start; p < p_end; ++p) {
+        decoded_bbox_sizes[p] = (decoded_bboxes[p*4 + 2] - decoded_bboxes[p*4 + 0]) *
+                                (decoded_bboxes[p*4 + 3] - decoded_bboxes[p*4 + 1]);
+    }
+}
+
+// Detections of every class are already sorted by confidence in descending order,
+// so the best _keep_top_k of them are found by merging the class lists with a heap
+// and only the per class counts have to be updated.
+void DetectionOutputImpl::keepTopK(const float *conf_data, const int *indices, int *detections, int n) {
+    int detections_total = 0;
+    for (int c = 0; c < _num_classes; ++c) {
+        detections_total += detections[c];
+    }
+    if (detections_total <= _keep_top_k) {
+        return;
+    }
 
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
+    auto heap = _topk_heap.begin() + n*_num_classes;
+    int *taken = &_topk_taken[n*_num_classes];
+    auto compare = [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+        return a.first < b.first || (a.first == b.first && a.second > b.second);
+    };
 
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
-    });
+    int heap_size = 0;
+    for (int c = 0; c < _num_classes; ++c) {
+        taken[c] = 0;
+        if (detections[c] > 0) {
+            heap[heap_size++] = std::make_pair(conf_data[c*_num_priors + indices[c*_num_priors]], c);
+        }
+    }
+    std::make_heap(heap, heap + heap_size, compare);
+
+    for (int k = 0; k < _keep_top_k; ++k) {
+        std::pop_heap(heap, heap + heap_size, compare);
+        const int c = heap[heap_size - 1].second;
+        if (++taken[c] < detections[c]) {
+            heap[heap_size - 1] = std::make_pair(conf_data[c*_num_priors + indices[c*_num_priors + taken[c]]], c);
+            std::push_heap(heap, heap + heap_size, compare);
+        } else {
+            --heap_size;
+        }
+    }
+
+    for (int c = 0; c < _num_classes; ++c) {
+        detections[c] = taken[c];
+    }
 }
 
 void DetectionOutputImpl::nms_cf(const float* conf_data,
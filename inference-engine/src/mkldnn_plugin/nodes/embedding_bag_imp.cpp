@@ -0,0 +1,152 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_imp.hpp"
+
+#include <cstdint>
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+#if defined(HAVE_AVX512F)
+    constexpr size_t block_size = 16;
+    typedef __m512 vec_type_f;
+
+    static inline vec_type_f load_f32(const float* src) {
+        return _mm512_loadu_ps(src);
+    }
+
+    static inline vec_type_f load_f32(const uint16_t* src) {
+        __m512i bits = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+        return _mm512_castsi512_ps(_mm512_slli_epi32(bits, 16));
+    }
+
+    static inline vec_type_f load_f32(const int8_t* src) {
+        return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+    }
+
+    static inline vec_type_f load_f32(const uint8_t* src) {
+        return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+    }
+#elif defined(HAVE_AVX2)
+    constexpr size_t block_size = 8;
+    typedef __m256 vec_type_f;
+
+    static inline vec_type_f load_f32(const float* src) {
+        return _mm256_loadu_ps(src);
+    }
+
+    static inline vec_type_f load_f32(const uint16_t* src) {
+        __m256i bits = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(bits, 16));
+    }
+
+    static inline vec_type_f load_f32(const int8_t* src) {
+        return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))));
+    }
+
+    static inline vec_type_f load_f32(const uint8_t* src) {
+        return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))));
+    }
+#elif defined(HAVE_SSE42)
+    constexpr size_t block_size = 4;
+    typedef __m128 vec_type_f;
+
+    static inline vec_type_f load_f32(const float* src) {
+        return _mm_loadu_ps(src);
+    }
+
+    static inline vec_type_f load_f32(const uint16_t* src) {
+        __m128i bits = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+        return _mm_castsi128_ps(_mm_slli_epi32(bits, 16));
+    }
+
+    static inline __m128i load_4_bytes(const void* src) {
+        int32_t bytes;
+        std::memcpy(&bytes, src, sizeof(bytes));
+        return _mm_cvtsi32_si128(bytes);
+    }
+
+    static inline vec_type_f load_f32(const int8_t* src) {
+        return _mm_cvtepi32_ps(_mm_cvtepi8_epi32(load_4_bytes(src)));
+    }
+
+    static inline vec_type_f load_f32(const uint8_t* src) {
+        return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(load_4_bytes(src)));
+    }
+#endif
+
+static inline float to_f32(float value) {
+    return value;
+}
+
+// bfloat16 is stored as upper half of float
+static inline float to_f32(uint16_t value) {
+    uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+static inline float to_f32(int8_t value) {
+    return static_cast<float>(value);
+}
+
+static inline float to_f32(uint8_t value) {
+    return static_cast<float>(value);
+}
+
+template <typename T>
+static void accumulate(float* dst, const T* src, float weight, size_t size, bool overwrite) {
+    size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type_f vweight = _mm_uni_set1_ps(weight);
+    if (overwrite) {
+        for (; i + block_size <= size; i += block_size)
+            _mm_uni_storeu_ps(dst + i, _mm_uni_mul_ps(vweight, load_f32(src + i)));
+    } else {
+        for (; i + block_size <= size; i += block_size) {
+            vec_type_f vdst = _mm_uni_loadu_ps(dst + i);
+            _mm_uni_storeu_ps(dst + i, _mm_uni_add_ps(vdst, _mm_uni_mul_ps(vweight, load_f32(src + i))));
+        }
+    }
+#endif
+    if (overwrite) {
+        for (; i < size; i++)
+            dst[i] = weight * to_f32(src[i]);
+    } else {
+        for (; i < size; i++)
+            dst[i] += weight * to_f32(src[i]);
+    }
+}
+
+void embedding_bag_accumulate(float* dst, const void* src, embedding_table_type src_type, float weight, size_t size,
+                              bool overwrite) {
+    switch (src_type) {
+        case embedding_table_f32:
+            accumulate(dst, static_cast<const float*>(src), weight, size, overwrite);
+            break;
+        case embedding_table_bf16:
+            accumulate(dst, static_cast<const uint16_t*>(src), weight, size, overwrite);
+            break;
+        case embedding_table_i8:
+            accumulate(dst, static_cast<const int8_t*>(src), weight, size, overwrite);
+            break;
+        case embedding_table_u8:
+            accumulate(dst, static_cast<const uint8_t*>(src), weight, size, overwrite);
+            break;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,34 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/** Element types of an embedding table, BF16 elements are stored as uint16_t */
+enum embedding_table_type {
+    embedding_table_f32,
+    embedding_table_bf16,
+    embedding_table_i8,
+    embedding_table_u8
+};
+
+namespace XARCH {
+
+/**
+ * Computes dst[i] += weight * src[i] for size elements of a table row of src_type,
+ * dst[i] = weight * src[i] if overwrite is set
+ */
+void embedding_bag_accumulate(float* dst, const void* src, embedding_table_type src_type, float weight, size_t size,
+                              bool overwrite);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
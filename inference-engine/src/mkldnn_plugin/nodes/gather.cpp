@@ -13,6 +13,9 @@
 #include "ie_parallel.hpp"
 #include "common/simple_copy.h"
 #include "common/fp16_utils.h"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -68,11 +71,36 @@ public:
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
             confs.push_back(config);
+
+            // Channel blocks are gathered as a whole when 1D indexes select along another axis, so the output keeps
+            // the channel dimension of the dictionary
+            if ((dictionary_dims.size() == 4 || dictionary_dims.size() == 5) && indexes_dims.size() == 1 && axis != 1 &&
+                    layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getPrecision() == dataPrecision) {
+                ConfLayout blk_layout = mayiuse(avx512_common) ? ConfLayout::BLK16 : ConfLayout::BLK8;
+                addConfig(layer, { DataConfigurator(blk_layout), DataConfigurator(ConfLayout::PLN) },
+                          { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        // The channel block of a blocked dictionary is the innermost dimension, so it is a part of the copied data
+        const SizeVector& dims = config.inConfs[GATHER_DICTIONARY].desc.getBlockingDesc().getBlockDims();
+        numDictionaries = 1;
+        for (int i = 0; i < axis; i++)
+            numDictionaries *= dims[i];
+        dataLength = 1;
+        for (size_t i = axis + 1; i < dims.size(); i++)
+            dataLength *= dims[i];
+        return OK;
+    }
+
     struct f32toUi32 {
         inline unsigned int operator()(const float value) {
             return static_cast<unsigned int>(value);
@@ -9,6 +9,7 @@
 #include <memory>
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
+#include <mkldnn_jit_kernel_cache.hpp>
 
 using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::utils;
@@ -194,17 +195,26 @@ public:
                 config.dynBatchSupport = false;
                 confs.push_back(config);
             } else {
+                // the kernel has no parameters, so all Interp layers of the process share it
+                const MKLDNNPlugin::JitKernelKey key("interp");
+                auto &cache = MKLDNNPlugin::MKLDNNJitKernelCache::instance();
                 if (mayiuse(avx512_common)) {
                     blk_layout = ConfLayout::BLK16;
-                    interp_kernel.reset(new jit_uni_interp_kernel_f32<avx512_common>());
+                    interp_kernel = cache.findOrCreate<jit_uni_interp_kernel>(key, [] {
+                        return new jit_uni_interp_kernel_f32<avx512_common>();
+                    });
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
                 } else if (mayiuse(avx2)) {
                     blk_layout = ConfLayout::BLK8;
-                    interp_kernel.reset(new jit_uni_interp_kernel_f32<avx2>());
+                    interp_kernel = cache.findOrCreate<jit_uni_interp_kernel>(key, [] {
+                        return new jit_uni_interp_kernel_f32<avx2>();
+                    });
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
                 } else {
                     blk_layout = ConfLayout::BLK8;
-                    interp_kernel.reset(new jit_uni_interp_kernel_f32<sse42>());
+                    interp_kernel = cache.findOrCreate<jit_uni_interp_kernel>(key, [] {
+                        return new jit_uni_interp_kernel_f32<sse42>();
+                    });
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
                 }
             }
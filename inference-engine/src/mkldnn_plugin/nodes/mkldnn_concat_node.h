@@ -25,6 +25,9 @@ public:
     void execute(mkldnn::stream strm) override;
 
     bool isOptimized() const;
+    bool isExecutable() const override {
+        return !isOptimized();
+    }
 
 private:
     size_t axis = 0;
@@ -152,7 +152,7 @@ void MKLDNNDeconvolutionNode::setBiasAsPostOp(const InferenceEngine::Blob::Ptr&
 
 void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
     if (prim) {
-        strm.submit({*prim});
+        prim.submit(strm);
     }
 }
 
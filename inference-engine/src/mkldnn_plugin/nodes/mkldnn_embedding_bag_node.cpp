@@ -0,0 +1,297 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_embedding_bag_node.h"
+#include <ie_layers.h>
+#include <ie_parallel.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+# define EMBEDDING_BAG_PREFETCH(ptr) __builtin_prefetch((ptr), 0, 1)
+#elif defined(_M_X64) || defined(_M_IX86)
+# include <xmmintrin.h>
+# define EMBEDDING_BAG_PREFETCH(ptr) _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T1)
+#else
+# define EMBEDDING_BAG_PREFETCH(ptr)
+#endif
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
+
+namespace {
+
+// Ports of SparseSegmentSum/Mean/SqrtN
+const size_t SEGMENT_TABLE_PORT = 0;
+const size_t SEGMENT_IDS_PORT = 2;
+// Ports of ExperimentalSparseWeightedSum
+const size_t WEIGHTED_INDICES_PORT = 0;
+const size_t WEIGHTED_TABLE_PORT = 3;
+const size_t WEIGHTED_DEFAULT_VALUE_PORT = 4;
+const size_t WEIGHTED_WEIGHTS_PORT = 5;
+// Indices of gathered rows which are reduced, the same port for all reduce types
+const size_t ENTRY_IDS_PORT = 1;
+
+// Number of entries of a bag between prefetch and reduction of a row
+const size_t PREFETCH_DISTANCE = 4;
+const size_t CACHE_LINE_SIZE = 64;
+
+inline void prefetchRow(const void* row, size_t bytes) {
+    auto ptr = static_cast<const char*>(row);
+    for (size_t offset = 0; offset < bytes; offset += CACHE_LINE_SIZE)
+        EMBEDDING_BAG_PREFETCH(ptr + offset);
+}
+
+// Index value as a row number, negative and fractional values are not valid rows
+inline size_t readIndex(const void* data, bool isI32, size_t i) {
+    if (isI32) {
+        int32_t value = static_cast<const int32_t*>(data)[i];
+        return value < 0 ? std::numeric_limits<size_t>::max() : static_cast<size_t>(value);
+    }
+    float value = static_cast<const float*>(data)[i];
+    return value < 0.f ? std::numeric_limits<size_t>::max() : static_cast<size_t>(value);
+}
+
+}  // namespace
+
+MKLDNNEmbeddingBagNode::MKLDNNEmbeddingBagNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                               MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(layer, eng, cache) {}
+
+bool MKLDNNEmbeddingBagNode::isSupportedReduce(const std::string& type) {
+    return type == "SparseSegmentSum" || type == "SparseSegmentMean" || type == "SparseSegmentSqrtN" ||
+           type == "ExperimentalSparseWeightedSum";
+}
+
+size_t MKLDNNEmbeddingBagNode::tablePort(const std::string& reduceType) {
+    return reduceType == "ExperimentalSparseWeightedSum" ? WEIGHTED_TABLE_PORT : SEGMENT_TABLE_PORT;
+}
+
+void MKLDNNEmbeddingBagNode::getSupportedDescriptors() {
+    auto layer = getCnnLayer();
+    std::string reduceType = layer->GetParamAsString("reduce");
+    if (reduceType == "SparseSegmentSum") {
+        mode = Mode::SegmentSum;
+    } else if (reduceType == "SparseSegmentMean") {
+        mode = Mode::SegmentMean;
+    } else if (reduceType == "SparseSegmentSqrtN") {
+        mode = Mode::SegmentSqrtN;
+    } else if (reduceType == "ExperimentalSparseWeightedSum") {
+        mode = Mode::WeightedSum;
+    } else {
+        THROW_IE_EXCEPTION << "EmbeddingBag node " << getName() << " has unsupported reduce type " << reduceType;
+    }
+
+    // inputs of the reduce layer and indices of the Gather
+    const size_t inputsNum = getParentEdges().size();
+    withWeights = mode == Mode::WeightedSum && inputsNum == 7;
+    if (mode == Mode::WeightedSum ? (inputsNum != 6 && inputsNum != 7) : inputsNum != 4)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    tableInput = tablePort(reduceType);
+    auto& tableDims = getParentEdgeAt(tableInput)->getDims();
+    auto& lookupDims = getParentEdgeAt(inputsNum - 1)->getDims();
+    auto& entryDims = getParentEdgeAt(ENTRY_IDS_PORT)->getDims();
+    auto& dstDims = getChildEdgeAt(0)->getDims();
+    if (tableDims.ndims() < 1 || lookupDims.ndims() != 1 || entryDims.ndims() != 1 || dstDims.ndims() < 1)
+        THROW_IE_EXCEPTION << "EmbeddingBag node " << getName() << " has incorrect input dimensions";
+
+    tableRows = tableDims[0];
+    rowSize = tableDims.size(1);
+    lookupSize = lookupDims[0];
+    entriesNum = entryDims[0];
+    bagsNum = dstDims[0];
+    if (static_cast<size_t>(dstDims.size(1)) != rowSize)
+        THROW_IE_EXCEPTION << "EmbeddingBag node " << getName() << " has incorrect output dimensions";
+}
+
+void MKLDNNEmbeddingBagNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    tablePrecision = getCnnLayer()->insData[tableInput].lock()->getPrecision();
+    if (tablePrecision != Precision::FP32 && tablePrecision != Precision::BF16 &&
+        tablePrecision != Precision::I8 && tablePrecision != Precision::U8)
+        tablePrecision = Precision::FP32;
+    tableType = tablePrecision == Precision::BF16 ? embedding_table_bf16 :
+                tablePrecision == Precision::I8 ? embedding_table_i8 :
+                tablePrecision == Precision::U8 ? embedding_table_u8 : embedding_table_f32;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        Precision precision = getCnnLayer()->insData[i].lock()->getPrecision();
+        if (i == tableInput)
+            precision = tablePrecision;
+        else if (withWeights && i == WEIGHTED_WEIGHTS_PORT)
+            precision = Precision::FP32;
+        else if (precision != Precision::I32)
+            precision = Precision::FP32;
+
+        auto dims = getParentEdgeAt(i)->getDims().ToSizeVector();
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = TensorDesc(precision, dims, TensorDesc::getLayoutByDims(dims));
+        config.inConfs.push_back(dataConfig);
+    }
+
+    auto dims = getChildEdgeAt(0)->getDims().ToSizeVector();
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    dataConfig.desc = TensorDesc(Precision::FP32, dims, TensorDesc::getLayoutByDims(dims));
+    config.outConfs.push_back(dataConfig);
+
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref_any,
+                                             MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())});
+}
+
+void MKLDNNEmbeddingBagNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    bags.resize(bagsNum);
+}
+
+size_t MKLDNNEmbeddingBagNode::lookupRow(size_t entry) const {
+    size_t gathered = readIndex(entryIds, entryIdsAreI32, entry);
+    return readIndex(lookup, lookupIsI32, gathered);
+}
+
+void MKLDNNEmbeddingBagNode::splitToBags() {
+    for (auto& bag : bags)
+        bag = {0, 0};
+
+    for (size_t entry = 0; entry < entriesNum; entry++) {
+        if (readIndex(entryIds, entryIdsAreI32, entry) >= lookupSize)
+            THROW_IE_EXCEPTION << "EmbeddingBag node " << getName() << " has out of range index " << entry;
+    }
+
+    if (mode == Mode::WeightedSum) {
+        // Entries of a bag are expected to be contiguous. Otherwise the last run of entries of the bag wins
+        // like in ExperimentalSparseWeightedSum
+        auto indices = reinterpret_cast<const int32_t*>(getParentEdgeAt(WEIGHTED_INDICES_PORT)->getMemory().GetData());
+        for (size_t entry = 0; entry < entriesNum;) {
+            size_t bag = readIndex(indices, true, 2 * entry);
+            if (bag >= bagsNum)
+                THROW_IE_EXCEPTION << "EmbeddingBag node " << getName() << " has out of range bag index " << entry;
+            size_t end = entry + 1;
+            while (end < entriesNum && readIndex(indices, true, 2 * end) == bag)
+                end++;
+            bags[bag] = {entry, end};
+            entry = end;
+        }
+    } else {
+        auto segmentIds = getParentEdgeAt(SEGMENT_IDS_PORT)->getMemory().GetData();
+        bool segmentIdsAreI32 = getParentEdgeAt(SEGMENT_IDS_PORT)->getMemory().GetDataType() == memory::s32;
+        size_t prev = 0;
+        for (size_t entry = 0; entry < entriesNum;) {
+            size_t bag = readIndex(segmentIds, segmentIdsAreI32, entry);
+            if (bag >= bagsNum || bag < prev)
+                THROW_IE_EXCEPTION << "EmbeddingBag node " << getName() << " has unsorted or out of range segment IDs";
+            size_t end = entry + 1;
+            while (end < entriesNum && readIndex(segmentIds, segmentIdsAreI32, end) == bag)
+                end++;
+            bags[bag] = {entry, end};
+            prev = bag;
+            entry = end;
+        }
+    }
+}
+
+void MKLDNNEmbeddingBagNode::reduce(const uint8_t* table, float* dst) {
+    const float* weights = withWeights ?
+            reinterpret_cast<const float*>(getParentEdgeAt(WEIGHTED_WEIGHTS_PORT)->getMemory().GetData()) : nullptr;
+    size_t defaultRow = tableRows;
+    if (mode == Mode::WeightedSum) {
+        auto defaultValue = getParentEdgeAt(WEIGHTED_DEFAULT_VALUE_PORT)->getMemory().GetData();
+        size_t gathered = readIndex(defaultValue, true, 0);
+        if (gathered < lookupSize)
+            defaultRow = readIndex(lookup, lookupIsI32, gathered);
+    }
+    const size_t rowBytes = rowSize * tablePrecision.size();
+
+    // Work is split by output bags, so every row of the output is written by one thread only
+    parallel_for(bagsNum, [&](size_t b) {
+        float* dstRow = dst + b * rowSize;
+        const Bag& bag = bags[b];
+
+        if (bag.begin == bag.end) {
+            if (defaultRow < tableRows)
+                XARCH::embedding_bag_accumulate(dstRow, table + defaultRow * rowBytes, tableType, 1.f, rowSize, true);
+            else
+                std::memset(dstRow, 0, rowSize * sizeof(float));
+            return;
+        }
+
+        // The first valid row of a bag overwrites the output row, so it is not zeroed beforehand
+        bool empty = true;
+        for (size_t entry = bag.begin; entry < bag.end; entry++) {
+            if (entry + PREFETCH_DISTANCE < bag.end) {
+                size_t next = lookupRow(entry + PREFETCH_DISTANCE);
+                if (next < tableRows)
+                    prefetchRow(table + next * rowBytes, rowBytes);
+            }
+
+            // Rows out of the table range are gathered as zeros
+            size_t row = lookupRow(entry);
+            if (row < tableRows) {
+                XARCH::embedding_bag_accumulate(dstRow, table + row * rowBytes, tableType,
+                                                weights ? weights[entry] : 1.f, rowSize, empty);
+                empty = false;
+            }
+        }
+
+        if (empty) {
+            std::memset(dstRow, 0, rowSize * sizeof(float));
+            return;
+        }
+
+        float count = static_cast<float>(bag.end - bag.begin);
+        if (mode == Mode::SegmentMean || mode == Mode::SegmentSqrtN) {
+            float divisor = mode == Mode::SegmentMean ? count : std::sqrt(count);
+            for (size_t i = 0; i < rowSize; i++)
+                dstRow[i] /= divisor;
+        }
+    });
+}
+
+void MKLDNNEmbeddingBagNode::execute(mkldnn::stream strm) {
+    auto& lookupMemory = getParentEdgeAt(getParentEdges().size() - 1)->getMemory();
+    lookup = lookupMemory.GetData();
+    lookupIsI32 = lookupMemory.GetDataType() == memory::s32;
+    auto& entryIdsMemory = getParentEdgeAt(ENTRY_IDS_PORT)->getMemory();
+    entryIds = entryIdsMemory.GetData();
+    entryIdsAreI32 = entryIdsMemory.GetDataType() == memory::s32;
+
+    splitToBags();
+
+    const void* table = getParentEdgeAt(tableInput)->getMemory().GetData();
+    auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData());
+
+    reduce(static_cast<const uint8_t*>(table), dst);
+}
+
+bool MKLDNNEmbeddingBagNode::created() const {
+    return getType() == EmbeddingBag;
+}
+REG_MKLDNN_PRIM_FOR(MKLDNNEmbeddingBagNode, EmbeddingBag);
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+#include "embedding_bag_imp.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Gather of embedding table rows fused with SparseSegmentSum/Mean/SqrtN or ExperimentalSparseWeightedSum.
+ * Inputs are the inputs of the reduce layer with the table in place of the gathered data,
+ * indices of the Gather are the last input. Rows are read and reduced directly from the table,
+ * so the gathered rows are not written to an intermediate tensor.
+ */
+class MKLDNNEmbeddingBagNode : public MKLDNNNode {
+public:
+    MKLDNNEmbeddingBagNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNEmbeddingBagNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    /** Types of reduce layers which are fused with Gather into the node */
+    static bool isSupportedReduce(const std::string& type);
+    /** Port of the reduce layer which takes gathered rows of the table */
+    static size_t tablePort(const std::string& reduceType);
+
+    enum class Mode {
+        SegmentSum,
+        SegmentMean,
+        SegmentSqrtN,
+        WeightedSum
+    };
+
+private:
+    struct Bag {
+        size_t begin;
+        size_t end;
+    };
+
+    void reduce(const uint8_t* table, float* dst);
+    size_t lookupRow(size_t entry) const;
+    void splitToBags();
+
+    Mode mode = Mode::SegmentSum;
+    bool withWeights = false;
+    size_t tableInput = 0;
+    InferenceEngine::Precision tablePrecision;
+    InferenceEngine::Extensions::Cpu::embedding_table_type tableType = InferenceEngine::Extensions::Cpu::embedding_table_f32;
+
+    size_t tableRows = 0;
+    size_t rowSize = 0;
+    size_t entriesNum = 0;
+    size_t bagsNum = 0;
+
+    // data of index inputs, set for every execution
+    const void* lookup = nullptr;
+    bool lookupIsI32 = false;
+    const void* entryIds = nullptr;
+    bool entryIdsAreI32 = false;
+    size_t lookupSize = 0;
+
+    std::vector<Bag> bags;
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,7 +7,11 @@
 #include "mkldnn_depthwise_node.h"
 #include "mkldnn_quantize_node.h"
 #include "desc_iterator.hpp"
+#include "common/block_sparse_weights.h"
+#include "sparse_fc_imp.hpp"
 #include <ie_layers.h>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -159,9 +163,15 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
 }
 
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || sparseWeights)
         return;
 
+    if (canUseSparseWeights()) {
+        createSparseWeights();
+        getSelectedPrimitiveDescriptor()->setImplementationType(impl_desc_type::sparse);
+        return;
+    }
+
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
@@ -181,6 +191,75 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     }
 }
 
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (!sparseWeights) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    const auto &srcMem = getParentEdgeAt(0)->getMemory();
+    const auto &dstMem = getChildEdgeAt(0)->getMemory();
+    const auto *src = reinterpret_cast<const float *>(srcMem.GetData()) +
+            srcMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto *dst = reinterpret_cast<float *>(dstMem.GetData()) +
+            dstMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const size_t outputs = weightsDims[0];
+    const size_t inputs = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+
+    Extensions::Cpu::XARCH::sparse_fc(src, dst, sparseBiases.empty() ? nullptr : sparseBiases.data(), sparseWeights->GetData(),
+                                      batchToProcess(), outputs, inputs);
+}
+
+bool MKLDNNFullyConnectedNode::canUseSparseWeights() {
+    if (sparseWeightsDensity <= 0.f || baseInputsNumber != 1 || !fusedWith.empty() || wScale != nullptr)
+        return false;
+    if (internalBlobs.empty() || internalBlobs[0]->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    // the kernel reads the input as a [batch x inputs] matrix in the order of the weights
+    const auto &config = getSelectedPrimitiveDescriptor()->getConfig();
+    const auto &inDesc = config.inConfs[0].desc;
+    const auto &outDesc = config.outConfs[0].desc;
+    if (inDesc.getPrecision() != Precision::FP32 || outDesc.getPrecision() != Precision::FP32)
+        return false;
+    const auto layout = inDesc.getLayout();
+    if ((layout != Layout::NC && layout != Layout::NCHW && layout != Layout::NCDHW) || outDesc.getLayout() != Layout::NC)
+        return false;
+
+    const auto &weights = internalBlobs[0];
+    return BlockSparseWeights::density(weights->cbuffer().as<const float *>(), weights->size()) <= sparseWeightsDensity;
+}
+
+void MKLDNNFullyConnectedNode::createSparseWeights() {
+    const auto &weights = internalBlobs[0];
+    const auto *data = weights->cbuffer().as<const float *>();
+    const size_t outputs = weightsDims[0];
+    const size_t inputs = weights->size() / outputs;
+
+    // dense weights are not created at all, so only the packed ones are kept in the weights cache
+    auto create = [&] () {
+        const size_t size = BlockSparseWeights::pack(data, outputs, inputs, nullptr);
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()));
+        ptr->Create(MKLDNNDims({static_cast<ptrdiff_t>(size)}), memory::data_type::u8, memory::format::x);
+        BlockSparseWeights::pack(data, outputs, inputs, ptr->GetData());
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const uint64_t data_hash = weightCache->GetHashFunc().hash(weights->buffer(), weights->byteSize());
+        const std::string string_hash = getName() + "_sparse_" + std::to_string(weights->byteSize())
+                                        + "_" + std::to_string(data_hash);
+        sparseWeights = weightCache->findOrCreate(string_hash, create);
+    } else {
+        sparseWeights = create();
+    }
+
+    if (withBiases) {
+        const auto *biases = internalBlobs[1]->cbuffer().as<const float *>();
+        sparseBiases.assign(biases, biases + internalBlobs[1]->size());
+    }
+}
+
 void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) {
     int blob_idx = 0;
     mkldnn::post_ops ops;
@@ -19,6 +19,7 @@ public:
 
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -37,6 +38,11 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    /**
+     * @brief Enables packed sparse weights if the share of non-zero weights does not exceed the density
+     */
+    void setSparseWeightsDensity(float density) { sparseWeightsDensity = density; }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -52,6 +58,13 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    bool canUseSparseWeights();
+    void createSparseWeights();
+
+    float sparseWeightsDensity = 0.f;
+    MKLDNNMemoryPtr sparseWeights;
+    std::vector<float> sparseBiases;
 };
 
 }  // namespace MKLDNNPlugin
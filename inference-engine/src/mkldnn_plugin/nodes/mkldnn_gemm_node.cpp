@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_gemm_node.h"
+#include "mkldnn_depthwise_node.h"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
@@ -11,6 +12,7 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -118,7 +120,6 @@ void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
 
     auto same = [&] (memory::format fmt) -> PrimitiveDescInfo {
@@ -128,6 +129,7 @@ void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
             InferenceEngine::DataConfig dataConfig;
             dataConfig.inPlace = -1;
             dataConfig.constant = false;
+            auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getInputPrecision(i));
             dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDataType, fmt);
             config.inConfs.push_back(dataConfig);
         }
@@ -158,10 +160,10 @@ void MKLDNNGemmNode::initOptimalPrimitiveDescriptor() {
         return;
     }
 
-    // Only FP32 is supported for now
+    // Quantized inputs keep their precisions, output is always FP32
     auto& selectedConfig = getSelectedPrimitiveDescriptor()->getConfig();
-    for (auto &inConf : selectedConfig.inConfs) {
-        inConf.desc.setPrecision(Precision::FP32);
+    for (size_t i = 0; i < selectedConfig.inConfs.size(); i++) {
+        selectedConfig.inConfs[i].desc.setPrecision(getInputPrecision(i));
     }
 
     for (auto &outConf : selectedConfig.outConfs) {
@@ -185,9 +187,48 @@ void MKLDNNGemmNode::createPrimitive() {
         if (!src2MemPtr || !src2MemPtr->GetPrimitivePtr())
             THROW_IE_EXCEPTION << "Input memory isn't allocated.";
     }
+
+    if (!isInt8())
+        return;
+
+    auto outDims = getChildEdgeAt(0)->getDims();
+    size_t M = outDims[yAxis];
+    size_t N = outDims[xAxis];
+    size_t C = outDims.ndims() == 4 ? outDims[1] : outDims.ndims() == 3 ? M : N;
+    accumulator.resize(M * N);
+    if (!inputZeroPoints.empty())
+        columnSums.resize(N);
+
+    // consecutive ScaleShifts are folded into one scale and shift per output channel
+    outputScales.assign(C, 1.f);
+    outputShifts.assign(C, 0.f);
+    for (auto &node : fusedWith) {
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Fusing of " << node->getName() << " into " << getName() << " is not supported";
+
+        auto* depthwiseLayer = reinterpret_cast<WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+        const float *scales = depthwiseLayer->_weights->cbuffer().as<const float*>();
+        const float *shifts = depthwiseNode->isWithBiases() ? depthwiseLayer->_biases->cbuffer().as<const float*>() : nullptr;
+        bool isBroadcast = depthwiseNode->isBroadcast() || depthwiseLayer->_weights->size() == 1;
+        for (size_t c = 0; c < C; c++) {
+            float scale = scales[isBroadcast ? 0 : c];
+            float shift = shifts ? shifts[isBroadcast ? 0 : c] : 0.f;
+            outputScales[c] *= scale;
+            outputShifts[c] = outputShifts[c] * scale + shift;
+        }
+    }
 }
 
 void MKLDNNGemmNode::execute(mkldnn::stream strm) {
+    if (isInt8()) {
+        if (getParentEdgeAt(0)->getDesc().getPrecision() == Precision::U8)
+            executeInt8<uint8_t>();
+        else
+            executeInt8<int8_t>();
+        return;
+    }
+
     auto inDims0 = getParentEdgeAt(0)->getDims();
     auto inDims1 = getParentEdgeAt(1)->getDims();
     auto outDims = getChildEdgeAt(0)->getDims();
@@ -256,6 +297,115 @@ void MKLDNNGemmNode::execute(mkldnn::stream strm) {
     }
 }
 
+namespace {
+
+// Without VNNI int8 gemm sums pairs of u8 x s8 products by vpmaddubsw in saturated s16 (s8 inputs of A are shifted
+// to u8 by the library), so B must be limited to [-63, 63]: 2 * 255 * 63 fits s16. The low precision
+// transformations requantize B to 7 bits, full range s8 values of B give wrong results on such CPUs.
+void gemm_s32(char transa, char transb, int M, int N, int K, const uint8_t *a, int lda, const int8_t *b, int ldb,
+              int32_t *c, int ldc) {
+    const int32_t co = 0;
+    mkldnn_gemm_u8s8s32(transa, transb, 'F', M, N, K, 1.f, a, lda, 0, b, ldb, 0, 0.f, c, ldc, &co);
+}
+
+void gemm_s32(char transa, char transb, int M, int N, int K, const int8_t *a, int lda, const int8_t *b, int ldb,
+              int32_t *c, int ldc) {
+    const int32_t co = 0;
+    mkldnn_gemm_s8s8s32(transa, transb, 'F', M, N, K, 1.f, a, lda, 0, b, ldb, 0, 0.f, c, ldc, &co);
+}
+
+}  // namespace
+
+template <typename T0>
+void MKLDNNGemmNode::executeInt8() {
+    auto inDims0 = getParentEdgeAt(0)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
+    auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
+    const T0 *src0_ptr = reinterpret_cast<const T0*>(srcMemory0.GetData()) +
+                         srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const int8_t *src1_ptr = reinterpret_cast<const int8_t*>(srcMemory1.GetData()) +
+                             srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
+                     getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    int nDims = outDims.ndims();
+    int MB1 = nDims == 4 ? batchToProcess() : 1;
+    int MB2 = nDims == 3 ? batchToProcess() : nDims > 3 ? outDims[nDims - 3] : 1;
+    int M = outDims[yAxis];
+    int N = outDims[xAxis];
+    int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
+
+    const char transa = transposeA ? 'T' : 'N';
+    const char transb = transposeB ? 'T' : 'N';
+
+    int lda = transposeA ? M : K;
+    int ldb = transposeB ? K : N;
+    int ldc = N;
+
+    int32_t *acc_ptr = accumulator.data();
+    for (int b1 = 0; b1 < MB1; b1++) {
+        const T0 *a_ptr = src0_ptr;
+        const int8_t *b_ptr = src1_ptr;
+        float *d_ptr = dst_ptr;
+
+        for (int b2 = 0; b2 < MB2; b2++) {
+            gemm_s32(transa, transb, M, N, K, a_ptr, lda, b_ptr, ldb, acc_ptr, ldc);
+
+            // (A - zp) * B = A * B - zp * sum_k B[k][n]
+            int32_t zp = inputZeroPoints.empty() ? 0 :
+                         static_cast<int32_t>(inputZeroPoints[inputZeroPoints.size() > 1 ? b2 : 0]);
+            if (zp != 0) {
+                parallel_for(N, [&](int n) {
+                    int32_t sum = 0;
+                    for (int k = 0; k < K; k++)
+                        sum += b_ptr[transposeB ? n * ldb + k : k * ldb + n];
+                    columnSums[n] = sum;
+                });
+            }
+
+            parallel_for(M, [&](int m) {
+                for (int n = 0; n < N; n++) {
+                    int32_t value = acc_ptr[m * ldc + n];
+                    if (zp != 0)
+                        value -= zp * columnSums[n];
+
+                    // output channel is a batch dimension for 4D, a row for 3D and a column for 2D outputs
+                    int c = nDims == 4 ? b2 : nDims == 3 ? m : n;
+                    d_ptr[m * ldc + n] = alpha * static_cast<float>(value) * outputScales[c] + outputShifts[c];
+                }
+            });
+
+            a_ptr += aOffsets[0];
+            b_ptr += bOffsets[0];
+            d_ptr += M * N;
+        }
+
+        src0_ptr += aOffsets[1];
+        src1_ptr += bOffsets[1];
+        dst_ptr += MB2 * M * N;
+    }
+}
+
+bool MKLDNNGemmNode::isInt8() const {
+    const auto& insData = getCnnLayer()->insData;
+    if (insData.size() != 2 || insData[1].lock()->getPrecision() != Precision::I8)
+        return false;
+
+    auto precision0 = inputZeroPoints.empty() ? insData[0].lock()->getPrecision() : Precision::U8;
+    return precision0 == Precision::U8 || precision0 == Precision::I8;
+}
+
+Precision MKLDNNGemmNode::getInputPrecision(size_t port) const {
+    if (!isInt8())
+        return Precision::FP32;
+
+    if (port == 0)
+        return inputZeroPoints.empty() ? getCnnLayer()->insData[0].lock()->getPrecision() : Precision::U8;
+    return Precision::I8;
+}
+
 bool MKLDNNGemmNode::created() const {
     return getType() == Gemm;
 }
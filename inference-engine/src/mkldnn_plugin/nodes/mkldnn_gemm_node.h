@@ -24,7 +24,18 @@ public:
     bool created() const override;
     int getMaxBatch() override;
 
+    // U8 or I8 first input and I8 second one are multiplied with s32 accumulation
+    bool isInt8() const;
+
+    // zero points of the U8 first input, one value or one per channel of 4D input
+    std::vector<uint8_t> inputZeroPoints;
+
 private:
+    InferenceEngine::Precision getInputPrecision(size_t port) const;
+
+    template <typename T0>
+    void executeInt8();
+
     float alpha = 1.0f;
     float beta = 1.0f;
     bool transposeA = false;
@@ -38,6 +49,12 @@ private:
     std::vector<int> aOffsets;
     std::vector<int> bOffsets;
     std::vector<int> cOffsets;
+
+    // fused dequantization applied to s32 results, one value or one per output channel
+    std::vector<float> outputScales;
+    std::vector<float> outputShifts;
+    std::vector<int32_t> accumulator;
+    std::vector<int32_t> columnSums;
 };
 
 }  // namespace MKLDNNPlugin
@@ -117,21 +117,25 @@ void MKLDNNGenericNode::cleanup() {
 
 void MKLDNNGenericNode::execLayer() {
     bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
-    std::vector<InferenceEngine::SizeVector> outputShapes;
+    inputs.clear();
+    constInputs.clear();
+    outputs.clear();
+    inputDescs.clear();
+    outputShapes.clear();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
         auto inputBlob = getParentEdgeAt(i)->getBlob();
         inputs.push_back(inputBlob);
         constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
+        if (isDynBatch && dynBatchLim >= inputBlob->getTensorDesc().getDims()[0])
             isDynBatch = false;
-        } else {
+    }
+
+    if (isDynBatch) {
+        for (auto& input : inputs) {
             // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
-                inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
+            inputDescs.push_back(input->getTensorDesc());
+            if (inputDescs.back().getDims().size() > 0)
+                inputDescs.back().getDims()[0] = static_cast<size_t>(batchToProcess());
         }
     }
 
@@ -154,7 +158,6 @@ void MKLDNNGenericNode::execLayer() {
             inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
         }
     }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
     for (size_t i = 0; i < outDims.size(); i++) {
         if (isDynBatch) {
             auto out_edge = getChildEdgesAtPort(i)[0];
@@ -43,6 +43,14 @@ protected:
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+
+private:
+    // Kept between calls of execLayer() to avoid allocations on every inference
+    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    std::vector<InferenceEngine::Blob::CPtr> constInputs;
+    std::vector<InferenceEngine::Blob::Ptr> outputs;
+    std::vector<InferenceEngine::TensorDesc> inputDescs;
+    std::vector<InferenceEngine::SizeVector> outputShapes;
 };
 
 }  // namespace MKLDNNPlugin
@@ -11,18 +11,8 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
-std::mutex MKLDNNMemoryNodeVirtualEdge::holderMutex;
-
 MKLDNNMemoryOutputNode::MKLDNNMemoryOutputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNNode(layer, eng, cache) , MKLDNNMemoryNode(layer) {
-    if (created()) {
-        holder = MKLDNNMemoryNodeVirtualEdge::registerOutput(this);
-    }
-}
-
-MKLDNNMemoryOutputNode::~MKLDNNMemoryOutputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
-}
+        : MKLDNNNode(layer, eng, cache) , MKLDNNMemoryNode(layer) {}
 
 void MKLDNNMemoryOutputNode::getSupportedDescriptors() {}
 
@@ -64,59 +54,8 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer) {
-    if (created()) {
-        holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
-    }
-}
-
-MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
-}
-
-MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
-    std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
-    // in case of output already registered
-    auto& holder = MKLDNNMemoryNodeVirtualEdge::getExisted();
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(holder, node->getId());
-    if (sibling != nullptr) {
-        auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
-        IE_ASSERT(outputNode != nullptr);
-        outputNode->setInputNode(node);
-    } else {
-        holder[node->getId()] = node;
-    }
-    return &holder;
-}
-#endif
-
-MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerOutput(MKLDNNMemoryOutputNode * node) {
-    std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
-    // in case of output layer
-    auto& holder = MKLDNNMemoryNodeVirtualEdge::getExisted();
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(holder, node->getId());
-    if (sibling != nullptr) {
-#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
-        auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
-        IE_ASSERT(inputNode != nullptr);
-        node->setInputNode(inputNode);
-#else
-        THROW_IE_EXCEPTION << "CPU Plugin doesn't contain Input layer!";
+        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer) {}
 #endif
-    } else {
-        holder[node->getId()] = node;
-    }
-    return &holder;
-}
-
-void MKLDNNMemoryNodeVirtualEdge::remove(MKLDNNMemoryNode * node, Holder* holder) {
-    std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
-    if (nullptr != holder) {
-        InferenceEngine::details::erase_if(*holder, [&](const Holder::value_type & it){
-            return it.second == node;
-        });
-    }
-}
 
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 REG_MKLDNN_PRIM_FOR(MKLDNNMemoryInputNode, MemoryInput);
@@ -29,44 +29,10 @@ class MKLDNNMemoryNode {
     }
     virtual void setInputNode(MKLDNNNode *) = 0;
 };
-class MKLDNNMemoryOutputNode;
-#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
-class MKLDNNMemoryInputNode;
-#endif
-
-/**
- * @brief
- * TODO: ATTENTION: this is a temporary solution, this connection should be keep in graph
- * WARNING: thread_local and holderMutex are not needed if moved into graph
- */
-class MKLDNNMemoryNodeVirtualEdge {
- public:
-    using Holder = std::map<std::string, MKLDNNMemoryNode*>;
-    static Holder & getExisted() {
-        thread_local static Holder existed;
-        return existed;
-    }
-
-    static MKLDNNMemoryNode * getByName(Holder& holder, std::string name) {
-        auto result = holder.find(name);
-        if (result != holder.end()) {
-            return result->second;
-        }
-        return nullptr;
-    }
-
-    static Holder* registerOutput(MKLDNNMemoryOutputNode * node);
-#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
-    static Holder* registerInput(MKLDNNMemoryInputNode * node);
-#endif
-    static void remove(MKLDNNMemoryNode * node, Holder* holder);
-    static std::mutex holderMutex;
-};
 
 class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
  public:
     MKLDNNMemoryOutputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
-    ~MKLDNNMemoryOutputNode() override;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     const MKLDNNEdgePtr getChildEdgeAt(size_t idx) const override;
@@ -81,18 +47,16 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     }
  private:
     /**
-     * @brief keeps reference to input sibling node
+     * @brief keeps reference to input sibling node, it is set by the graph
      */
     MKLDNNNode* inputNode = nullptr;
     static Register<MKLDNNMemoryOutputNode> reg;
-    MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 class MKLDNNMemoryInputNode : public MKLDNNInputNode, public MKLDNNMemoryNode {
 public:
     MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
-    ~MKLDNNMemoryInputNode() override;
 
     bool created() const override {
         return getType() == MemoryInput;
@@ -101,7 +65,6 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
  private:
     static Register<MKLDNNMemoryInputNode> reg;
-    MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 #endif
 
@@ -13,6 +13,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_jit_kernel_cache.hpp>
 #include <ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include <algorithm>
@@ -556,32 +557,52 @@ void MKLDNNMVNNode::createPrimitive() {
     jcp.normalize_variance = normalize_variance;
     jcp.across_channels = across_channels;
 
+    // the normalization kernel embeds post ops of fused nodes, so only the mean and variance kernels are shared
+    auto &cache = MKLDNNJitKernelCache::instance();
+    auto meanVarianceKey = [](const jit_mvn_config_params &jcp) {
+        JitKernelKey key("mvn_mean_variance");
+        key << jcp.planar_layout << jcp.across_channels << jcp.normalize_variance
+            << jcp.src_dt << jcp.dst_dt << jcp.src_data_size << jcp.dst_data_size;
+        return key;
+    };
     if (mayiuse(cpu::avx512_common)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
+        mvn_mean_kernel = cache.findOrCreate<jit_uni_mvn_mean_variance_kernel>(meanVarianceKey(jcp), [&] {
+            return new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp);
+        });
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
+            mvn_variance_kernel = cache.findOrCreate<jit_uni_mvn_mean_variance_kernel>(meanVarianceKey(jcp), [&] {
+                return new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp);
+            });
         }
     } else if (mayiuse(cpu::avx2)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx2>(jcp, *attr.get()));
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
+        mvn_mean_kernel = cache.findOrCreate<jit_uni_mvn_mean_variance_kernel>(meanVarianceKey(jcp), [&] {
+            return new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp);
+        });
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
+            mvn_variance_kernel = cache.findOrCreate<jit_uni_mvn_mean_variance_kernel>(meanVarianceKey(jcp), [&] {
+                return new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp);
+            });
         }
     } else if (mayiuse(cpu::sse42)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::sse42>(jcp, *attr.get()));
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
+        mvn_mean_kernel = cache.findOrCreate<jit_uni_mvn_mean_variance_kernel>(meanVarianceKey(jcp), [&] {
+            return new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp);
+        });
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
+            mvn_variance_kernel = cache.findOrCreate<jit_uni_mvn_mean_variance_kernel>(meanVarianceKey(jcp), [&] {
+                return new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp);
+            });
         }
     }
 }
@@ -6,6 +6,7 @@
 #include "mkldnn_depthwise_node.h"
 #include "mkldnn_activation_node.h"
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_jit_kernel_cache.hpp>
 #include <ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include "jit_uni_eltwise.hpp"
@@ -898,14 +899,25 @@ void MKLDNNNormalizeNode::createPrimitive() {
     jcp.h = (dims_size > 2) ? dims[2] : 1lu;
     jcp.w = (dims_size > 3) ? dims[3] : 1lu;
 
+    // the normalization kernel embeds post ops of fused nodes, so only the modulo kernel is shared
+    JitKernelKey key("normalize_modulo");
+    key << jcp.is_nchw << jcp.is_nhwc << jcp.is_blk << jcp.across_spatial << jcp.channel_shared
+        << jcp.src_dt << jcp.dst_dt << jcp.src_data_size << jcp.dst_data_size << jcp.n << jcp.c << jcp.h << jcp.w;
+    auto &cache = MKLDNNJitKernelCache::instance();
     if (mayiuse(cpu::avx512_common)) {
-        normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::avx512_common>(jcp));
+        normalize_modulo_kernel = cache.findOrCreate<jit_uni_normalize_modulo_kernel>(key, [&] {
+            return new jit_uni_normalize_modulo_kernel_f32<cpu::avx512_common>(jcp);
+        });
         normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
     } else if (mayiuse(cpu::avx2)) {
-        normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::avx2>(jcp));
+        normalize_modulo_kernel = cache.findOrCreate<jit_uni_normalize_modulo_kernel>(key, [&] {
+            return new jit_uni_normalize_modulo_kernel_f32<cpu::avx2>(jcp);
+        });
         normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::avx2>(jcp, *attr.get()));
     } else if (mayiuse(cpu::sse42)) {
-        normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::sse42>(jcp));
+        normalize_modulo_kernel = cache.findOrCreate<jit_uni_normalize_modulo_kernel>(key, [&] {
+            return new jit_uni_normalize_modulo_kernel_f32<cpu::sse42>(jcp);
+        });
         normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::sse42>(jcp, *attr.get()));
     }
 
@@ -7,6 +7,7 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_jit_kernel_cache.hpp>
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
 #include <algorithm>
@@ -344,12 +345,22 @@ void MKLDNNPermuteNode::createPrimitive() {
     jpp.ndims = sorted_order.size();
     jpp.data_size = MKLDNNExtensionUtils::sizeOfDataType(data_type);
 
+    JitKernelKey key("permute");
+    key << jpp.ndims << jpp.dst_block_dims << jpp.src_strides << jpp.dst_strides << jpp.n << jpp.data_size
+        << jpp.supported_dynamic_batch;
+    auto &cache = MKLDNNJitKernelCache::instance();
     if (mayiuse(cpu::avx512_common)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx512_common>(jpp));
+        permute_kernel = cache.findOrCreate<jit_uni_permute_kernel>(key, [&] {
+            return new jit_uni_permute_kernel_f32<cpu::avx512_common>(jpp);
+        });
     } else if (mayiuse(cpu::avx2)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx2>(jpp));
+        permute_kernel = cache.findOrCreate<jit_uni_permute_kernel>(key, [&] {
+            return new jit_uni_permute_kernel_f32<cpu::avx2>(jpp);
+        });
     } else if (mayiuse(cpu::sse42)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::sse42>(jpp));
+        permute_kernel = cache.findOrCreate<jit_uni_permute_kernel>(key, [&] {
+            return new jit_uni_permute_kernel_f32<cpu::sse42>(jpp);
+        });
     }
 }
 
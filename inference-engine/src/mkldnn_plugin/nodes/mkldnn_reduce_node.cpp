@@ -0,0 +1,1376 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_reduce_node.h"
+#include "mkldnn_quantize_node.h"
+#include "mkldnn_depthwise_node.h"
+#include "mkldnn_activation_node.h"
+#include <mkldnn_extension_utils.h>
+#include <mkldnn_jit_kernel_cache.hpp>
+#include <ie_layers_internal.hpp>
+#include "ie_parallel.hpp"
+#include "jit_uni_eltwise.hpp"
+#include "jit_uni_depthwise.hpp"
+#include "jit_uni_quantization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_reduce_call_args, field)
+
+namespace {
+
+float reduce_identity_value(ReduceMode mode) {
+    switch (mode) {
+        case ReduceMode::And:
+        case ReduceMode::Prod:
+            return 1.f;
+        case ReduceMode::Max:
+            return -std::numeric_limits<float>::infinity();
+        case ReduceMode::Min:
+            return std::numeric_limits<float>::infinity();
+        default:
+            return 0.f;
+    }
+}
+
+uint32_t float_bits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_reduce_kernel_f32 : public jit_uni_reduce_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduce_kernel_f32)
+
+    explicit jit_uni_reduce_kernel_f32(jit_reduce_config_params jcp) : jit_uni_reduce_kernel(jcp), jit_generator() {
+        if (jcp_.reduce_mode == ReduceMode::LogSumExp)
+            exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, alg_kind::eltwise_exp, 0.f, 0.f));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_outer_amount, ptr[reg_params + GET_OFF(outer_amount)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_reduce_inner, ptr[reg_params + GET_OFF(reduce_inner)]);
+
+        mov(reg_table, l_table);
+        uni_vbroadcastss(vmm_identity, ptr[reg_table]);
+        uni_vbroadcastss(vmm_abs_mask, ptr[reg_table + sizeof(float)]);
+        uni_vbroadcastss(vmm_one, ptr[reg_table + 2 * sizeof(float)]);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        Xbyak::Label reduce_inner_label;
+        Xbyak::Label reduce_end_label;
+
+        cmp(reg_reduce_inner, 0);
+        jne(reduce_inner_label, T_NEAR);
+        {
+            reduce_vertical(4, false);
+            reduce_vertical(1, false);
+            reduce_vertical(1, true);
+            jmp(reduce_end_label, T_NEAR);
+        }
+        L(reduce_inner_label);
+        {
+            reduce_horizontal();
+        }
+        L(reduce_end_label);
+
+        this->postamble();
+
+        if (exp_injector)
+            exp_injector->prepare_table();
+
+        align(64);
+        L(l_table);
+        dd(float_bits(reduce_identity_value(jcp_.reduce_mode)));
+        dd(0x7fffffff);
+        dd(float_bits(1.f));
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_outer_amount = r11;
+    Xbyak::Reg64 reg_src_stride = r12;
+    Xbyak::Reg64 reg_work = r13;
+    Xbyak::Reg64 reg_src_aux = r15;
+    Xbyak::Reg64 reg_outer = rbp;
+    Xbyak::Reg64 reg_reduce_inner = rsi;
+    Xbyak::Reg64 reg_table = rbx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Reg32 reg_tmp_32 = r14d;
+    Reg64 reg_tmp_64 = r14;
+
+    Vmm vmm_src = Vmm(0);
+    Xmm xmm_src = Xmm(0);
+    Vmm vmm_acc_scalar = Vmm(5);
+    Xmm xmm_acc_scalar = Xmm(5);
+    Vmm vmm_identity = Vmm(6);
+    Vmm vmm_abs_mask = Vmm(7);
+    Vmm vmm_one = Vmm(8);
+    Vmm vmm_zero = Vmm(9);
+    Xmm xmm_aux1 = Xmm(10);
+    Xmm xmm_aux2 = Xmm(11);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(2);
+
+    Xbyak::Label l_table;
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    inline Vmm vmm_acc(int i) {
+        return Vmm(1 + i);
+    }
+
+    // dst[0 : unroll * step) op= src rows, the whole block is kept in registers while walking over the outer rows
+    inline void reduce_vertical(int unroll, bool scalar) {
+        const int elements = scalar ? 1 : unroll * step;
+
+        Xbyak::Label block_loop_label;
+        Xbyak::Label block_loop_end_label;
+        Xbyak::Label outer_loop_label;
+        Xbyak::Label outer_loop_end_label;
+
+        L(block_loop_label);
+        {
+            cmp(reg_work_amount, elements);
+            jl(block_loop_end_label, T_NEAR);
+
+            for (int i = 0; i < unroll; i++) {
+                if (scalar)
+                    movss(Xmm(vmm_acc(i).getIdx()), ptr[reg_dst]);
+                else
+                    uni_vmovups(vmm_acc(i), ptr[reg_dst + i * vlen]);
+            }
+
+            mov(reg_src_aux, reg_src);
+            mov(reg_outer, reg_outer_amount);
+            L(outer_loop_label);
+            {
+                cmp(reg_outer, 0);
+                jle(outer_loop_end_label, T_NEAR);
+
+                for (int i = 0; i < unroll; i++) {
+                    if (scalar)
+                        load_scalar(xmm_src, ptr[reg_src_aux], jcp_.src_dt);
+                    else
+                        load_vector(vmm_src, ptr[reg_src_aux + i * step * jcp_.src_data_size], jcp_.src_dt);
+                    reduce_value(vmm_acc(i), vmm_src);
+                }
+
+                add(reg_src_aux, reg_src_stride);
+                sub(reg_outer, 1);
+                jmp(outer_loop_label, T_NEAR);
+            }
+            L(outer_loop_end_label);
+
+            for (int i = 0; i < unroll; i++) {
+                if (scalar)
+                    movss(ptr[reg_dst], Xmm(vmm_acc(i).getIdx()));
+                else
+                    uni_vmovups(ptr[reg_dst + i * vlen], vmm_acc(i));
+            }
+
+            add(reg_src, elements * jcp_.src_data_size);
+            add(reg_dst, elements * sizeof(float));
+            sub(reg_work_amount, elements);
+            jmp(block_loop_label, T_NEAR);
+        }
+        L(block_loop_end_label);
+    }
+
+    // dst[0] op= all src values: four independent vector accumulators and a scalar one for tails
+    inline void reduce_horizontal() {
+        for (int i = 0; i < 4; i++)
+            uni_vmovups(vmm_acc(i), vmm_identity);
+        uni_vmovups(vmm_acc_scalar, vmm_identity);
+
+        Xbyak::Label outer_loop_label;
+        Xbyak::Label outer_loop_end_label;
+
+        mov(reg_outer, reg_outer_amount);
+        L(outer_loop_label);
+        {
+            cmp(reg_outer, 0);
+            jle(outer_loop_end_label, T_NEAR);
+
+            mov(reg_src_aux, reg_src);
+            mov(reg_work, reg_work_amount);
+            reduce_row(4, false);
+            reduce_row(1, false);
+            reduce_row(1, true);
+
+            add(reg_src, reg_src_stride);
+            sub(reg_outer, 1);
+            jmp(outer_loop_label, T_NEAR);
+        }
+        L(outer_loop_end_label);
+
+        for (int i = 1; i < 4; i++)
+            combine_value(vmm_acc(0), vmm_acc(i));
+
+        Xmm xmm_acc = Xmm(vmm_acc(0).getIdx());
+        if (isa == cpu::avx2) {
+            vextractf128(xmm_aux1, Ymm(vmm_acc(0).getIdx()), 1);
+            combine_scalar(xmm_acc, xmm_aux1);
+        } else if (isa == cpu::avx512_common) {
+            for (int i = 1; i < 4; i++) {
+                vextractf32x4(xmm_aux1, Zmm(vmm_acc(0).getIdx()), i);
+                combine_scalar(xmm_acc, xmm_aux1);
+            }
+        }
+        movshdup(xmm_aux1, xmm_acc);
+        combine_scalar(xmm_acc, xmm_aux1);
+        movhlps(xmm_aux1, xmm_acc);
+        combine_scalar(xmm_acc, xmm_aux1);
+
+        combine_scalar(xmm_acc, xmm_acc_scalar);
+        movss(xmm_aux2, ptr[reg_dst]);
+        combine_scalar(xmm_acc, xmm_aux2);
+        movss(ptr[reg_dst], xmm_acc);
+    }
+
+    inline void reduce_row(int unroll, bool scalar) {
+        const int elements = scalar ? 1 : unroll * step;
+
+        Xbyak::Label row_loop_label;
+        Xbyak::Label row_loop_end_label;
+
+        L(row_loop_label);
+        {
+            cmp(reg_work, elements);
+            jl(row_loop_end_label, T_NEAR);
+
+            for (int i = 0; i < unroll; i++) {
+                if (scalar) {
+                    load_scalar(xmm_src, ptr[reg_src_aux], jcp_.src_dt);
+                    reduce_value(vmm_acc_scalar, vmm_src);
+                } else {
+                    load_vector(vmm_src, ptr[reg_src_aux + i * step * jcp_.src_data_size], jcp_.src_dt);
+                    reduce_value(vmm_acc(i), vmm_src);
+                }
+            }
+
+            add(reg_src_aux, elements * jcp_.src_data_size);
+            sub(reg_work, elements);
+            jmp(row_loop_label, T_NEAR);
+        }
+        L(row_loop_end_label);
+    }
+
+    // acc = acc op f(src), src is clobbered
+    inline void reduce_value(Vmm vmm_acc, Vmm vmm_val) {
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::L1:
+                uni_vandps(vmm_val, vmm_val, vmm_abs_mask);
+                uni_vaddps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            case ReduceMode::L2:
+            case ReduceMode::SumSquare:
+                uni_vfmadd231ps(vmm_acc, vmm_val, vmm_val);
+                break;
+            case ReduceMode::LogSumExp:
+                exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                uni_vaddps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            case ReduceMode::And:
+            case ReduceMode::Or:
+                // non-zero values are counted as 1
+                if (isa == cpu::avx512_common) {
+                    vcmpps(k_mask, vmm_val, vmm_zero, _cmp_neq_uq);
+                    vblendmps(vmm_val | k_mask, vmm_zero, vmm_one);
+                } else if (isa == cpu::avx2) {
+                    vcmpps(vmm_val, vmm_val, vmm_zero, _cmp_neq_uq);
+                    vandps(vmm_val, vmm_val, vmm_one);
+                } else {
+                    cmpps(vmm_val, vmm_zero, _cmp_neq_uq);
+                    andps(vmm_val, vmm_one);
+                }
+                combine_value(vmm_acc, vmm_val);
+                break;
+            default:
+                combine_value(vmm_acc, vmm_val);
+        }
+    }
+
+    // acc = acc op val for already transformed values
+    inline void combine_value(Vmm vmm_acc, Vmm vmm_val) {
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::Max:
+            case ReduceMode::Or:
+                uni_vmaxps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            case ReduceMode::Min:
+            case ReduceMode::And:
+                uni_vminps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            case ReduceMode::Prod:
+                uni_vmulps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            default:
+                uni_vaddps(vmm_acc, vmm_acc, vmm_val);
+        }
+    }
+
+    inline void combine_scalar(Xmm xmm_acc, Xmm xmm_val) {
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::Max:
+            case ReduceMode::Or:
+                maxps(xmm_acc, xmm_val);
+                break;
+            case ReduceMode::Min:
+            case ReduceMode::And:
+                minps(xmm_acc, xmm_val);
+                break;
+            case ReduceMode::Prod:
+                mulps(xmm_acc, xmm_val);
+                break;
+            default:
+                addps(xmm_acc, xmm_val);
+        }
+    }
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        switch (src_dt) {
+            case memory::f32:
+            case memory::s32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case memory::s8:
+                uni_vpmovsxbd(vmm_src, op);
+                break;
+            case memory::u8:
+                uni_vpmovzxbd(vmm_src, op);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+
+        if (src_dt != memory::f32)
+            uni_vcvtdq2ps(vmm_src, vmm_src);
+    }
+
+    inline void load_scalar(Xmm xmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        switch (src_dt) {
+            case memory::f32:
+            case memory::s32:
+                movss(xmm_src, op);
+                break;
+            case memory::s8:
+                movsx(reg_tmp_32, op);
+                movq(xmm_src, reg_tmp_64);
+                break;
+            case memory::u8:
+                movzx(reg_tmp_32, op);
+                movq(xmm_src, reg_tmp_64);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+
+        if (src_dt != data_type::f32) {
+            uni_vcvtdq2ps(xmm_src, xmm_src);
+        }
+    }
+};
+
+// dst = post_ops(finalize(acc)), acc is in fp32
+template <cpu_isa_t isa>
+struct jit_uni_reduce_post_kernel_f32 : public jit_uni_reduce_post_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduce_post_kernel_f32)
+
+    explicit jit_uni_reduce_post_kernel_f32(jit_reduce_config_params jcp, const mkldnn_primitive_attr &attr)
+    : jit_uni_reduce_post_kernel(jcp, attr), jit_generator() {
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len_; i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op.depthwise.alg));
+            } else if (post_op.is_quantization()) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+            }
+        }
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        if (attr_.post_ops_.len_ != 0)
+            mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
+        if (jcp_.reduce_mode == ReduceMode::Mean) {
+            mov(reg_divisor, ptr[reg_params + GET_OFF(divisor)]);
+            uni_vbroadcastss(vmm_divisor, ptr[reg_divisor]);
+        }
+        if (isa == avx512_common)
+            uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        if (jcp_.planar_layout) {
+            reduce_post_planar();
+        } else {
+            reduce_post_blk();
+        }
+
+        this->postamble();
+
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_divisor = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Reg8 reg_tmp_8 = r14b;
+    Reg32 reg_tmp_32 = r14d;
+    Reg64 reg_tmp_64 = r14;
+
+    Xbyak::Reg64 reg_oc_off = rax;
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+
+    Vmm vmm_val = Vmm(0);
+    Xmm xmm_val = Xmm(0);
+    Vmm vmm_divisor = Vmm(1);
+
+    Vmm vmm_d_weights = Vmm(5);
+    Vmm vmm_d_bias = Vmm(6);
+    Vmm vmm_zero = Vmm(7);
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
+
+    // one channel per call, the channel parameters of post ops are broadcast
+    inline void reduce_post_planar() {
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_loop_end_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(main_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            finalize();
+            apply_post_ops(jcp_.dst_dt, 1);
+            store_vector(ptr[reg_dst], vmm_val, jcp_.dst_dt);
+
+            add(reg_src, vlen);
+            add(reg_dst, step * jcp_.dst_data_size);
+            sub(reg_work_amount, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(tail_loop_end_label, T_NEAR);
+
+            movss(xmm_val, ptr[reg_src]);
+            finalize();
+            apply_post_ops(jcp_.dst_dt, 1);
+            store_scalar(ptr[reg_dst], xmm_val, jcp_.dst_dt);
+
+            add(reg_src, sizeof(float));
+            add(reg_dst, jcp_.dst_data_size);
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_loop_end_label);
+    }
+
+    // work_amount spatial positions of one channel block, sse42 processes the block of 8 channels by halves
+    inline void reduce_post_blk() {
+        const int blk_size = isa == cpu::avx512_common ? 16 : 8;
+
+        Xbyak::Label blk_loop_label;
+        Xbyak::Label blk_loop_end_label;
+
+        L(blk_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(blk_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            finalize();
+            apply_post_ops(jcp_.dst_dt, 0);
+            store_vector(ptr[reg_dst], vmm_val, jcp_.dst_dt);
+
+            if (isa == cpu::sse42) {
+                int sse42_offset = 4;
+                uni_vmovups(vmm_val, ptr[reg_src + sse42_offset * sizeof(float)]);
+                finalize();
+                if (attr_.post_ops_.len_ != 0) {
+                    add(reg_oc_off, sse42_offset * sizeof(float));
+                    apply_post_ops(jcp_.dst_dt, 0);
+                    sub(reg_oc_off, sse42_offset * sizeof(float));
+                }
+                store_vector(ptr[reg_dst + sse42_offset * jcp_.dst_data_size], vmm_val, jcp_.dst_dt);
+            }
+
+            add(reg_src, blk_size * sizeof(float));
+            add(reg_dst, blk_size * jcp_.dst_data_size);
+            sub(reg_work_amount, 1);
+            jmp(blk_loop_label, T_NEAR);
+        }
+        L(blk_loop_end_label);
+    }
+
+    inline void finalize() {
+        if (jcp_.reduce_mode == ReduceMode::L2) {
+            uni_vsqrtps(vmm_val, vmm_val);
+        } else if (jcp_.reduce_mode == ReduceMode::Mean) {
+            uni_vdivps(vmm_val, vmm_val, vmm_divisor);
+        }
+    }
+
+    inline void store_vector(const Xbyak::Address &op, Vmm vmm_dst, memory::data_type dst_dt) {
+        Ymm ymm_dst = Ymm(vmm_dst.getIdx());
+        Xmm xmm_dst = Xmm(vmm_dst.getIdx());
+
+        if (dst_dt == memory::f32) {
+            uni_vmovups(op, vmm_dst);
+        } else if (dst_dt == memory::u8) {
+            uni_vcvtps2dq(vmm_dst, vmm_dst);
+            if (isa == cpu::avx512_common) {
+                vpmaxsd(vmm_dst, vmm_dst, vmm_zero);
+                vpmovusdb(op, vmm_dst);
+            } else {
+                uni_vpackusdw(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vpermq(ymm_dst, ymm_dst, 0x08);
+                uni_vpackuswb(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vmovq(op, xmm_dst);
+                else
+                    movd(op, xmm_dst);
+            }
+        } else if (dst_dt == memory::s8) {
+            uni_vcvtps2dq(vmm_dst, vmm_dst);
+            if (isa == cpu::avx512_common) {
+                vpmovsdb(op, vmm_dst);
+            } else {
+                uni_vpackssdw(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vpermq(ymm_dst, ymm_dst, 0x08);
+                uni_vpacksswb(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vmovq(op, xmm_dst);
+                else
+                    movd(op, xmm_dst);
+            }
+        }
+    }
+
+    inline void store_scalar(const Xbyak::Address &op, Xmm xmm_dst, memory::data_type dst_dt) {
+        if (dst_dt != data_type::f32) {
+            uni_vcvtps2dq(xmm_dst, xmm_dst);
+        }
+
+        switch (dst_dt) {
+            case memory::f32:
+            case memory::s32:
+                movss(op, xmm_dst);
+                break;
+            case memory::s8:
+                uni_vpackssdw(xmm_dst, xmm_dst, xmm_dst);
+                uni_vpacksswb(xmm_dst, xmm_dst, xmm_dst);
+                movq(reg_tmp_64, xmm_dst);
+                mov(op, reg_tmp_8);
+                break;
+            case memory::u8:
+                uni_vpackusdw(xmm_dst, xmm_dst, xmm_dst);
+                uni_vpackuswb(xmm_dst, xmm_dst, xmm_dst);
+                movq(reg_tmp_64, xmm_dst);
+                mov(op, reg_tmp_8);
+                break;
+            default:
+                assert(!"unknown dst_dt");
+        }
+    }
+
+    void apply_post_ops(memory::data_type dst_dt, bool is_broadcast) {
+        const auto &p = attr_.post_ops_;
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        int quantization_inj_idx = 0;
+        for (int i = 0; i < p.len_; i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                add(reg_d_weights, reg_oc_off);
+                add(reg_d_bias, reg_oc_off);
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1, reg_d_weights, reg_d_bias, is_broadcast);
+                depthwise_inj_idx++;
+            } else if (post_op.is_quantization()) {
+                bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || dst_dt == memory::f32 || i != p.len_ - 1;
+
+                int s_idx = vmm_val.getIdx();
+
+                quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, do_rounding, 0, is_broadcast);
+
+                if (do_dequantization) {
+                    quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(reg_oc_off);
+                    quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, 0, is_broadcast);
+                }
+
+                quantization_inj_idx++;
+            }
+        }
+    }
+};
+
+MKLDNNReduceNode::MKLDNNReduceNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNReduceNode::getSupportedDescriptors() {
+    if (!descs.empty())
+        return;
+
+    if (getParentEdges().size() != 2)
+        THROW_IE_EXCEPTION << "Reduce node with name '" << getName() << "' has incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Reduce node with name '" << getName() << "' has incorrect number of output edges";
+
+    auto *layer = getCnnLayer().get();
+    if (layer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get CNNLayer of Reduce node with name '" << getName() << "'";
+
+    const std::string& type = layer->type;
+    if (type == "ReduceAnd") reduceMode = ReduceMode::And;
+    else if (type == "ReduceL1") reduceMode = ReduceMode::L1;
+    else if (type == "ReduceL2") reduceMode = ReduceMode::L2;
+    else if (type == "ReduceLogSum") reduceMode = ReduceMode::LogSum;
+    else if (type == "ReduceLogSumExp") reduceMode = ReduceMode::LogSumExp;
+    else if (type == "ReduceMax") reduceMode = ReduceMode::Max;
+    else if (type == "ReduceMean") reduceMode = ReduceMode::Mean;
+    else if (type == "ReduceMin") reduceMode = ReduceMode::Min;
+    else if (type == "ReduceOr") reduceMode = ReduceMode::Or;
+    else if (type == "ReduceProd") reduceMode = ReduceMode::Prod;
+    else if (type == "ReduceSum") reduceMode = ReduceMode::Sum;
+    else if (type == "ReduceSumSquare") reduceMode = ReduceMode::SumSquare;
+    else
+        THROW_IE_EXCEPTION << "Reduce node with name '" << getName() << "' has unsupported type " << type;
+
+    keep_dims = layer->GetParamAsBool("keep_dims", true);
+
+    if (getParentEdgeAt(REDUCE_INDEXES)->getDims().ndims() > 1)
+        THROW_IE_EXCEPTION << "Reduce node with name '" << getName() << "' has axes input which is not 1D";
+
+    size_t srcRank = getParentEdgeAt(REDUCE_DATA)->getDims().ndims();
+    size_t dstRank = getChildEdgeAt(0)->getDims().ndims();
+    if ((keep_dims && srcRank != dstRank) || (!keep_dims && srcRank <= dstRank))
+        THROW_IE_EXCEPTION << "Reduce node with name '" << getName() << "' has incorrect number of input/output dimensions";
+
+    // axes are usually constant, so the layout and the loops are chosen once
+    auto axesNode = getParentEdgeAt(REDUCE_INDEXES)->getParent();
+    auto axesLayer = axesNode->getCnnLayer();
+    if (axesNode->getType() == Input && axesLayer && axesLayer->blobs.find("custom") != axesLayer->blobs.end()) {
+        auto axesBlob = axesLayer->blobs["custom"];
+        raw_axes.clear();
+        if (axesBlob->getTensorDesc().getPrecision() == Precision::I64) {
+            auto axesData = axesBlob->cbuffer().as<const int64_t *>();
+            for (size_t i = 0; i < axesBlob->size(); i++)
+                raw_axes.push_back(static_cast<int>(axesData[i]));
+        } else if (axesBlob->getTensorDesc().getPrecision() == Precision::I32) {
+            auto axesData = axesBlob->cbuffer().as<const int32_t *>();
+            raw_axes.assign(axesData, axesData + axesBlob->size());
+        } else {
+            THROW_IE_EXCEPTION << "Reduce node with name '" << getName() << "' has unsupported axes precision";
+        }
+        const_axes = true;
+    }
+}
+
+void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    setPostOps(attr, true);
+
+    Precision inputPrecision = getCnnLayer()->insData[REDUCE_DATA].lock()->getPrecision();
+    inputPrecision = inputPrecision == Precision::BF16 ? Precision(Precision::FP32) : inputPrecision;
+    Precision outputPrecision = getCnnLayer()->outData[0]->getPrecision();
+    outputPrecision = outputPrecision == Precision::BF16 ? Precision(Precision::FP32) : outputPrecision;
+
+    if (!fusedWith.empty()) {
+        auto lastFusedLayer = fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
+        if (lastFusedLayer) {
+            outputPrecision = lastFusedLayer->outData[0]->getPrecision();
+        }
+    }
+
+    auto isOneOf = [&](InferenceEngine::Precision precision, std::vector<InferenceEngine::Precision> precisions) {
+        for (auto p : precisions) {
+            if (precision == p) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // integer data keeps the integer arithmetic of the reference implementation
+    jit_mode = mayiuse(cpu::sse42) && inputPrecision != Precision::I32;
+    if (jit_mode) {
+        if (!isOneOf(inputPrecision, {Precision::FP32, Precision::I8, Precision::U8}))
+            inputPrecision = Precision::FP32;
+        if (!isOneOf(outputPrecision, {Precision::FP32, Precision::I8, Precision::U8}))
+            outputPrecision = Precision::FP32;
+    } else {
+        if (inputPrecision != Precision::I32)
+            inputPrecision = Precision::FP32;
+        if (inputPrecision != Precision::I32 || outputPrecision != Precision::FP32)
+            outputPrecision = inputPrecision;
+    }
+
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
+
+    input_prec = inputPrecision;
+    output_prec = outputPrecision;
+    src_data_size = MKLDNNExtensionUtils::sizeOfDataType(inputDataType);
+    dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(outputDataType);
+
+    const auto srcDims = getParentEdgeAt(REDUCE_DATA)->getDims();
+    const auto dstDims = getChildEdgeAt(0)->getDims();
+    const auto axesDims = getParentEdgeAt(REDUCE_INDEXES)->getDims().ToSizeVector();
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    config.inConfs.resize(2);
+    config.outConfs.resize(1);
+    config.inConfs[REDUCE_DATA].constant = false;
+    config.inConfs[REDUCE_INDEXES].constant = false;
+    config.outConfs[0].constant = false;
+    config.inConfs[REDUCE_DATA].inPlace = -1;
+    config.inConfs[REDUCE_INDEXES].inPlace = -1;
+    config.outConfs[0].inPlace = -1;
+    config.inConfs[REDUCE_INDEXES].desc = TensorDesc(Precision::I32, axesDims, TensorDesc::getLayoutByDims(axesDims));
+
+    auto pushDesc = [&](const TensorDesc &inDesc, const TensorDesc &outDesc, memory::format format) {
+        config.inConfs[REDUCE_DATA].desc = inDesc;
+        config.outConfs[0].desc = outDesc;
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, format});
+    };
+
+    // channel blocks are reduced by the kernel only if there is no channel tail among the reduced values
+    if (jit_mode && const_axes && keep_dims && (srcDims.ndims() == 4 || srcDims.ndims() == 5)) {
+        const bool use_blk16 = mayiuse(cpu::avx512_common);
+        const auto axes = normalizeAxes(raw_axes);
+        const bool channel_reduced = std::find(axes.begin(), axes.end(), 1) != axes.end();
+        if (!channel_reduced || srcDims[1] % (use_blk16 ? 16 : 8) == 0) {
+            memory::format format = srcDims.ndims() == 4 ? (use_blk16 ? memory::nChw16c : memory::nChw8c)
+                                                         : (use_blk16 ? memory::nCdhw16c : memory::nCdhw8c);
+            pushDesc(MKLDNNMemoryDesc(srcDims, inputDataType, format), MKLDNNMemoryDesc(dstDims, outputDataType, format), format);
+        }
+    }
+
+    pushDesc(TensorDesc(inputPrecision, srcDims.ToSizeVector(), TensorDesc::getLayoutByDims(srcDims.ToSizeVector())),
+             TensorDesc(outputPrecision, dstDims.ToSizeVector(), TensorDesc::getLayoutByDims(dstDims.ToSizeVector())),
+             MKLDNNMemory::GetPlainFormat(dstDims));
+}
+
+void MKLDNNReduceNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
+    int blob_idx = 0;
+    mkldnn::post_ops ops;
+
+    for (auto &node : fusedWith) {
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
+        if (quantizeNode) {
+            quantizeNode->appendPostOps(ops);
+            continue;
+        }
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            if (initWeights) {
+                auto* depthwiseLayer = reinterpret_cast<WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+                const auto& dstDims = getChildEdgeAt(0)->getDims();
+                ptrdiff_t channels = dstDims.ndims() > 1 ? dstDims[1] : 1;
+                MKLDNNDims depthwiseDims({static_cast<ptrdiff_t>(rnd_up(channels, 16))});
+
+                PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                PostOpsIntBlobMemory[blob_idx]->Create(depthwiseDims, memory::data_type::f32, memory::format::x);
+
+                PostOpsIntBlobMemory[blob_idx]->SetData(memory::data_type::f32, memory::x,
+                                                        depthwiseLayer->_weights->buffer(),
+                                                        depthwiseLayer->_weights->size() *
+                                                        MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                if (depthwiseNode->isBroadcast()) {
+                    float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[0];
+                    for (int i = 1; i < PostOpsIntBlobMemory[blob_idx]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                        static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[i] = broadcastValue;
+                    }
+                }
+
+                if (depthwiseNode->getAlgorithm() == depthwise_scale_shift) {
+                    PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                    PostOpsIntBlobMemory[blob_idx + 1]->Create(depthwiseDims, memory::data_type::f32,
+                                                               memory::format::x);
+                    PostOpsIntBlobMemory[blob_idx + 1]->SetData(memory::data_type::f32, memory::x,
+                                                                depthwiseLayer->_biases->buffer(),
+                                                                depthwiseLayer->_biases->size() *
+                                                                MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                    if (depthwiseNode->isBroadcast()) {
+                        float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[0];
+                        for (int i = 1; i < PostOpsIntBlobMemory[blob_idx + 1]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                            static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[i] = broadcastValue;
+                        }
+                    }
+
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx + 1]->GetData());
+
+                    blob_idx += 2;
+                } else {
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         nullptr);
+
+                    blob_idx += 1;
+                }
+            } else {
+                ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                     nullptr,
+                                     nullptr);
+            }
+
+            continue;
+        }
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(), activationNode->getBeta());
+
+            continue;
+        }
+
+        THROW_IE_EXCEPTION << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
+    }
+
+    attr.set_post_ops(ops);
+}
+
+void MKLDNNReduceNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(REDUCE_DATA)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    const auto& srcDesc = selectedPD->getConfig().inConfs[REDUCE_DATA].desc;
+    planar_layout = srcDesc.getBlockingDesc().getBlockDims().size() == srcDesc.getDims().size();
+
+    if (jit_mode) {
+        auto jcp = jit_reduce_config_params();
+        jcp.reduce_mode = reduceMode;
+        jcp.planar_layout = planar_layout;
+        jcp.src_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(srcDesc.getPrecision());
+        jcp.dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().outConfs[0].desc.getPrecision());
+        jcp.src_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.src_dt);
+        jcp.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.dst_dt);
+
+        // the post kernel embeds post ops of fused nodes, so only the accumulation kernel is shared
+        JitKernelKey key("reduce");
+        key << jcp.reduce_mode << jcp.planar_layout << jcp.src_dt << jcp.dst_dt << jcp.src_data_size << jcp.dst_data_size;
+        auto &cache = MKLDNNJitKernelCache::instance();
+        if (mayiuse(cpu::avx512_common)) {
+            reduce_kernel = cache.findOrCreate<jit_uni_reduce_kernel>(key, [&] {
+                return new jit_uni_reduce_kernel_f32<cpu::avx512_common>(jcp);
+            });
+            reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
+        } else if (mayiuse(cpu::avx2)) {
+            reduce_kernel = cache.findOrCreate<jit_uni_reduce_kernel>(key, [&] {
+                return new jit_uni_reduce_kernel_f32<cpu::avx2>(jcp);
+            });
+            reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+        } else if (mayiuse(cpu::sse42)) {
+            reduce_kernel = cache.findOrCreate<jit_uni_reduce_kernel>(key, [&] {
+                return new jit_uni_reduce_kernel_f32<cpu::sse42>(jcp);
+            });
+            reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::sse42>(jcp, *attr.get()));
+        }
+    }
+
+    if (const_axes)
+        prepareParams(normalizeAxes(raw_axes));
+}
+
+std::vector<int> MKLDNNReduceNode::normalizeAxes(const std::vector<int> &axes) const {
+    const int rank = getParentEdgeAt(REDUCE_DATA)->getDims().ndims();
+    std::vector<int> normalized;
+    for (int axis : axes) {
+        if (axis < 0)
+            axis += rank;
+        if (axis < 0 || axis >= rank)
+            THROW_IE_EXCEPTION << "Reduce node with name '" << getName() << "' has axis which exceeds data tensor dimension";
+        normalized.push_back(axis);
+    }
+    return normalized;
+}
+
+void MKLDNNReduceNode::prepareParams(const std::vector<int> &axes) {
+    const auto srcDesc = getParentEdgeAt(REDUCE_DATA)->getDesc();
+    const auto dstDesc = getChildEdgeAt(0)->getDesc();
+    const auto& srcDims = srcDesc.getDims();
+    const auto& blockDims = srcDesc.getBlockingDesc().getBlockDims();
+    const auto& order = srcDesc.getBlockingDesc().getOrder();
+    const auto& srcStrides = srcDesc.getBlockingDesc().getStrides();
+    const auto& dstStrides = dstDesc.getBlockingDesc().getStrides();
+
+    std::vector<bool> reducedAxes(srcDims.size(), false);
+    for (int axis : axes)
+        reducedAxes[axis] = true;
+
+    divisor = 1.f;
+    for (size_t i = 0; i < srcDims.size(); i++) {
+        if (reducedAxes[i])
+            divisor *= srcDims[i];
+    }
+
+    // the source is walked in its physical order, dimensions of size 1 are skipped and neighbours which are
+    // dense in both tensors and are either both kept or both reduced are merged
+    std::vector<ReduceDim> dims;
+    for (size_t i = 0; i < blockDims.size(); i++) {
+        const size_t axis = order[i];
+        ReduceDim dim = {blockDims[i], srcStrides[i], 0, reducedAxes[axis]};
+        if (!dim.reduced) {
+            // without keep_dims the destination is planar and has no reduced axes
+            size_t dst_idx = keep_dims ? i : i - std::count(reducedAxes.begin(), reducedAxes.begin() + axis, true);
+            dim.dst_stride = dstStrides[dst_idx];
+        }
+        if (dim.size == 1)
+            continue;
+
+        if (!dims.empty()) {
+            auto& last = dims.back();
+            if (last.reduced == dim.reduced && last.src_stride == dim.src_stride * dim.size &&
+                last.dst_stride == dim.dst_stride * dim.size) {
+                last.size *= dim.size;
+                last.src_stride = dim.src_stride;
+                last.dst_stride = dim.dst_stride;
+                continue;
+            }
+        }
+        dims.push_back(dim);
+    }
+
+    // the kernel walks over the inner dimension, it has to be dense
+    if (dims.empty() || dims.back().src_stride != 1 || (!dims.back().reduced && dims.back().dst_stride != 1))
+        dims.push_back({1, 1, 1, false});
+
+    reduce_inner = dims.back().reduced;
+    work_amount = dims.back().size;
+    dims.pop_back();
+
+    // the innermost of the remaining reduced dimensions is the strided loop of the kernel
+    outer_amount = 1;
+    outer_stride = 0;
+    for (size_t i = dims.size(); i-- > 0;) {
+        if (dims[i].reduced) {
+            outer_amount = dims[i].size;
+            outer_stride = dims[i].src_stride;
+            dims.erase(dims.begin() + i);
+            break;
+        }
+    }
+
+    kept_dims.clear();
+    reduced_dims.clear();
+    for (const auto& dim : dims)
+        (dim.reduced ? reduced_dims : kept_dims).push_back(dim);
+
+    const auto& dstBlockDims = dstDesc.getBlockingDesc().getBlockDims();
+    dst_size = dstBlockDims.empty() || dstStrides.empty() ? 1 : dstBlockDims[0] * dstStrides[0];
+
+    if (jit_mode && output_prec != Precision::FP32)
+        acc_buffer.resize(dst_size);
+
+    size_t kept_amount = 1;
+    for (const auto& dim : kept_dims)
+        kept_amount *= dim.size;
+    const size_t nthr = parallel_get_max_threads();
+    if (jit_mode && reduce_inner && kept_amount < nthr)
+        partial_buffer.resize(nthr * kept_amount);
+
+    params_ready = true;
+}
+
+void MKLDNNReduceNode::offsets_of(const std::vector<ReduceDim> &dims, size_t index, size_t &src_off, size_t &dst_off) const {
+    src_off = 0;
+    dst_off = 0;
+    for (size_t i = dims.size(); i-- > 0;) {
+        size_t idx = index % dims[i].size;
+        index /= dims[i].size;
+        src_off += idx * dims[i].src_stride;
+        dst_off += idx * dims[i].dst_stride;
+    }
+}
+
+float MKLDNNReduceNode::reduce_identity() const {
+    return reduce_identity_value(reduceMode);
+}
+
+float MKLDNNReduceNode::reduce_combine(float x, float y) const {
+    switch (reduceMode) {
+        case ReduceMode::Max:
+        case ReduceMode::Or:
+            return std::max(x, y);
+        case ReduceMode::Min:
+        case ReduceMode::And:
+            return std::min(x, y);
+        case ReduceMode::Prod:
+            return x * y;
+        default:
+            return x + y;
+    }
+}
+
+void MKLDNNReduceNode::execute(mkldnn::stream strm) {
+    auto &srcMemPtr = getParentEdgeAt(REDUCE_DATA)->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const uint8_t *src_ptr = reinterpret_cast<const uint8_t*>(srcMemPtr->GetData()) +
+            srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding *
+            MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(srcMemPtr->GetDescriptor().data.data_type));
+    uint8_t *dst_ptr = reinterpret_cast<uint8_t*>(dstMemPtr->GetData()) +
+            dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding *
+            MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(dstMemPtr->GetDescriptor().data.data_type));
+
+    if (!const_axes) {
+        auto &axesMemPtr = getParentEdgeAt(REDUCE_INDEXES)->getMemoryPtr();
+        const int32_t *axes_data = reinterpret_cast<const int32_t*>(axesMemPtr->GetData()) +
+                axesMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+        const size_t axes_num = getParentEdgeAt(REDUCE_INDEXES)->getDims().size();
+        if (!params_ready || raw_axes.size() != axes_num || !std::equal(raw_axes.begin(), raw_axes.end(), axes_data)) {
+            raw_axes.assign(axes_data, axes_data + axes_num);
+            prepareParams(normalizeAxes(raw_axes));
+        }
+    }
+
+    if (jit_mode) {
+        float *acc_data = output_prec == Precision::FP32 ? reinterpret_cast<float *>(dst_ptr) : acc_buffer.data();
+        reduce_jit(src_ptr, acc_data);
+        reduce_post(acc_data, dst_ptr);
+        zero_channel_tail(dst_ptr);
+    } else if (input_prec == Precision::I32) {
+        auto src_data = reinterpret_cast<const int32_t *>(src_ptr);
+        if (output_prec == Precision::FP32)
+            reduce_ref<int32_t, float>(src_data, reinterpret_cast<float *>(dst_ptr));
+        else
+            reduce_ref<int32_t, int32_t>(src_data, reinterpret_cast<int32_t *>(dst_ptr));
+    } else {
+        reduce_ref<float, float>(reinterpret_cast<const float *>(src_ptr), reinterpret_cast<float *>(dst_ptr));
+    }
+}
+
+void MKLDNNReduceNode::reduce_jit(const uint8_t *src_data, float *acc_data) {
+    const float identity = reduce_identity();
+    parallel_for(dst_size, [&](size_t i) {
+        acc_data[i] = identity;
+    });
+
+    size_t kept_amount = 1, reduced_amount = 1;
+    for (const auto& dim : kept_dims)
+        kept_amount *= dim.size;
+    for (const auto& dim : reduced_dims)
+        reduced_amount *= dim.size;
+
+    auto reduce_block = [&](size_t src_off, float *acc, size_t work, size_t outer) {
+        for (size_t r = 0; r < reduced_amount; r++) {
+            size_t r_src_off, r_dst_off;
+            offsets_of(reduced_dims, r, r_src_off, r_dst_off);
+
+            auto arg = jit_reduce_call_args();
+            arg.src = src_data + (src_off + r_src_off) * src_data_size;
+            arg.dst = acc;
+            arg.work_amount = work;
+            arg.outer_amount = outer;
+            arg.src_stride = outer_stride * src_data_size;
+            arg.reduce_inner = reduce_inner;
+            (*reduce_kernel)(&arg);
+        }
+    };
+
+    const size_t nthr = parallel_get_max_threads();
+    if (!reduce_inner) {
+        // the kept inner dimension is split into chunks if there are not enough outputs for all threads
+        const size_t simd_size = 16;
+        size_t chunk = work_amount;
+        if (kept_amount < nthr)
+            chunk = std::max(simd_size, rnd_up(div_up(work_amount * kept_amount, nthr), simd_size));
+        const size_t chunks = div_up(work_amount, chunk);
+
+        parallel_for2d(kept_amount, chunks, [&](size_t k, size_t c) {
+            size_t src_off, dst_off;
+            offsets_of(kept_dims, k, src_off, dst_off);
+            const size_t start = c * chunk;
+            reduce_block(src_off + start, acc_data + dst_off + start, std::min(chunk, work_amount - start), outer_amount);
+        });
+    } else if (kept_amount >= nthr || partial_buffer.size() < nthr * kept_amount) {
+        parallel_for(kept_amount, [&](size_t k) {
+            size_t src_off, dst_off;
+            offsets_of(kept_dims, k, src_off, dst_off);
+            reduce_block(src_off, acc_data + dst_off, work_amount, outer_amount);
+        });
+    } else {
+        // few outputs: every thread reduces its part of the values into partial results
+        std::fill_n(partial_buffer.begin(), nthr * kept_amount, identity);
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            float *partial = &partial_buffer[ithr * kept_amount];
+            const bool split_outer = outer_amount >= static_cast<size_t>(nthr);
+            size_t start = 0, end = 0;
+            splitter(split_outer ? outer_amount : work_amount, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            for (size_t k = 0; k < kept_amount; k++) {
+                size_t src_off, dst_off;
+                offsets_of(kept_dims, k, src_off, dst_off);
+                if (split_outer)
+                    reduce_block(src_off + start * outer_stride, partial + k, work_amount, end - start);
+                else
+                    reduce_block(src_off + start, partial + k, end - start, outer_amount);
+            }
+        });
+
+        for (size_t k = 0; k < kept_amount; k++) {
+            size_t src_off, dst_off;
+            offsets_of(kept_dims, k, src_off, dst_off);
+            float value = identity;
+            for (size_t ithr = 0; ithr < nthr; ithr++)
+                value = reduce_combine(value, partial_buffer[ithr * kept_amount + k]);
+            acc_data[dst_off] = value;
+        }
+    }
+
+    if (reduceMode == ReduceMode::LogSum || reduceMode == ReduceMode::LogSumExp) {
+        parallel_for(dst_size, [&](size_t i) {
+            acc_data[i] = logf(acc_data[i]);
+        });
+    }
+}
+
+void MKLDNNReduceNode::reduce_post(float *acc_data, uint8_t *dst_data) {
+    const bool with_post_ops = attr.get()->post_ops_.len_ != 0;
+    if (!with_post_ops && output_prec == Precision::FP32 && reduceMode != ReduceMode::L2 && reduceMode != ReduceMode::Mean)
+        return;
+
+    auto call = [&](size_t off, size_t work, size_t oc_off) {
+        auto arg = jit_reduce_call_args();
+        arg.src = acc_data + off;
+        arg.dst = dst_data + off * dst_data_size;
+        arg.divisor = &divisor;
+        arg.work_amount = work;
+        arg.oc_off = oc_off;
+        (*reduce_post_kernel)(&arg);
+    };
+
+    const auto dstDesc = getChildEdgeAt(0)->getDesc();
+    const auto& dstDims = dstDesc.getDims();
+    if (!planar_layout) {
+        const auto& blockDims = dstDesc.getBlockingDesc().getBlockDims();
+        const size_t blk_size = blockDims.back();
+        const size_t CB = blockDims[1];
+        const size_t spatial = dst_size / (blockDims[0] * CB * blk_size);
+        parallel_for2d(blockDims[0], CB, [&](size_t n, size_t cb) {
+            call((n * CB + cb) * spatial * blk_size, spatial, cb * blk_size * sizeof(float));
+        });
+    } else if (with_post_ops && dstDims.size() > 1) {
+        const size_t C = dstDims[1];
+        const size_t spatial = dst_size / (dstDims[0] * C);
+        parallel_for2d(dstDims[0], C, [&](size_t n, size_t c) {
+            call((n * C + c) * spatial, spatial, c * sizeof(float));
+        });
+    } else {
+        const size_t chunk = 256;
+        parallel_for(div_up(dst_size, chunk), [&](size_t i) {
+            call(i * chunk, std::min(chunk, dst_size - i * chunk), 0);
+        });
+    }
+}
+
+// padded lanes of the last channel block were reduced from padding and passed through post ops, but blocked
+// consumers rely on them being zero
+void MKLDNNReduceNode::zero_channel_tail(uint8_t *dst_data) {
+    if (planar_layout)
+        return;
+
+    const auto dstDesc = getChildEdgeAt(0)->getDesc();
+    const auto& blockDims = dstDesc.getBlockingDesc().getBlockDims();
+    const size_t blk_size = blockDims.back();
+    const size_t tail = dstDesc.getDims()[1] % blk_size;
+    if (tail == 0)
+        return;
+
+    const size_t CB = blockDims[1];
+    const size_t spatial = dst_size / (blockDims[0] * CB * blk_size);
+    parallel_for2d(blockDims[0], spatial, [&](size_t n, size_t s) {
+        const size_t off = ((n * CB + CB - 1) * spatial + s) * blk_size + tail;
+        std::memset(dst_data + off * dst_data_size, 0, (blk_size - tail) * dst_data_size);
+    });
+}
+
+template <typename src_t, typename dst_t>
+void MKLDNNReduceNode::reduce_ref(const src_t *src_data, dst_t *dst_data) {
+    switch (reduceMode) {
+        case ReduceMode::And:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(1),
+                            [](dst_t x, src_t y)->dst_t { return x && y; });
+            break;
+        case ReduceMode::L1:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t old, src_t y)->dst_t { return old + (std::abs)(y); });
+            break;
+        case ReduceMode::L2:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t old, src_t y)->dst_t { return old + y * y; });
+            parallel_for(dst_size, [&](size_t i) {
+                dst_data[i] = sqrt(dst_data[i]);
+            });
+            break;
+        case ReduceMode::LogSum:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t x, src_t y)->dst_t { return x + y; });
+            parallel_for(dst_size, [&](size_t i) {
+                dst_data[i] = logf(dst_data[i]);
+            });
+            break;
+        case ReduceMode::LogSumExp:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t old, src_t y)->dst_t { return old + expf(y); });
+            parallel_for(dst_size, [&](size_t i) {
+                dst_data[i] = logf(dst_data[i]);
+            });
+            break;
+        case ReduceMode::Max:
+            reduce_ref_loop(src_data, dst_data, std::numeric_limits<dst_t>::lowest(),
+                            [](dst_t x, src_t y)->dst_t { return x > y ? x : y; });
+            break;
+        case ReduceMode::Mean:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t x, src_t y)->dst_t { return x + y; });
+            parallel_for(dst_size, [&](size_t i) {
+                dst_data[i] /= static_cast<dst_t>(divisor);
+            });
+            break;
+        case ReduceMode::Min:
+            reduce_ref_loop(src_data, dst_data, (std::numeric_limits<dst_t>::max)(),
+                            [](dst_t x, src_t y)->dst_t { return x < y ? x : y; });
+            break;
+        case ReduceMode::Or:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t x, src_t y)->dst_t { return x || y; });
+            break;
+        case ReduceMode::Prod:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(1),
+                            [](dst_t x, src_t y)->dst_t { return x * y; });
+            break;
+        case ReduceMode::Sum:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t x, src_t y)->dst_t { return x + y; });
+            break;
+        case ReduceMode::SumSquare:
+            reduce_ref_loop(src_data, dst_data, static_cast<dst_t>(0),
+                            [](dst_t old, src_t y)->dst_t { return old + y * y; });
+            break;
+    }
+}
+
+template <typename src_t, typename dst_t, typename F>
+void MKLDNNReduceNode::reduce_ref_loop(const src_t *src_data, dst_t *dst_data, dst_t init_value, F func) {
+    size_t kept_amount = 1, reduced_amount = 1;
+    for (const auto& dim : kept_dims)
+        kept_amount *= dim.size;
+    for (const auto& dim : reduced_dims)
+        reduced_amount *= dim.size;
+
+    const size_t inner_kept = reduce_inner ? 1 : work_amount;
+    const size_t inner_reduced = reduce_inner ? work_amount : 1;
+
+    parallel_for2d(kept_amount, inner_kept, [&](size_t k, size_t i) {
+        size_t src_off, dst_off;
+        offsets_of(kept_dims, k, src_off, dst_off);
+
+        dst_t value = init_value;
+        for (size_t r = 0; r < reduced_amount; r++) {
+            size_t r_src_off, r_dst_off;
+            offsets_of(reduced_dims, r, r_src_off, r_dst_off);
+            const src_t *src = src_data + src_off + r_src_off + i;
+            for (size_t o = 0; o < outer_amount; o++) {
+                for (size_t j = 0; j < inner_reduced; j++)
+                    value = func(value, src[o * outer_stride + j]);
+            }
+        }
+        dst_data[dst_off + i] = value;
+    });
+}
+
+bool MKLDNNReduceNode::created() const {
+    return getType() == Reduce;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNReduceNode, Reduce);
@@ -0,0 +1,146 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+enum class ReduceMode { And, L1, L2, LogSum, LogSumExp, Max, Mean, Min, Or, Prod, Sum, SumSquare };
+
+struct jit_reduce_config_params {
+    ReduceMode reduce_mode;
+    bool planar_layout;
+    mkldnn::memory::data_type src_dt;
+    mkldnn::memory::data_type dst_dt;
+    int src_data_size;
+    int dst_data_size;
+};
+
+struct jit_reduce_call_args {
+    const void *src;
+    void *dst;
+    const float *divisor;
+    size_t work_amount;
+    size_t outer_amount;
+    size_t src_stride;
+    size_t reduce_inner;
+    size_t oc_off;
+};
+
+// Accumulates src into the fp32 dst: dst[i] op= f(src[o * src_stride + i]) for o < outer_amount, i < work_amount
+// when the inner dimension is kept, or dst[0] op= f(src[o * src_stride + i]) over both loops when it is reduced
+struct jit_uni_reduce_kernel {
+    void (*ker_)(const jit_reduce_call_args *);
+
+    void operator()(const jit_reduce_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reduce_kernel(jit_reduce_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_reduce_kernel() {}
+
+    jit_reduce_config_params jcp_;
+};
+
+// Finalizes the fp32 accumulator (sqrt for L2, division for Mean), applies fused post ops and converts to dst precision
+struct jit_uni_reduce_post_kernel {
+    void (*ker_)(const jit_reduce_call_args *);
+
+    void operator()(const jit_reduce_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reduce_post_kernel(jit_reduce_config_params jcp, const mkldnn_primitive_attr &attr) : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_reduce_post_kernel() {}
+
+    jit_reduce_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
+class MKLDNNReduceNode : public MKLDNNNode {
+public:
+    MKLDNNReduceNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNReduceNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    bool created() const override;
+    void execute(mkldnn::stream strm) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    ReduceMode getReduceMode() const {
+        return reduceMode;
+    }
+
+private:
+    // Physical dimension of the source after dropping unit dimensions and merging contiguous ones
+    struct ReduceDim {
+        size_t size;
+        size_t src_stride;
+        size_t dst_stride;
+        bool reduced;
+    };
+
+    void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
+    std::vector<int> normalizeAxes(const std::vector<int> &axes) const;
+    void prepareParams(const std::vector<int> &axes);
+
+    void reduce_jit(const uint8_t *src_data, float *acc_data);
+    void reduce_post(float *acc_data, uint8_t *dst_data);
+    void zero_channel_tail(uint8_t *dst_data);
+    float reduce_identity() const;
+    float reduce_combine(float x, float y) const;
+    void offsets_of(const std::vector<ReduceDim> &dims, size_t index, size_t &src_off, size_t &dst_off) const;
+
+    template <typename src_t, typename dst_t>
+    void reduce_ref(const src_t *src_data, dst_t *dst_data);
+    template <typename src_t, typename dst_t, typename F>
+    void reduce_ref_loop(const src_t *src_data, dst_t *dst_data, dst_t init_value, F func);
+
+    const size_t REDUCE_DATA = 0;
+    const size_t REDUCE_INDEXES = 1;
+
+    ReduceMode reduceMode = ReduceMode::Sum;
+    bool keep_dims = true;
+    bool const_axes = false;
+    bool jit_mode = false;
+    bool planar_layout = true;
+    bool params_ready = false;
+    std::vector<int> raw_axes;
+
+    InferenceEngine::Precision input_prec, output_prec;
+    size_t src_data_size = 0, dst_data_size = 0;
+
+    // dimensions iterated outside of the kernel: kept ones in parallel, reduced ones sequentially
+    std::vector<ReduceDim> kept_dims;
+    std::vector<ReduceDim> reduced_dims;
+    size_t work_amount = 1;
+    size_t outer_amount = 1;
+    size_t outer_stride = 0;
+    bool reduce_inner = false;
+    size_t dst_size = 1;
+    float divisor = 1.f;
+
+    std::vector<float> acc_buffer;
+    std::vector<float> partial_buffer;
+
+    mkldnn::primitive_attr attr;
+    std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
+
+    std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
+    std::shared_ptr<jit_uni_reduce_post_kernel> reduce_post_kernel;
+};
+
+}  // namespace MKLDNNPlugin
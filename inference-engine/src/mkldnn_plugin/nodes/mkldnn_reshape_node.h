@@ -21,6 +21,9 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    bool isExecutable() const override {
+        return false;
+    }
 };
 
 }  // namespace MKLDNNPlugin
@@ -500,17 +500,17 @@ void MKLDNNRNN::createPrimitive() {
             /* Workspace     */ workspace_mem->GetPrimitive());
 
     prim.reset(p);
+
+    exec_primitives.clear();
+    for (auto &reorder : exec_before)
+        exec_primitives.push_back(reorder.get());
+    exec_primitives.push_back(p->get());
+    for (auto &reorder : exec_after)
+        exec_primitives.push_back(reorder.get());
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
-    if (!exec_before.empty())
-        strm.submit({exec_before.begin(), exec_before.end()});
-
-    if (prim)
-        strm.submit({*prim});
-
-    if (!exec_after.empty())
-        strm.submit({exec_after.begin(), exec_after.end()});
+    MKLDNNPrimitive::submit(strm, exec_primitives);
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNRNN, RNN);
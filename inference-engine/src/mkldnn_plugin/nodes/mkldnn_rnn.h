@@ -68,6 +68,9 @@ private:
     // List of in/out reorders if required
     std::vector<mkldnn::reorder> exec_before;
     std::vector<mkldnn::reorder> exec_after;
+
+    // exec_before, rnn primitive and exec_after prepared for submission on every inference
+    std::vector<mkldnn_primitive_t> exec_primitives;
 };
 
 }  // namespace MKLDNNPlugin
@@ -22,7 +22,10 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
-    bool isOptimized();
+    bool isOptimized() const;
+    bool isExecutable() const override {
+        return !isOptimized();
+    }
     void initOptimalPrimitiveDescriptor() override;
 
     void setDynamicBatchLim(int lim) override;
@@ -112,10 +112,10 @@ public:
             chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
                     chunk_offset_in_byte + chunk_stride_in_byte * n_iter);
 
-            strm.submit({reorders.begin(), reorders.end()});
+            submit(strm);
         } else {
             if (as_input ? n_iter == 0 : n_iter == (iter_count - 1))
-                strm.submit({reorders.begin(), reorders.end()});
+                submit(strm);
         }
     };
 
@@ -144,7 +144,7 @@ public:
 
     void execute(int n_iter, mkldnn::stream strm) override {
         if (n_iter < iter_count - 1) {
-            strm.submit({reorders.begin(), reorders.end()});
+            submit(strm);
         }
     };
 };
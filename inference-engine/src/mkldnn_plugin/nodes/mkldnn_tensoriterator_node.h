@@ -18,6 +18,11 @@ public:
     virtual ~PortMapHelper() = default;
     virtual void execute(int n_iter, mkldnn::stream strm) = 0;
 protected:
+    void submit(mkldnn::stream& strm) {
+        for (const auto &reorder : reorders)
+            MKLDNNPrimitive::submit(strm, reorder);
+    }
+
     std::vector<mkldnn::reorder> reorders;
     std::vector<mkldnn::memory> mem_holder;
     int iter_count;
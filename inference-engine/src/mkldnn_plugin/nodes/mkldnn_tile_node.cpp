@@ -7,10 +7,12 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "jit_generator.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
 
 MKLDNNTileNode::MKLDNNTileNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
         MKLDNNNode(layer, eng, cache) {}
@@ -71,6 +73,16 @@ void MKLDNNTileNode::initSupportedPrimitiveDescriptors() {
     config.outConfs[0].constant = false;
     config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
     supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, fmt});
+
+    // Channel blocks are copied as a whole unless the channels themselves are tiled
+    if ((inDims.ndims() == 4 || inDims.ndims() == 5) && axis != 1) {
+        const bool use_blk16 = mayiuse(avx512_common);
+        memory::format blk_fmt = inDims.ndims() == 4 ? (use_blk16 ? memory::nChw16c : memory::nChw8c)
+                                                     : (use_blk16 ? memory::nCdhw16c : memory::nCdhw8c);
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, blk_fmt);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, blk_fmt);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, blk_fmt});
+    }
 }
 
 void MKLDNNTileNode::createPrimitive() {
@@ -94,9 +106,18 @@ void MKLDNNTileNode::execute(mkldnn::stream strm) {
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-    int m_inner_dim = 1;
-    int m_outer_dim = 1;
+    // The blocked tensor is tiled as a planar one with the channel block as an extra innermost dimension
     memory::dims inDims = srcMemory.GetDims();
+    int blk_size = 1;
+    if (srcMemory.GetFormat() == memory::nChw8c || srcMemory.GetFormat() == memory::nCdhw8c)
+        blk_size = 8;
+    else if (srcMemory.GetFormat() == memory::nChw16c || srcMemory.GetFormat() == memory::nCdhw16c)
+        blk_size = 16;
+    if (blk_size > 1)
+        inDims[1] = div_up(inDims[1], blk_size);
+
+    int m_inner_dim = blk_size;
+    int m_outer_dim = 1;
     for (int i=0; i < axis; i++ ) m_outer_dim *= inDims[i];
     for (int i=axis; i < inDims.size(); i++ ) m_inner_dim *= inDims[i];
     if (axis > 0) {
@@ -107,23 +128,6 @@ void MKLDNNTileNode::execute(mkldnn::stream strm) {
         m_inner_dim *= batchToProcess();
     }
 
-    if (m_inner_dim == 1 && m_outer_dim % 8 == 0 && ((inDims.size() == 4 && srcMemory.GetFormat() == memory::nChw8c) ||
-            (inDims.size() == 5 && srcMemory.GetFormat() == memory::nCdhw8c))) {
-        /*
-         * We may enable tile processing directly to appropriate output format (nChw8c)
-         */
-        m_inner_dim *= 8;
-        m_outer_dim /= 8;
-    } else if (m_inner_dim == 1 && m_outer_dim % 16 == 0 &&
-            ((inDims.size() == 4 && srcMemory.GetFormat() == memory::nChw16c) ||
-            (inDims.size() == 5 && srcMemory.GetFormat() == memory::nCdhw16c))) {
-        /*
-         * We may enable tile processing directly to appropriate output format (nChw16c)
-         */
-        m_inner_dim *= 16;
-        m_outer_dim /= 16;
-    }
-
     for (int i = 0; i < m_outer_dim; ++i) {
         for (int t = 0; t < tiles; ++t) {
             memcpy(dst_ptr, src_ptr, m_inner_dim* sizeof(float));
@@ -5,10 +5,15 @@
 #include "base.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -54,40 +59,50 @@ public:
             if (padMode == CONSTANT)
                 pad_value = layer->GetParamAsFloat("pad_value", 0.f);
 
-            srcStrides = layer->insData[0].lock()->getTensorDesc().getBlockingDesc().getStrides();
-            dstStrides = layer->outData[0]->getTensorDesc().getBlockingDesc().getStrides();
-            work_amount = dst_dims[0] * dstStrides[0];
-            for (size_t i = 0; i < src_dims.size(); i++)
-                src_o_dms.push_back(src_dims[i] + pads_begin[i]);
-
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
+
+            // Channel blocks are moved as a whole, so the blocked layout is usable while channels are not padded
+            if ((src_dims.size() == 4 || src_dims.size() == 5) && pads_begin[1] == 0 && pads_end[1] == 0) {
+                ConfLayout blk_layout = mayiuse(avx512_common) ? ConfLayout::BLK16 : ConfLayout::BLK8;
+                addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        // The blocked tensor is iterated as a planar one with the channel block as an extra innermost
+        // dimension, which is never padded
+        const BlockingDesc& srcBlk = config.inConfs[0].desc.getBlockingDesc();
+        const BlockingDesc& dstBlk = config.outConfs[0].desc.getBlockingDesc();
+        src_dims = srcBlk.getBlockDims();
+        dst_dims = dstBlk.getBlockDims();
+        srcStrides = srcBlk.getStrides();
+        dstStrides = dstBlk.getStrides();
+        pads_begin.resize(src_dims.size(), 0);
+
+        src_o_dms.clear();
+        for (size_t i = 0; i < src_dims.size(); i++)
+            src_o_dms.push_back(src_dims[i] + pads_begin[i]);
+
+        work_amount = 1;
+        for (size_t i = 0; i + 1 < dst_dims.size(); i++)
+            work_amount *= dst_dims[i];
+        return OK;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src_data = inputs[0]->cbuffer().as<const float *>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         float* dst_data = outputs[0]->cbuffer().as<float *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
-        switch (padMode) {
-            case CONSTANT:
-                pad_constant(src_data, dst_data);
-                break;
-            case EDGE:
-                pad_edge(src_data, dst_data);
-                break;
-            case REFLECT:
-                pad_reflect(src_data, dst_data);
-                break;
-            case SYMMETRIC:
-                pad_symmetric(src_data, dst_data);
-                break;
-            default:
-                return GENERAL_ERROR;
-        }
+        pad(src_data, dst_data);
         return OK;
     }
 
@@ -99,10 +114,8 @@ private:
         SYMMETRIC = 3
     };
 
-    void pad_constant(const float *src_data, float* dst_data);
-    void pad_edge(const float *src_data, float* dst_data);
-    void pad_reflect(const float *src_data, float* dst_data);
-    void pad_symmetric(const float *src_data, float* dst_data);
+    int src_index(size_t dim, size_t counter) const;
+    void pad(const float *src_data, float* dst_data);
 
     PadMode padMode = CONSTANT;
     float pad_value = 0.f;
@@ -112,7 +125,8 @@ private:
     SizeVector src_o_dms;
     SizeVector srcStrides;
     SizeVector dstStrides;
-    size_t work_amount;
+    // number of innermost rows of dst
+    size_t work_amount = 0;
 };
 
 
@@ -132,120 +146,69 @@ inline void parallel_step(size_t size, std::vector<size_t> &counters, std::vecto
     }
 }
 
-void PadImpl::pad_constant(const float *src_data, float* dst_data) {
-    int offset = 0;
-    for (size_t i = 0; i < srcStrides.size(); ++i)
-        offset += pads_begin[i] * srcStrides[i];
-
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 1;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
-                dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < counters.size(); ++i) {
-                if (counters[i] < pads_begin[i] || counters[i] >= src_o_dms[i]) {
-                    dst_data[dstIdx] = pad_value;
-                    srcIdx = 0;
-                    break;
-                }
-            }
-            if (srcIdx) {
-                int srcIdx = 0;
-                for (size_t i = 0; i < srcStrides.size(); ++i)
-                    srcIdx += counters[i] * srcStrides[i];
-                dst_data[dstIdx] = src_data[srcIdx - offset];
-            }
-            parallel_step(dst_dims.size(), counters, dst_dims);
-        }
-    });
-}
-
-void PadImpl::pad_edge(const float *src_data, float* dst_data) {
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
-                dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? 0 :
-                    ((counters[i] >= src_o_dms[i]) ? (src_dims[i] - 1) : (counters[i] - pads_begin[i]));
-                srcIdx += idx * srcStrides[i];
-            }
-
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
-        }
-    });
+// Returns the source coordinate the dst coordinate is taken from along the dimension, -1 for the constant value
+int PadImpl::src_index(size_t dim, size_t counter) const {
+    const int begin = pads_begin[dim];
+    const int c = counter;
+    if (counter >= pads_begin[dim] && counter < src_o_dms[dim])
+        return c - begin;
+
+    const int last = src_dims[dim] - 1;
+    switch (padMode) {
+        case EDGE:
+            return (c < begin) ? 0 : last;
+        case REFLECT:
+            return (c < begin) ? (begin - c) : (2 * last + begin - c);
+        case SYMMETRIC:
+            return (c < begin) ? (begin - 1 - c) : (2 * last + 1 + begin - c);
+        default:
+            return -1;
+    }
 }
 
-void PadImpl::pad_reflect(const float *src_data, float* dst_data) {
-    SizeVector src_2;
-    for (size_t i = 0; i < src_dims.size(); i++)
-        src_2.push_back(src_dims[i] + src_o_dms[i] - 2);
+void PadImpl::pad(const float *src_data, float* dst_data) {
+    const size_t inner = dst_dims.size() - 1;
+    const size_t dst_row = dst_dims[inner];
+    const size_t src_row = src_dims[inner];
+    const size_t row_begin = pads_begin[inner];
+    const size_t row_end = src_o_dms[inner];
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
+        SizeVector counters(inner, 0);
         splitter(work_amount, nthr, ithr, start, end);
 
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
+        parallel_init(start, inner, counters, dst_dims);
         for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
+            size_t dstIdx = 0;
+            size_t srcIdx = 0;
+            bool inside = true;
+            for (size_t i = 0; i < inner; ++i) {
                 dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - counters[i]) :
-                    ((counters[i] >= src_o_dms[i]) ? (src_2[i] - counters[i]) : (counters[i] - pads_begin[i]));
-                srcIdx += idx * srcStrides[i];
+                int idx = src_index(i, counters[i]);
+                if (idx < 0)
+                    inside = false;
+                else
+                    srcIdx += idx * srcStrides[i];
             }
 
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
-        }
-    });
-}
-
-void PadImpl::pad_symmetric(const float *src_data, float* dst_data) {
-    SizeVector src_2;
-    for (size_t i = 0; i < src_dims.size(); i++)
-        src_2.push_back(src_dims[i] + src_o_dms[i] - 1);
-
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
-                dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - 1 - counters[i]) :
-                    ((counters[i] >= src_o_dms[i]) ? (src_2[i] - counters[i]) : (counters[i] - pads_begin[i]));
-                srcIdx += idx * srcStrides[i];
+            float *dst = dst_data + dstIdx;
+            if (!inside) {
+                std::fill_n(dst, dst_row, pad_value);
+            } else {
+                const float *src = src_data + srcIdx;
+                // for the blocked layout the whole row is a channel block, so only the copy is left
+                for (size_t j = 0; j < row_begin; ++j) {
+                    int idx = src_index(inner, j);
+                    dst[j] = idx < 0 ? pad_value : src[idx];
+                }
+                std::memcpy(dst + row_begin, src, src_row * sizeof(float));
+                for (size_t j = row_end; j < dst_row; ++j) {
+                    int idx = src_index(inner, j);
+                    dst[j] = idx < 0 ? pad_value : src[idx];
+                }
             }
-
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
+            parallel_step(inner, counters, dst_dims);
         }
     });
 }
@@ -11,6 +11,7 @@
 #include <ie_parallel.hpp>
 #include "jit_generator.hpp"
 #include "jit_uni_eltwise.hpp"
+#include <mkldnn_jit_kernel_cache.hpp>
 
 using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::utils;
@@ -180,14 +181,23 @@ public:
             mask = layer->GetParamAsInts("mask", {});
 
             block_size = 1;
+            // the kernel has no parameters, so all RegionYolo layers of the process share it
+            const MKLDNNPlugin::JitKernelKey key("region_yolo_logistic");
+            auto &cache = MKLDNNPlugin::MKLDNNJitKernelCache::instance();
             if (mayiuse(avx512_common)) {
-                logistic_kernel.reset(new jit_uni_logistic_kernel_f32<avx512_common>());
+                logistic_kernel = cache.findOrCreate<jit_uni_logistic_kernel>(key, [] {
+                    return new jit_uni_logistic_kernel_f32<avx512_common>();
+                });
                 block_size = 16;
             } else if (mayiuse(avx2)) {
-                logistic_kernel.reset(new jit_uni_logistic_kernel_f32<avx2>());
+                logistic_kernel = cache.findOrCreate<jit_uni_logistic_kernel>(key, [] {
+                    return new jit_uni_logistic_kernel_f32<avx2>();
+                });
                 block_size = 8;
             } else if (mayiuse(sse42)) {
-                logistic_kernel.reset(new jit_uni_logistic_kernel_f32<sse42>());
+                logistic_kernel = cache.findOrCreate<jit_uni_logistic_kernel>(key, [] {
+                    return new jit_uni_logistic_kernel_f32<sse42>();
+                });
                 block_size = 4;
             }
 
@@ -9,6 +9,9 @@
 #include <vector>
 #include <cassert>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -64,7 +67,7 @@ public:
             if (layer->outData[0]->getTensorDesc().getPrecision() != Precision::FP32)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect output precision. Only F32 is supported!";
 
-            int axis = layer->GetParamAsInt("axis", 1);
+            axis = layer->GetParamAsInt("axis", 1);
             if (axis < 0)
                 axis += dst_dims.size();
 
@@ -94,11 +97,34 @@ public:
             work_amount_dst = ownStrides[0] * own_dims[0];
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
+
+            // Channel blocks are moved as a whole unless the channels themselves are shuffled
+            if ((dst_dims.size() == 4 || dst_dims.size() == 5) && axis != 1) {
+                ConfLayout blk_layout = mayiuse(avx512_common) ? ConfLayout::BLK16 : ConfLayout::BLK8;
+                addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        // The channel block of a blocked tensor is the innermost dimension, so it is a part of the moved data
+        const SizeVector& dims = config.outConfs[0].desc.getBlockingDesc().getBlockDims();
+        own_dims[0] = 1;
+        for (int i = 0; i < axis; i++)
+            own_dims[0] *= dims[i];
+        dataLength = 1;
+        for (size_t i = axis + 1; i < dims.size(); i++)
+            dataLength *= dims[i];
+        work_amount_dst = ownStrides[0] * own_dims[0];
+        return OK;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src_data = inputs[0]->cbuffer().as<const float *>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -135,6 +161,7 @@ public:
     }
 
 private:
+    int axis = 1;
     size_t dataLength = 1;
     size_t work_amount_dst;
     size_t own_dims[CNTR_SIZE];
@@ -0,0 +1,100 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc_imp.hpp"
+
+#include <algorithm>
+#include "ie_parallel.hpp"
+#include "nodes/common/block_sparse_weights.h"
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+using MKLDNNPlugin::BlockSparseWeights;
+
+#if defined(HAVE_AVX512F)
+    constexpr size_t block_size = 16;
+    typedef __m512 vec_type_f;
+#elif defined(HAVE_AVX2)
+    constexpr size_t block_size = 8;
+    typedef __m256 vec_type_f;
+#elif defined(HAVE_SSE42)
+    constexpr size_t block_size = 4;
+    typedef __m128 vec_type_f;
+#endif
+
+// rows of src processed together, so every loaded weights column is used for several outputs
+constexpr size_t batch_tile = 4;
+
+void sparse_fc(const float* src, float* dst, const float* bias, const void* weights,
+               size_t batch, size_t outputs, size_t inputs) {
+    constexpr size_t kBlockSize = BlockSparseWeights::kBlockSize;
+    const BlockSparseWeights w(weights, outputs);
+    const size_t batch_tiles = (batch + batch_tile - 1) / batch_tile;
+
+    parallel_for2d(batch_tiles, w.blocks, [&](size_t bt, size_t block) {
+        const size_t b_start = bt * batch_tile;
+        const size_t b_count = std::min(batch_tile, batch - b_start);
+        const size_t o_start = block * kBlockSize;
+        const size_t o_count = std::min(kBlockSize, outputs - o_start);
+
+        // rows beyond the batch repeat the last one and are not stored, so the loops have constant bounds
+        const float* src_rows[batch_tile];
+        for (size_t b = 0; b < batch_tile; b++)
+            src_rows[b] = src + (b_start + std::min(b, b_count - 1)) * inputs;
+
+        float acc[batch_tile][kBlockSize];
+        for (size_t b = 0; b < batch_tile; b++) {
+            for (size_t o = 0; o < kBlockSize; o++)
+                acc[b][o] = (bias != nullptr && o < o_count) ? bias[o_start + o] : 0.f;
+        }
+
+        const int32_t* indices = w.indices;
+        const float* values = w.values;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        constexpr size_t vecs = kBlockSize / block_size;
+        vec_type_f vacc[batch_tile][vecs];
+        for (size_t b = 0; b < batch_tile; b++) {
+            for (size_t v = 0; v < vecs; v++)
+                vacc[b][v] = _mm_uni_loadu_ps(acc[b] + v * block_size);
+        }
+        for (int32_t c = w.offsets[block]; c < w.offsets[block + 1]; c++) {
+            vec_type_f vweights[vecs];
+            for (size_t v = 0; v < vecs; v++)
+                vweights[v] = _mm_uni_loadu_ps(values + c * kBlockSize + v * block_size);
+            for (size_t b = 0; b < batch_tile; b++) {
+                const vec_type_f vsrc = _mm_uni_set1_ps(src_rows[b][indices[c]]);
+                for (size_t v = 0; v < vecs; v++)
+                    vacc[b][v] = _mm_uni_add_ps(vacc[b][v], _mm_uni_mul_ps(vweights[v], vsrc));
+            }
+        }
+        for (size_t b = 0; b < batch_tile; b++) {
+            for (size_t v = 0; v < vecs; v++)
+                _mm_uni_storeu_ps(acc[b] + v * block_size, vacc[b][v]);
+        }
+#else
+        for (int32_t c = w.offsets[block]; c < w.offsets[block + 1]; c++) {
+            const float* column = values + c * kBlockSize;
+            for (size_t b = 0; b < batch_tile; b++) {
+                const float value = src_rows[b][indices[c]];
+                for (size_t o = 0; o < kBlockSize; o++)
+                    acc[b][o] += column[o] * value;
+            }
+        }
+#endif
+        for (size_t b = 0; b < b_count; b++)
+            std::copy(acc[b], acc[b] + o_count, dst + (b_start + b) * outputs + o_start);
+    });
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,23 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * Computes dst[b][o] = bias[o] + sum(weights[o][i] * src[b][i]) for batch rows of src with weights packed
+ * by MKLDNNPlugin::BlockSparseWeights::pack, bias may be nullptr
+ */
+void sparse_fc(const float* src, float* dst, const float* bias, const void* weights,
+               size_t batch, size_t outputs, size_t inputs);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -10,6 +10,9 @@
 #include <cassert>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -144,6 +147,15 @@ public:
                 addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN),
                                    DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
             }
+
+            // Channel blocks are copied as a whole, so the blocked layout is usable while channels are taken entirely
+            if (isChannelKept(layer, new_axis, ellipsis_mask_counter)) {
+                ConfLayout blk_layout = mayiuse(avx512_common) ? ConfLayout::BLK16 : ConfLayout::BLK8;
+                std::vector<DataConfigurator> in_l = { DataConfigurator(blk_layout) };
+                for (size_t port = 1; port < layer->insData.size(); port++)
+                    in_l.push_back(DataConfigurator(ConfLayout::PLN));
+                addConfig(layer, in_l, { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -230,7 +242,10 @@ public:
                 return PARAMETER_MISMATCH;
         }
 
-        if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0 &&
+        if (inputs[STRIDEDSLICE_DATA]->getTensorDesc().getBlockingDesc().getBlockDims().size() > src_dims.size())
+            strided_slice_blk(src_data, dst_data, srcStrides,
+                              outputs[0]->getTensorDesc().getBlockingDesc().getBlockDims(), dstStrides);
+        else if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0 &&
                 stride_dms[stride_dms.size()-1] == 1 && stride_dms.size() > 1)
             strided_slice_vp(src_data, dst_data);
         else if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0)
@@ -247,7 +262,10 @@ private:
     const size_t STRIDEDSLICE_END = 2;
     const size_t STRIDEDSLICE_STRIDE = 3;
 
+    bool isChannelKept(const CNNLayer* layer, int new_axis, size_t ellipsis_mask_counter) const;
     void strided_slice(const float *src_data, float* dst_data, std::vector<size_t> &dims);
+    void strided_slice_blk(const float *src_data, float* dst_data, const SizeVector &srcBlkStrides,
+                           const SizeVector &dstBlkDims, const SizeVector &dstBlkStrides);
     void strided_slice_vp(const float *src_data, float* dst_data);
     void strided_slice_p(const float *src_data, float* dst_data);
 
@@ -274,6 +292,34 @@ private:
     int ellipsis_pos1, ellipsis_pos2;
 };
 
+bool StridedSliceImpl::isChannelKept(const CNNLayer* layer, int new_axis, size_t ellipsis_mask_counter) const {
+    if ((src_dims.size() != 4 && src_dims.size() != 5) || new_axis || shrink_axis || ellipsis_mask_counter)
+        return false;
+
+    // begin, end and strides have to be known before the inference to check the channel dimension
+    auto constInput = [&](size_t port, std::vector<int> &values) {
+        if (layer->insData.size() <= port)
+            return true;
+        auto creator = layer->insData[port].lock()->getCreatorLayer().lock();
+        if (!creator || creator->type != "Const" || creator->blobs.find("custom") == creator->blobs.end())
+            return false;
+        auto blob = creator->blobs.at("custom");
+        const int *data = blob->cbuffer().as<const int *>() + blob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        values.assign(data, data + blob->size());
+        return true;
+    };
+
+    std::vector<int> begin, end, stride;
+    if (!constInput(STRIDEDSLICE_BEGIN, begin) || !constInput(STRIDEDSLICE_END, end) || !constInput(STRIDEDSLICE_STRIDE, stride))
+        return false;
+
+    const int channels = src_dims[1];
+    bool fullBegin = begin_mask[1] == 0 || begin.size() < 2 || begin[1] == 0 || begin[1] == -channels;
+    bool fullEnd = end_mask[1] == 0 || end.size() < 2 || end[1] >= channels;
+    bool unitStride = stride.size() < 2 || stride[1] == 1;
+    return fullBegin && fullEnd && unitStride;
+}
+
 void StridedSliceImpl::strided_slice(const float *src_data, float* dst_data, std::vector<size_t> &dims) {
     size_t work_amount_dst = dstStrides[0] * dst_dims[0];
     parallel_nt(0, [&](const int ithr, const int nthr) {
@@ -375,6 +421,43 @@ void StridedSliceImpl::strided_slice_p(const float *src_data, float* dst_data) {
     });
 }
 
+void StridedSliceImpl::strided_slice_blk(const float *src_data, float* dst_data, const SizeVector &srcBlkStrides,
+                                         const SizeVector &dstBlkDims, const SizeVector &dstBlkStrides) {
+    //  The channel dimension is not sliced, so every dst channel block is a vectorized copy of the src one
+    size_t dims_size = dst_dims.size();
+    size_t blk_size = dstBlkDims[dims_size];
+    size_t work_amount_dst = 1;
+    for (size_t i = 0; i < dims_size; i++)
+        work_amount_dst *= dstBlkDims[i];
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        SizeVector counters(dims_size, 0);
+        splitter(work_amount_dst, nthr, ithr, start, end);
+        for (int j = dims_size - 1, i = start; j >= 0; j--) {
+            counters[j] = i % dstBlkDims[j];
+            i /= dstBlkDims[j];
+        }
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            size_t src_idx = 0, dst_idx = 0;
+            for (size_t i = 0; i < dims_size; ++i) {
+                src_idx += (begin_dms[i] + counters[i] * stride_dms[i]) * srcBlkStrides[i];
+                dst_idx += counters[i] * dstBlkStrides[i];
+            }
+            memcpy(&dst_data[dst_idx], &src_data[src_idx], sizeof(float) * blk_size);
+
+            for (int j = dims_size - 1; j >= 0; j--) {
+                counters[j]++;
+                if (counters[j] < dstBlkDims[j])
+                    break;
+                else
+                    counters[j] = 0;
+            }
+        }
+    });
+}
+
 REG_FACTORY_FOR(StridedSliceImpl, StridedSlice);
 
 }  // namespace Cpu
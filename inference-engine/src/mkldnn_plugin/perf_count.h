@@ -5,6 +5,7 @@
 #pragma once
 
 #include <chrono>
+#include "mkldnn_latency_histogram.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -14,12 +15,19 @@ class PerfCount {
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
+    LatencyHistogram* histogram = nullptr;
 
 public:
     PerfCount(): duration(0), num(0) {}
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    /**
+     * @brief Attaches a histogram which receives latency of every iteration.
+     * Histogram is not owned by counter and may be shared between several counters.
+     */
+    void setHistogram(LatencyHistogram* hist) { histogram = hist; }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -30,6 +38,9 @@ private:
 
         duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
+
+        if (histogram != nullptr)
+            histogram->record(std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count());
     }
 
     friend class PerfHelper;
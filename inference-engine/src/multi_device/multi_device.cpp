@@ -3,6 +3,7 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -78,6 +79,7 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
             workerInferRequest->_inferRequest.StartAsync();
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
@@ -147,7 +149,8 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _devicePriorities{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _loadTime{std::chrono::steady_clock::now()} {
     _taskExecutor.reset();
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
@@ -167,14 +170,18 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             itNumRequests->second.numRequestsPerDevices == -1) ? optimalNum : itNumRequests->second.numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
+        auto& deviceStatistics = _deviceStatistics[device];
         workerRequests.resize(numRequests);
+        deviceStatistics._numRequests = static_cast<int>(numRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
+        auto* deviceStatisticsPtr = &(deviceStatistics);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
             auto* workerRequestPtr = &workerRequest;
             idleWorkerRequests.push(workerRequestPtr);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr] (InferRequest , StatusCode status) mutable {
+                    deviceStatisticsPtr->Finished(std::chrono::steady_clock::now() - workerRequestPtr->_startTime);
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
                     {
@@ -188,32 +195,58 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                 });
         }
     }
+    UpdateScheduledDevices();
+}
+
+void MultiDeviceExecutableNetwork::UpdateScheduledDevices() {
+    auto scheduledDevices = std::make_shared<ScheduledDevices>();
+    for (auto&& device : _devicePriorities) {
+        scheduledDevices->push_back({device.first, &_idleWorkerRequests.at(device.first), &_deviceStatistics.at(device.first)});
+    }
+    std::sort(scheduledDevices->begin(), scheduledDevices->end(), [&] (const ScheduledDevice& a, const ScheduledDevice& b) {
+        return _devicePriorities.at(a._name).priority < _devicePriorities.at(b._name).priority;
+    });
+    std::atomic_store(&_scheduledDevices, std::shared_ptr<const ScheduledDevices>{std::move(scheduledDevices)});
 }
 
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
-    for (auto&& device : devices) {
-        auto& idleWorkerRequests = _idleWorkerRequests[device.first];
+    auto devices = std::atomic_load(&_scheduledDevices);
+    std::vector<const DeviceStatistics*> statistics;
+    for (auto&& device : *devices) {
+        statistics.push_back(device._statistics);
+    }
+    while (_numPendingTasks > 0) {
+        // the device expected to finish the request first, the one with the higher priority wins a tie;
+        // if it is busy, the request goes to the next device that has an idle request rather than waits
         WorkerInferRequest* workerRequestPtr = nullptr;
-        if (idleWorkerRequests.try_pop(workerRequestPtr)) {
-            IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            Task inferPipelineTask;
-            if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
-                _thisWorkerInferRequest = workerRequestPtr;
-                inferPipelineTask();
-                idleGuard.Release();
+        const ScheduledDevice* scheduledDevice = nullptr;
+        const auto sequence = _numScheduledTasks.load();
+        for (auto index : OrderDevicesBySchedule(statistics, _numPendingTasks.load(), sequence)) {
+            if ((*devices)[index]._idleWorkerRequests->try_pop(workerRequestPtr)) {
+                scheduledDevice = &(*devices)[index];
                 break;
             }
         }
+        if (nullptr == scheduledDevice) {
+            return;
+        }
+        IdleGuard idleGuard{workerRequestPtr, *scheduledDevice->_idleWorkerRequests};
+        Task inferPipelineTask;
+        if (!_inferPipelineTasks.try_pop(inferPipelineTask)) {
+            return;
+        }
+        _numPendingTasks--;
+        scheduledDevice->_statistics->Started(_numScheduledTasks++);
+        _thisWorkerInferRequest = workerRequestPtr;
+        inferPipelineTask();
+        idleGuard.Release();
     }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     if (!_terminate) {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+        _numPendingTasks++;
         ScheduleToWorkerInferRequest();
     }
 }
@@ -222,6 +255,7 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _devicePriorities.clear();
+        UpdateScheduledDevices();
     }
     _terminate = true;
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` Context are those that are used by Worker infer requests.
@@ -274,6 +308,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                 }
             }
             _devicePriorities = metaDevices;
+            UpdateScheduledDevices();
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -315,11 +350,26 @@ void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC_KEY(DEVICE_STATISTICS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == MULTI_METRIC_KEY(DEVICE_STATISTICS)) {
+        const auto elapsed = std::chrono::duration<float, std::nano>(std::chrono::steady_clock::now() - _loadTime).count();
+        std::map<std::string, std::map<std::string, float>> statistics;
+        for (auto&& device : _deviceStatistics) {
+            auto& deviceStatistics = device.second;
+            auto& values = statistics[device.first];
+            values["SERVICE_TIME_MS"] = deviceStatistics._serviceTime / 1e6f;
+            values["UTILIZATION"] = (deviceStatistics._numRequests > 0 && elapsed > 0.f)
+                ? deviceStatistics._busyTime / (elapsed * deviceStatistics._numRequests) : 0.f;
+            values["IN_FLIGHT"] = static_cast<float>(deviceStatistics._inFlight);
+            values["COMPLETED"] = static_cast<float>(deviceStatistics._completed);
+            values["REQUESTS"] = static_cast<float>(deviceStatistics._numRequests);
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
     }
@@ -382,6 +432,8 @@ DeviceMap<DeviceInformation> MultiDeviceInferencePlugin::ParseMetaDevices(const
         return GetSupportedConfig(tconfig, deviceName);
     };
 
+    unsigned int priority = 0;
+    std::unordered_map<DeviceName, unsigned int> deviceEntries;
     for (auto && d : devicesWithRequests) {
         auto openingBracket = d.find_first_of('(');
         auto closingBracket = d.find_first_of(')', openingBracket);
@@ -397,8 +449,10 @@ DeviceMap<DeviceInformation> MultiDeviceInferencePlugin::ParseMetaDevices(const
             }
         }
 
-        // create meta device
-        metaDevices[device_name] = { getDeviceConfig(device_name), numRequests };
+        // create meta device, every entry of the same device gets its own one
+        const auto entry = ++deviceEntries[device_name];
+        const auto key = 1 == entry ? device_name : device_name + "#" + std::to_string(entry);
+        metaDevices[key] = { device_name, getDeviceConfig(device_name), numRequests, priority++ };
     }
 
     return metaDevices;
@@ -489,10 +543,9 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     for (auto& p : metaDevices) {
-        auto & deviceName = p.first;
         auto & metaDevice = p.second;
         auto & deviceConfig = metaDevice.config;
-        executableNetworkPerDevice.insert({ deviceName, GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, deviceName, deviceConfig) });
+        executableNetworkPerDevice.insert({ p.first, GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, metaDevice.deviceName, deviceConfig) });
         multiNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
     }
     if (executableNetworkPerDevice.empty())
@@ -528,9 +581,8 @@ void MultiDeviceInferencePlugin::QueryNetwork(const ICNNNetwork&
     std::map<std::string, QueryNetworkResult> queryResults;
 
     for (auto&& value : metaDevices) {
-        auto& deviceName = value.first;
         auto& metaDevice = value.second;
-        queryResults[deviceName] = GetCore()->QueryNetwork(network, deviceName, metaDevice.config);
+        queryResults[value.first] = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
     }
 
     details::CNNNetworkIterator i(&network);
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -23,6 +25,7 @@
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include <ie_parallel.hpp>
+#include "multi_device_statistics.hpp"
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 #include <tbb/concurrent_queue.h>
@@ -33,10 +36,16 @@ namespace MultiDevicePlugin {
 using DeviceName = std::string;
 
 struct DeviceInformation {
+    // device the network is loaded to, several entries of the priorities list may refer to the same device
+    DeviceName deviceName;
     std::map<std::string, std::string> config;
     int numRequestsPerDevices;
+    // position of the device in the priorities list, decides between devices expected to finish at the same time
+    unsigned int priority;
 };
 
+// Keyed by the entry of the priorities list: the device name for the first entry of the device
+// and "<device name>#<n>" for its n-th entry, e.g. "CPU" and "CPU#2" for MULTI:CPU,CPU
 template<typename T>
 using DeviceMap = std::unordered_map<DeviceName, T>;
 
@@ -97,8 +106,16 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         Task                            _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
+    struct ScheduledDevice {
+        DeviceName              _name;
+        NotBusyWorkerRequests*  _idleWorkerRequests;
+        DeviceStatistics*       _statistics;
+    };
+    // immutable list of devices in the priority order, replaced as a whole when the priorities are changed
+    using ScheduledDevices = std::vector<ScheduledDevice>;
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const DeviceMap<DeviceInformation>&                                        networkDevices,
@@ -115,6 +132,7 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest();
+    void UpdateScheduledDevices();
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     std::atomic_bool                                            _terminate = {false};
@@ -126,6 +144,12 @@ public:
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    // accessed with std::atomic_load/std::atomic_store only
+    std::shared_ptr<const ScheduledDevices>                     _scheduledDevices;
+    std::atomic<int>                                            _numPendingTasks = {0};
+    std::atomic<std::uint64_t>                                  _numScheduledTasks = {0};
+    std::chrono::steady_clock::time_point                       _loadTime;
 };
 
 class MultiDeviceAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "multi_device_statistics.hpp"
+
+namespace MultiDevicePlugin {
+
+constexpr std::uint64_t DeviceStatistics::kExplorationInterval;
+
+void DeviceStatistics::Started(std::uint64_t sequence) {
+    _lastStarted = sequence;
+    _inFlight++;
+}
+
+void DeviceStatistics::Finished(std::chrono::steady_clock::duration executionTime) {
+    const auto time = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(executionTime).count());
+    // a plain mean over the first 8 requests, so a slow first one is not kept as the estimate,
+    // then the new sample has 1/8 weight, so the average follows changes of the device load in a few requests
+    const std::uint64_t weight = std::min<std::uint64_t>(_completed + 1, 8);
+    auto average = _serviceTime.load();
+    std::uint64_t updated;
+    do {
+        updated = average + time / weight - average / weight;
+    } while (!_serviceTime.compare_exchange_weak(average, updated));
+    _busyTime += time;
+    _completed++;
+    _inFlight--;
+}
+
+double DeviceStatistics::ExpectedCompletion(int pendingRequests) const {
+    const double serviceTime = static_cast<double>(_serviceTime.load());
+    const bool hasIdleRequest = _inFlight < _numRequests;
+    if (0. == serviceTime) {
+        // nothing is known about a device until its first request is finished, it is not expected to finish a request
+        // before any other device while all of its requests are busy
+        return hasIdleRequest ? 0. : std::numeric_limits<double>::infinity();
+    }
+    if (hasIdleRequest) {
+        return serviceTime;
+    }
+    // all infer requests of the device are busy, so the pending requests are served in rounds over them
+    return serviceTime * (1. + static_cast<double>(pendingRequests) / _numRequests);
+}
+
+bool DeviceStatistics::NeedsExploration(std::uint64_t sequence) const {
+    return 0 != _serviceTime && _inFlight < _numRequests && sequence >= _lastStarted + kExplorationInterval;
+}
+
+std::vector<std::size_t> OrderDevicesBySchedule(const std::vector<const DeviceStatistics*>& devices,
+                                                int pendingRequests, std::uint64_t sequence) {
+    std::vector<std::size_t> order;
+    std::vector<double> completions(devices.size());
+    for (std::size_t i = 0; i < devices.size(); i++) {
+        if (0 == devices[i]->_numRequests) {
+            continue;
+        }
+        order.push_back(i);
+        completions[i] = devices[i]->ExpectedCompletion(pendingRequests);
+    }
+    std::stable_sort(order.begin(), order.end(), [&] (std::size_t a, std::size_t b) {
+        return completions[a] < completions[b];
+    });
+    // the device that waits for a request the longest
+    auto explored = order.end();
+    for (auto it = order.begin(); it != order.end(); ++it) {
+        if (devices[*it]->NeedsExploration(sequence) &&
+            (order.end() == explored || devices[*it]->_lastStarted < devices[*explored]->_lastStarted)) {
+            explored = it;
+        }
+    }
+    if (order.end() != explored) {
+        std::rotate(order.begin(), explored, explored + 1);
+    }
+    return order;
+}
+
+}  // namespace MultiDevicePlugin
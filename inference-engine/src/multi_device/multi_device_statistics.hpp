@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MultiDevicePlugin {
+
+// Updated by completion callbacks of the worker requests and read by the scheduler without locking
+struct DeviceStatistics {
+    // a device with an idle request that was not given any of the last kExplorationInterval requests is tried first,
+    // so the average of a device that lost once to a slow sample (e.g. a warm-up) is refreshed
+    static constexpr std::uint64_t kExplorationInterval = 64;
+
+    // `sequence` is the number of requests scheduled by the network before this one
+    void Started(std::uint64_t sequence);
+    void Finished(std::chrono::steady_clock::duration executionTime);
+    // expected time to finish a request started now in nanoseconds given the number of requests waiting for a device
+    double ExpectedCompletion(int pendingRequests) const;
+    bool NeedsExploration(std::uint64_t sequence) const;
+
+    // moving average of the request execution time in nanoseconds, 0 until the first request is finished
+    std::atomic<std::uint64_t>  _serviceTime = {0};
+    std::atomic<std::uint64_t>  _busyTime = {0};
+    std::atomic<std::uint64_t>  _completed = {0};
+    std::atomic<int>            _inFlight = {0};
+    std::atomic<std::uint64_t>  _lastStarted = {0};
+    int                         _numRequests = 0;
+};
+
+// Order in which the scheduler tries the devices for the next request: a device to explore first, then the rest by
+// the expected completion. Devices expected to finish at the same time keep their order in `devices`, that is
+// the priority order. Devices without infer requests are skipped.
+std::vector<std::size_t> OrderDevicesBySchedule(const std::vector<const DeviceStatistics*>& devices,
+                                                int pendingRequests, std::uint64_t sequence);
+
+}  // namespace MultiDevicePlugin
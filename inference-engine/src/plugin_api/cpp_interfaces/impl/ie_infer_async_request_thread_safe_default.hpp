@@ -283,6 +283,10 @@ protected:
         _syncRequest->SetBatch(batch);
     }
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() override {
+        return _syncRequest->QueryState();
+    }
+
 private:
     /**
      * @brief Create a task with next pipeline stage.
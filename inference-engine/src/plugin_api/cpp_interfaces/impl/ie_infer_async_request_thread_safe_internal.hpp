@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp"
@@ -131,6 +132,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        CheckBusy();
+        return QueryState_ThreadUnsafe();
+    }
+
 protected:
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
@@ -223,6 +229,14 @@ protected:
      * @param[in]  batch  The dynamic batch value
      */
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    /**
+     * @brief Queries memory states of the infer request.
+     * @note Used by AsyncInferRequestThreadSafeInternal::QueryState which ensures thread-safety
+     *       and calls this method after.
+     * @return Returns memory states
+     */
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() = 0;
 };
 
 }  // namespace InferenceEngine
@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
@@ -222,6 +223,11 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        // meaning base plugin reports as no state available - plugin owners need to create proper override of this
+        return {};
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      * @param inputs Inputs blobs to perform preprocessing on
@@ -298,50 +304,41 @@ protected:
      * @param[in]  refDims  The reference dims, empty if not specified
      */
     void checkBlob(const Blob::Ptr& blob, const std::string& name, bool isInput, const SizeVector& refDims = {}) const {
-        std::string bType = isInput ? "Input" : "Output";
-        std::string sType = isInput ? "input" : "output";
-        std::string strNotAllocated(bType + " data was not allocated.");
-        std::string strNotMatched("The " + sType + " blob size is not equal to the network " + sType + " size");
+        // messages are built only on failure, so the check does not allocate on every inference
+        const char* bType = isInput ? "Input" : "Output";
+        const char* sType = isInput ? "input" : "output";
 
         if (!blob) {
-            THROW_IE_EXCEPTION << strNotAllocated;
+            THROW_IE_EXCEPTION << bType << " data was not allocated.";
         }
         size_t refSize;
         if (refDims.empty()) {
-            SizeVector dims;
+            const TensorDesc* desc = nullptr;
             if (isInput) {
-                auto foundInputPair = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
-                                                   [&](const std::pair<std::string, InputInfo::Ptr>& pair) {
-                                                       return pair.first == name;
-                                                   });
+                auto foundInputPair = _networkInputs.find(name);
                 if (foundInputPair == std::end(_networkInputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input with name: \'" << name << "\'";
                 }
-                dims = foundInputPair->second->getTensorDesc().getDims();
-                refSize = foundInputPair->second->getTensorDesc().getLayout() != SCALAR
-                    ? details::product(dims)
-                    : 1;
+                desc = &foundInputPair->second->getTensorDesc();
             } else {
-                auto foundOutputPair = std::find_if(std::begin(_networkOutputs), std::end(_networkOutputs),
-                                                    [&](const std::pair<std::string, DataPtr>& pair) {
-                                                        return pair.first == name;
-                                                    });
+                auto foundOutputPair = _networkOutputs.find(name);
                 if (foundOutputPair == std::end(_networkOutputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find output with name: \'" << name << "\'";
                 }
-                dims = foundOutputPair->second->getTensorDesc().getDims();
-                refSize = foundOutputPair->second->getTensorDesc().getLayout() != SCALAR
-                    ? details::product(dims)
-                    : 1;
+                desc = &foundOutputPair->second->getTensorDesc();
             }
+            refSize = desc->getLayout() != SCALAR
+                ? details::product(desc->getDims())
+                : 1;
         } else {
             refSize = details::product(refDims);
         }
 
         if (refSize != blob->size()) {
-            THROW_IE_EXCEPTION << strNotMatched + ": got " << blob->size() << " expecting " << refSize;
+            THROW_IE_EXCEPTION << "The " << sType << " blob size is not equal to the network " << sType
+                               << " size: got " << blob->size() << " expecting " << refSize;
         }
-        if (blob->buffer() == nullptr) THROW_IE_EXCEPTION << strNotAllocated;
+        if (blob->buffer() == nullptr) THROW_IE_EXCEPTION << bType << " data was not allocated.";
     }
 
     /**
@@ -11,6 +11,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
+
+#include "cpp_interfaces/interface/ie_imemory_state_internal.hpp"
 
 namespace InferenceEngine {
 
@@ -83,6 +86,12 @@ public:
      * @param batch - new batch size to be used by all the following inference calls for this request.
      */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+     * @brief Queries memory states of the infer request.
+     * @return Returns memory states
+     */
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
 };
 
 }  // namespace InferenceEngine
@@ -0,0 +1,108 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines API to measure phases of network compilation
+ * @file ie_compile_profiler.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief A node of the tree of network compilation phases
+ * @ingroup ie_dev_api_error_debug
+ */
+struct CompilePhase {
+    /**
+     * @brief A shared pointer to a phase
+     */
+    using Ptr = std::shared_ptr<CompilePhase>;
+
+    std::string name;            //!< Name of the phase
+    std::size_t count = 0;       //!< Number of runs of the phase
+    float duration = 0.f;        //!< Total duration of all runs in milliseconds
+    std::vector<Ptr> children;   //!< Nested phases in order of their first run
+};
+
+/**
+ * @brief Measures a phase of network compilation while the object is alive
+ * @ingroup ie_dev_api_error_debug
+ *
+ * Phases started in the same thread form a tree, the outermost phase is its root. Phases with the same name
+ * run several times under the same parent are merged. Measurements do not depend on ITT, so they are
+ * always available. Timings of phases run in parallel threads are summed.
+ */
+class INFERENCE_ENGINE_API_CLASS(CompilePhaseScope) {
+public:
+    /**
+     * @brief Starts a phase nested to the innermost phase of the calling thread or a new tree
+     * @param name A name of the phase
+     */
+    explicit CompilePhaseScope(const char* name);
+
+    /**
+     * @brief Starts a phase nested to the given phase, used to continue the tree in another thread
+     * @param name A name of the phase
+     * @param parent A parent phase, a new tree is started if it is nullptr
+     */
+    CompilePhaseScope(const char* name, const CompilePhase::Ptr& parent);
+
+    /**
+     * @brief Finishes the phase
+     */
+    ~CompilePhaseScope();
+
+    CompilePhaseScope(const CompilePhaseScope&) = delete;
+    CompilePhaseScope& operator=(const CompilePhaseScope&) = delete;
+
+    /**
+     * @brief Returns the innermost phase of the calling thread
+     * @return A phase or nullptr if no phase is running
+     */
+    static CompilePhase::Ptr current();
+
+    /**
+     * @brief Returns the outermost phase of the calling thread
+     *
+     * The root is finished after the object which started it is destroyed, so the timings are complete
+     * when the outermost call returns.
+     * @return A phase or nullptr if no phase is running
+     */
+    static CompilePhase::Ptr root();
+
+private:
+    CompilePhase::Ptr _phase;
+    std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * @brief Flattens a tree of compilation phases
+ * @ingroup ie_dev_api_error_debug
+ * @param root A root of the tree
+ * @return Total durations of phases in milliseconds by paths of phase names joined with "/"
+ */
+INFERENCE_ENGINE_API_CPP(std::map<std::string, float>) getCompilePhaseDurations(const CompilePhase::Ptr& root);
+
+}  // namespace InferenceEngine
+
+#define IE_COMPILE_PHASE_CONCAT_EVAL(x, y) x##y
+#define IE_COMPILE_PHASE_CONCAT(x, y) IE_COMPILE_PHASE_CONCAT_EVAL(x, y)
+
+/**
+ * @brief Measures a compilation phase till the end of the current scope
+ * @ingroup ie_dev_api_error_debug
+ */
+#define IE_COMPILE_PHASE(NAME) \
+    ::InferenceEngine::CompilePhaseScope IE_COMPILE_PHASE_CONCAT(ieCompilePhase, __LINE__) {NAME}
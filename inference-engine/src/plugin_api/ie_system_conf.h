@@ -10,6 +10,8 @@
 #pragma once
 
 #include "ie_api.h"
+#include <cstddef>
+#include <map>
 #include <vector>
 
 namespace InferenceEngine {
@@ -44,6 +46,48 @@ INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores();
 
+/**
+ * @brief      Returns logical processors of the NUMA node (on Linux only, empty vector is returned on other OSes
+ *             or when the topology is not available)
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  numaNode  The NUMA node id
+ * @return     Sorted ids of logical processors
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) getNUMANodeCPUs(int numaNode);
+
+/**
+ * @brief      Returns NUMA node of the logical processor
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  cpu   The logical processor id
+ * @return     NUMA node id or -1 if the topology is not available
+ */
+INFERENCE_ENGINE_API_CPP(int) getNUMANodeOfCPU(int cpu);
+
+/**
+ * @brief      Moves memory pages of the buffer to the NUMA nodes (on Linux only)
+ *
+ * Pages are distributed over the nodes in the round-robin manner, so a single node binds the whole buffer
+ * to the node, while several nodes interleave the pages. Pages which are only partially covered by the buffer
+ * are not moved, as they are shared with other allocations.
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  ptr        The buffer
+ * @param[in]  size       The buffer size in bytes
+ * @param[in]  numaNodes  The target NUMA nodes
+ * @return     `True` if all pages were moved, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) moveMemoryToNUMANodes(const void* ptr, size_t size, const std::vector<int>& numaNodes);
+
+/**
+ * @brief      Returns placement of memory pages of the buffer over NUMA nodes (on Linux only)
+ *
+ * Only pages which are fully covered by the buffer are counted.
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  ptr   The buffer
+ * @param[in]  size  The buffer size in bytes
+ * @return     Number of pages per NUMA node, pages which are not allocated yet or cannot be queried are counted with -1 key
+ */
+INFERENCE_ENGINE_API_CPP(std::map<int, size_t>) getMemoryNUMAPlacement(const void* ptr, size_t size);
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
@@ -12,6 +12,7 @@
 #include <ie_api.h>
 
 #include <cstddef>
+#include <cstdint>
 
 /**
  * @brief Inference Engine Plugin API namespace
@@ -45,7 +46,7 @@ namespace InferenceEngine {
  * @brief An extension for public Blob API allowing to create blobs in uniform manner
  * 
  * @defgroup ie_dev_api_precision FP16 to FP32 precision utilities
- * @brief Set of functions to convert from FP32 to FP16 and vice versa.
+ * @brief Set of functions to convert from FP32 to FP16, BF16 and vice versa.
  * 
  * @defgroup ie_dev_api_system_conf System configuration utilities
  * @brief API to get information about the system, core processor capabilities
@@ -71,6 +72,12 @@ namespace InferenceEngine {
  */
 using ie_fp16 = short;
 
+/**
+ * @brief A type definition for BF16 data type. Defined as a signed short
+ * @ingroup ie_dev_api_precision
+ */
+using ie_bf16 = short;
+
 /**
  * @brief Namespace for precision utilities
  * @ingroup ie_dev_api_precision
@@ -123,6 +130,102 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 INFERENCE_ENGINE_API_CPP(void)
 f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+/**
+ * @brief      Converts a single-precision floating point value to a bfloat16 value with rounding to nearest even
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A single-precision floating point value
+ * @return     A bfloat16 value
+ */
+INFERENCE_ENGINE_API_CPP(ie_bf16) f32tobf16(float x);
+
+/**
+ * @brief      Converts a bfloat16 value to a single-precision floating point value
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A bfloat16 value
+ * @return     A single-precision floating point value
+ */
+INFERENCE_ENGINE_API_CPP(float) bf16tof32(ie_bf16 x);
+
+/**
+ * @brief      Converts a bfloat16 array to a single-precision floating point array
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of bfloat16 values
+ * @param[in]  nelem  A number of elements in arrays
+ */
+INFERENCE_ENGINE_API_CPP(void)
+bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem);
+
+/**
+ * @brief      Converts a single-precision floating point array to a bfloat16 array
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of bfloat16 values
+ * @param[in]  src    A source array of single-precision floating point values
+ * @param[in]  nelem  A number of elements in arrays
+ */
+INFERENCE_ENGINE_API_CPP(void)
+f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem);
+
+/**
+ * @brief      Converts an unsigned 8-bit integer array to a single-precision floating point array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of unsigned 8-bit integer values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+u8tof32Arrays(float* dst, const uint8_t* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief      Converts a signed 8-bit integer array to a single-precision floating point array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of signed 8-bit integer values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+i8tof32Arrays(float* dst, const int8_t* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief      Converts an unsigned 16-bit integer array to a single-precision floating point array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of unsigned 16-bit integer values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+u16tof32Arrays(float* dst, const uint16_t* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief      Converts a signed 16-bit integer array to a single-precision floating point array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of signed 16-bit integer values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+i16tof32Arrays(float* dst, const int16_t* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
 }  // namespace PrecisionUtils
 
 }  // namespace InferenceEngine
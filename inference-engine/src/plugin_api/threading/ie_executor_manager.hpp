@@ -17,6 +17,7 @@
 
 #include "threading/ie_itask_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
+#include "threading/ie_shared_streams_executor.hpp"
 #include "ie_api.h"
 
 namespace InferenceEngine {
@@ -30,6 +31,8 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    SharedStreamsScheduler::Ptr getSharedCPUStreamsScheduler(const IStreamsExecutor::Config& config, std::size_t maxInFlight);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -41,6 +44,7 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
+    std::vector<std::pair<IStreamsExecutor::Config, SharedStreamsScheduler::Ptr> > sharedCpuStreamsSchedulers;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -84,6 +88,18 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns the process-wide scheduler of a streams executor with the given configuration.
+     *        Unlike getIdleCPUStreamsExecutor() the executor is shared by all callers, each of them is expected
+     *        to submit tasks through its own SharedStreamsScheduler::createClient() instance.
+     * @param config Stream executor parameters
+     * @param maxInFlight Limit of tasks admitted into the executor, 0 means a task per stream. The limit is set
+     *        when the scheduler is created, a later call with a different non-zero limit throws an exception.
+     * @return A shared pointer to existing or newly created scheduler
+     */
+    SharedStreamsScheduler::Ptr getSharedCPUStreamsScheduler(const IStreamsExecutor::Config& config,
+                                                             std::size_t maxInFlight = 0);
+
     /**
      * @cond
      */
@@ -0,0 +1,153 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_shared_streams_executor.hpp
+ * @brief A header file for a streams executor shared by several executable networks
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "threading/ie_istreams_executor.hpp"
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+class SharedStreamsExecutor;
+
+/**
+ * @class SharedStreamsScheduler
+ * @ingroup ie_dev_api_threading
+ * @brief Admission control in front of a streams executor shared by several clients (usually executable networks).
+ *        Tasks of every client wait in the client queue until the number of tasks admitted into the executor
+ *        drops below the global limit. Then the client with the least weighted number of admitted tasks,
+ *        which is also below its own quota, goes next.
+ */
+class INFERENCE_ENGINE_API_CLASS(SharedStreamsScheduler) : public std::enable_shared_from_this<SharedStreamsScheduler> {
+public:
+    /**
+     * @brief A shared pointer to a SharedStreamsScheduler object
+     */
+    using Ptr = std::shared_ptr<SharedStreamsScheduler>;
+
+    /**
+     * @brief Snapshot of the scheduler or client state
+     */
+    struct Occupancy {
+        std::size_t   inFlight    = 0;  //!< Number of tasks admitted into the executor and not finished yet
+        std::size_t   queued      = 0;  //!< Number of tasks waiting for admission
+        std::size_t   maxInFlight = 0;  //!< Limit of admitted tasks, 0 means no limit
+        std::uint64_t completed   = 0;  //!< Number of finished tasks
+        std::size_t   clients     = 0;  //!< Number of registered clients
+    };
+
+    /**
+     * @brief Constructor
+     * @param executor The executor running admitted tasks
+     * @param maxInFlight Limit of tasks admitted into the executor, 0 means no limit
+     */
+    SharedStreamsScheduler(IStreamsExecutor::Ptr executor, std::size_t maxInFlight);
+
+    /**
+     * @brief Waits for admitted tasks to finish
+     */
+    ~SharedStreamsScheduler();
+
+    /**
+     * @brief Creates a client which submits tasks through the scheduler
+     * @param weight Relative share of the executor the client gets while other clients have tasks queued
+     * @param quota Limit of tasks of the client admitted at the same time, 0 means no limit
+     * @return A streams executor interface of the client
+     */
+    std::shared_ptr<SharedStreamsExecutor> createClient(unsigned int weight = 1, std::size_t quota = 0);
+
+    /**
+     * @brief Changes the limit of tasks admitted into the executor
+     * @param maxInFlight The new limit, 0 means no limit
+     */
+    void setMaxInFlight(std::size_t maxInFlight);
+
+    /**
+     * @brief Returns the state of the whole scheduler
+     * @return Occupancy summed over all clients
+     */
+    Occupancy getOccupancy() const;
+
+private:
+    friend class SharedStreamsExecutor;
+    struct Client;
+    using Admitted = std::vector<std::pair<std::shared_ptr<Client>, Task>>;
+
+    void submit(const std::shared_ptr<Client>& client, Task task);
+    void finish(const std::shared_ptr<Client>& client);
+    void remove(const std::shared_ptr<Client>& client);
+    void admit(Admitted& admitted);
+    void runAdmitted(Admitted& admitted);
+    Occupancy getOccupancy(const std::shared_ptr<Client>& client) const;
+
+    IStreamsExecutor::Ptr                _executor;
+    mutable std::mutex                   _mutex;
+    std::condition_variable              _idleCondVar;
+    std::vector<std::shared_ptr<Client>> _clients;
+    std::size_t                          _maxInFlight = 0;
+    std::size_t                          _inFlight = 0;
+    std::uint64_t                        _completed = 0;
+    double                               _virtualTime = 0.;
+};
+
+/**
+ * @class SharedStreamsExecutor
+ * @ingroup ie_dev_api_threading
+ * @brief A client of SharedStreamsScheduler. Tasks passed to run() are admitted by the scheduler,
+ *        the rest of the calls are forwarded to the shared executor.
+ */
+class INFERENCE_ENGINE_API_CLASS(SharedStreamsExecutor) : public IStreamsExecutor {
+public:
+    /**
+     * @brief A shared pointer to a SharedStreamsExecutor object
+     */
+    using Ptr = std::shared_ptr<SharedStreamsExecutor>;
+
+    /**
+     * @brief Unregisters the client from the scheduler
+     */
+    ~SharedStreamsExecutor() override;
+
+    void run(Task task) override;
+
+    void Execute(Task task) override;
+
+    int GetStreamId() override;
+
+    int GetNumaNodeId() override;
+
+    /**
+     * @brief Returns the state of the client
+     * @return Occupancy of the client tasks, the limit is the client quota
+     */
+    SharedStreamsScheduler::Occupancy getOccupancy() const;
+
+    /**
+     * @brief Returns the scheduler the client submits tasks to
+     * @return A shared pointer to the scheduler
+     */
+    SharedStreamsScheduler::Ptr getScheduler() const;
+
+private:
+    friend class SharedStreamsScheduler;
+    SharedStreamsExecutor(SharedStreamsScheduler::Ptr scheduler, std::shared_ptr<SharedStreamsScheduler::Client> client);
+
+    SharedStreamsScheduler::Ptr                     _scheduler;
+    std::shared_ptr<SharedStreamsScheduler::Client> _client;
+};
+
+}  // namespace InferenceEngine
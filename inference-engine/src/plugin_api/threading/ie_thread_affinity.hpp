@@ -54,6 +54,18 @@ using CpuSet = std::unique_ptr<cpu_set_t, ReleaseProcessMaskDeleter>;
  */
 INFERENCE_ENGINE_API_CPP(std::tuple<CpuSet, int>) GetProcessMask();
 
+/**
+ * @brief      Returns the logical processor a thread with the given index is pinned to by PinThreadToVacantCore
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  thrIdx        The thr index
+ * @param[in]  hyperThreads  The hyper threads
+ * @param[in]  ncores        The ncores
+ * @param[in]  processMask   The process mask
+ * @return     The logical processor id or -1 if the process mask is not available
+ */
+INFERENCE_ENGINE_API_CPP(int) GetVacantCoreId(int thrIdx, int hyperThreads, int ncores, const CpuSet& processMask);
+
 /**
  * @brief      Pins current thread to a set of cores determined by the mask
  * @ingroup    ie_dev_api_threading
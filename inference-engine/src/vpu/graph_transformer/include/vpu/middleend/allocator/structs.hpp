@@ -5,10 +5,12 @@
 #pragma once
 
 #include <list>
+#include <map>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include <vpu/utils/enums.hpp>
-#include <vpu/utils/small_vector.hpp>
 #include <vpu/model/data.hpp>
 
 namespace vpu {
@@ -43,11 +45,45 @@ struct FreeMemory final {
     int size = 0;
 };
 
+//
+// Free memory blocks indexed by offset for coalescing and by size for best-fit search,
+// so both operations are logarithmic in the number of blocks.
+//
+
+class FreeMemoryPool final {
+public:
+    bool empty() const { return _sizeByOffset.empty(); }
+    std::size_t size() const { return _sizeByOffset.size(); }
+
+    void clear();
+
+    /**
+     * Removes free blocks adjacent to the given memory from the pool
+     * and returns the memory extended by them
+     */
+    FreeMemory merge(FreeMemory mem);
+
+    void insert(const FreeMemory& mem);
+
+    /**
+     * Takes size bytes from the end of the smallest block which is not less than size,
+     * returns offset of taken memory or -1 if there is no such block
+     */
+    int takeBestFit(int size);
+
+private:
+    void erase(std::map<int, int>::iterator it);
+
+private:
+    std::map<int, int> _sizeByOffset;
+    std::set<std::pair<int, int>> _offsetsBySize;
+};
+
 struct MemoryPool final {
     int curMemOffset = 0;
     int memUsed = 0;
     std::list<MemChunk> allocatedChunks;
-    SmallVector<FreeMemory> freePool;
+    FreeMemoryPool freePool;
 
     void clear() {
         curMemOffset = 0;
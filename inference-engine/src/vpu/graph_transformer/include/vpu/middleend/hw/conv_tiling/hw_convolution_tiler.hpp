@@ -38,6 +38,10 @@ struct ConvolutionOptions final {
 
     const bool _withPool;
 
+    // CMX budget is taken from the compile environment here, so the search itself does not access it
+    // and can run on any thread
+    const int _numCMXSlices;
+
 public:
     ConvolutionOptions(std::string stageName, const DimValues& inputDims, const DimValues& outputDims,
                        const DimValues& origOutputDims, int kernelSizeX, int kernelSizeY,
@@ -46,7 +50,8 @@ public:
             : _stageName(std::move(stageName)), _inputDims(inputDims), _outputDims(outputDims),
               _origOutputDims(origOutputDims), _kernelSizeX(kernelSizeX), _kernelSizeY(kernelSizeY),
               _kernelStride(kernelStride), _paddingLeft(paddingLeft), _paddingRight(paddingRight),
-              _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool) {}
+              _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool),
+              _numCMXSlices(CompileEnv::get().resources.numCMXSlices) {}
 };
 
 struct TilingOption final {
@@ -188,6 +193,15 @@ public:
         return _hwTilings;
     }
 
+    /**
+     * Returns tiler for the convolution memoized by its parameters, so identical convolutions
+     * are tiled once per process. Resulting tilings are shared and must not be modified.
+     * Thread-safe.
+     */
+    static std::shared_ptr<const HWConvolutionTiler> getCached(const ConvolutionOptions& convolutionOptions,
+                                                               const Direction& direction,
+                                                               std::size_t maxTilingOptions);
+
 private:
     bool tileForHW();
 
@@ -400,9 +400,9 @@ ModelPtr FrontEnd::runCommonPasses(ie::ICNNNetwork& network, const UnsupportedLa
             convertNetwork();
         }
 
-        ie::NetPass::ConvertPrecision(*originalOrConvertNetwork, ie::Precision::I64, ie::Precision::I32);
-        ie::NetPass::ConvertPrecision(*originalOrConvertNetwork, ie::Precision::U64, ie::Precision::I32);
-        ie::NetPass::ConvertPrecision(*originalOrConvertNetwork, ie::Precision::BOOL, ie::Precision::I32);
+        ie::NetPass::ConvertPrecision(*originalOrConvertNetwork, {{ie::Precision::I64, ie::Precision::I32},
+                                                                  {ie::Precision::U64, ie::Precision::I32},
+                                                                  {ie::Precision::BOOL, ie::Precision::I32}});
 
         moveConstInputsToBlobs(*originalOrConvertNetwork);
 
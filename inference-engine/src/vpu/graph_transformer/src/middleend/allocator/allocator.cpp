@@ -535,49 +535,12 @@ void Allocator::freeMem(allocator::MemChunk* chunk) {
     newMem.offset = chunk->offset;
     newMem.size = chunk->size;
 
-    while (true) {
-        bool found = false;
+    newMem = memPool->freePool.merge(newMem);
 
-        for (auto memPoolIt = memPool->freePool.begin(); memPoolIt != memPool->freePool.end(); ++memPoolIt) {
-            IE_ASSERT(newMem.offset != memPoolIt->offset);
-
-            if (newMem.offset + newMem.size == memPoolIt->offset) {
-                //
-                // [newMem][*memPoolIt] case
-                // extend newMem to and remove memPoolIt
-                //
-
-                newMem.size += memPoolIt->size;
-
-                memPool->freePool.erase(memPoolIt);
-
-                found = true;
-                break;
-            } else if (memPoolIt->offset + memPoolIt->size == newMem.offset) {
-                //
-                // [*memPoolIt][newMem] case
-                // extend newMem to and remove memPoolIt
-                //
-
-                newMem.offset = memPoolIt->offset;
-                newMem.size += memPoolIt->size;
-
-                memPool->freePool.erase(memPoolIt);
-
-                found = true;
-                break;
-            }
-        }
-
-        if (!found) {
-            if (newMem.offset + newMem.size == memPool->curMemOffset) {
-                memPool->curMemOffset = newMem.offset;
-            } else {
-                memPool->freePool.emplace_back(newMem);
-            }
-
-            break;
-        }
+    if (newMem.offset + newMem.size == memPool->curMemOffset) {
+        memPool->curMemOffset = newMem.offset;
+    } else {
+        memPool->freePool.insert(newMem);
     }
 
     IE_ASSERT(chunk->_posInList != memPool->allocatedChunks.end());
@@ -600,24 +563,11 @@ allocator::MemChunk* Allocator::addNewChunk(allocator::MemoryPool& memPool, Memo
 }
 
 allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, MemoryType memType, int size, int inUse) {
-    auto minMemSizeToUse = std::numeric_limits<size_t>::max();
-    auto minMemIt = memPool.freePool.end();
-
-    for (auto memPoolIt = memPool.freePool.begin(); memPoolIt != memPool.freePool.end(); ++memPoolIt) {
-        if (memPoolIt->size >= size) {
-            if (memPoolIt->size < minMemSizeToUse) {
-                minMemSizeToUse = memPoolIt->size;
-                minMemIt = memPoolIt;
-            }
-        }
-    }
-
-    if (minMemIt == memPool.freePool.end()) {
+    auto offset = memPool.freePool.takeBestFit(size);
+    if (offset < 0) {
         return nullptr;
     }
 
-    auto offset = minMemIt->offset + minMemIt->size - size;
-
     int pointer = 0;
     if (memType == MemoryType::DDR) {
         pointer = offset;
@@ -626,15 +576,7 @@ allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, Mem
         pointer = _maxCmxSize - offset - size;
     }
 
-    auto chunk = addNewChunk(memPool, memType, offset, pointer, size, inUse);
-
-    minMemIt->size -= size;
-
-    if (minMemIt->size == 0) {
-        memPool.freePool.erase(minMemIt);
-    }
-
-    return chunk;
+    return addNewChunk(memPool, memType, offset, pointer, size, inUse);
 }
 
 void Allocator::reset() {
@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/allocator/structs.hpp>
+
+#include <iterator>
+#include <limits>
+
+#include <details/ie_exception.hpp>
+
+namespace vpu {
+
+namespace allocator {
+
+void FreeMemoryPool::clear() {
+    _sizeByOffset.clear();
+    _offsetsBySize.clear();
+}
+
+FreeMemory FreeMemoryPool::merge(FreeMemory mem) {
+    auto next = _sizeByOffset.lower_bound(mem.offset);
+    IE_ASSERT(next == _sizeByOffset.end() || next->first != mem.offset);
+
+    //
+    // [mem][*next] case
+    //
+
+    if (next != _sizeByOffset.end() && mem.offset + mem.size == next->first) {
+        mem.size += next->second;
+        auto afterNext = std::next(next);
+        erase(next);
+        next = afterNext;
+    }
+
+    //
+    // [*prev][mem] case
+    //
+
+    if (next != _sizeByOffset.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == mem.offset) {
+            mem.offset = prev->first;
+            mem.size += prev->second;
+            erase(prev);
+        }
+    }
+
+    return mem;
+}
+
+void FreeMemoryPool::insert(const FreeMemory& mem) {
+    IE_ASSERT(mem.size > 0);
+
+    auto res = _sizeByOffset.emplace(mem.offset, mem.size);
+    IE_ASSERT(res.second);
+
+    _offsetsBySize.emplace(mem.size, mem.offset);
+}
+
+int FreeMemoryPool::takeBestFit(int size) {
+    auto bySizeIt = _offsetsBySize.lower_bound({size, std::numeric_limits<int>::min()});
+    if (bySizeIt == _offsetsBySize.end()) {
+        return -1;
+    }
+
+    const auto blockOffset = bySizeIt->second;
+    const auto blockSize = bySizeIt->first;
+    _offsetsBySize.erase(bySizeIt);
+
+    auto byOffsetIt = _sizeByOffset.find(blockOffset);
+    IE_ASSERT(byOffsetIt != _sizeByOffset.end());
+
+    if (blockSize == size) {
+        _sizeByOffset.erase(byOffsetIt);
+    } else {
+        byOffsetIt->second = blockSize - size;
+        _offsetsBySize.emplace(blockSize - size, blockOffset);
+    }
+
+    return blockOffset + blockSize - size;
+}
+
+void FreeMemoryPool::erase(std::map<int, int>::iterator it) {
+    auto erased = _offsetsBySize.erase({it->second, it->first});
+    IE_ASSERT(erased == 1);
+
+    _sizeByOffset.erase(it);
+}
+
+}  // namespace allocator
+
+}  // namespace vpu
@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -263,6 +265,78 @@ HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, co
     _tilingPossible = tileForHW();
 }
 
+namespace {
+
+using TilerCacheKey = std::vector<int>;
+
+TilerCacheKey makeTilerCacheKey(const ConvolutionOptions& convolutionOptions, const Direction& direction,
+                                std::size_t maxTilingOptions) {
+    TilerCacheKey key;
+
+    const auto appendDims = [&key](const DimValues& dims) {
+        key.push_back(static_cast<int>(dims.size()));
+        for (const auto& dim : dims) {
+            key.push_back(static_cast<int>(dim.first));
+            key.push_back(dim.second);
+        }
+    };
+
+    appendDims(convolutionOptions._inputDims);
+    appendDims(convolutionOptions._outputDims);
+    appendDims(convolutionOptions._origOutputDims);
+
+    key.insert(key.end(), {
+        convolutionOptions._kernelSizeX,
+        convolutionOptions._kernelSizeY,
+        convolutionOptions._kernelStride,
+        convolutionOptions._paddingLeft,
+        convolutionOptions._paddingRight,
+        convolutionOptions._paddingTop,
+        convolutionOptions._paddingBottom,
+        convolutionOptions._withPool,
+        convolutionOptions._numCMXSlices,
+        static_cast<int>(direction),
+        static_cast<int>(maxTilingOptions)
+    });
+
+    return key;
+}
+
+// A key is a distinct convolution configuration, and each one takes at most two entries (with and
+// without fused pooling). Large networks have a few hundred of them, so the bound keeps roughly ten
+// networks' worth of tilings. Each tiler keeps maxTilingOptions (1 for the tiling pass) tilings of a
+// few KB, so a full cache stays within tens of MB. It is cleared on overflow rather than evicted
+// because a miss only repeats the search.
+const std::size_t maxCachedTilers = 4096;
+
+}  // namespace
+
+std::shared_ptr<const HWConvolutionTiler> HWConvolutionTiler::getCached(const ConvolutionOptions& convolutionOptions,
+                                                                         const Direction& direction,
+                                                                         std::size_t maxTilingOptions) {
+    static std::mutex cacheMutex;
+    static std::map<TilerCacheKey, std::shared_ptr<const HWConvolutionTiler>> cache;
+
+    const auto key = makeTilerCacheKey(convolutionOptions, direction, maxTilingOptions);
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        const auto it = cache.find(key);
+        if (it != cache.end()) {
+            return it->second;
+        }
+    }
+
+    // The search is done out of the lock, so different convolutions are tiled concurrently
+    auto tiler = std::make_shared<const HWConvolutionTiler>(convolutionOptions, direction, maxTilingOptions);
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (cache.size() >= maxCachedTilers) {
+        cache.clear();
+    }
+    return cache.emplace(key, std::move(tiler)).first->second;
+}
+
 bool HWConvolutionTiler::tileForHW() {
     const auto& tilingOptions = _searcher.tilingOptions();
     if (tilingOptions.empty()) {
@@ -325,7 +399,7 @@ bool GraphDataTiling::ceilNeeded() const {
 bool GraphDataTiling::patternMatching() {
     // All optimizations below are for MiryadX code with 2 threads, so at least 9 slices is required.
     // TODO: check 1-thread perfomance and replace with exact equality check.
-    if (CompileEnv::get().resources.numCMXSlices < 9) {
+    if (_convolutionOptions._numCMXSlices < 9) {
         return false;
     }
 
@@ -618,8 +692,6 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
 std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
     auto& dirTiling = *_dirTiling;
     FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
 
@@ -641,7 +713,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
 
-    const auto cmxLimit = tilingCMXLimit(env.resources.numCMXSlices);
+    const auto cmxLimit = tilingCMXLimit(_convolutionOptions._numCMXSlices);
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
@@ -5,9 +5,12 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <precision_utils.h>
+#include <ie_parallel.hpp>
+#include <exception>
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,9 +34,41 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(const Stage& origStage, bool withoutPool) {
+    const HWConvStageOptions stageOptions(origStage);
+    const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        withoutPool ? stageIO.origOutputDesc.dims() : stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        withoutPool ? false : stageOptions.withPool
+    };
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    //
+    // Try to find "best" tiling
+    //
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    StageVector origStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+    std::vector<HWTilingNS::ConvolutionOptions> optionsWithoutPool;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -44,61 +79,43 @@ void PassImpl::run(const Model& model) {
             continue;
         }
 
-        const HWConvStageOptions stageOptions(origStage);
-        const HWConvStageIO stageIO(origStage, origStage->output(0));
+        origStages.push_back(origStage);
+        convolutionOptions.push_back(makeConvolutionOptions(origStage, false));
+        optionsWithoutPool.push_back(makeConvolutionOptions(origStage, true));
+    }
 
-        //
-        // Unsupported paddings
-        //
+    //
+    // Tiling search depends on convolution parameters only, so it is run for all stages in parallel
+    // before the model is modified. Identical convolutions share the result.
+    //
 
-        //
-        // Try to find "best" tiling
-        //
+    std::vector<std::shared_ptr<const HWTilingNS::HWConvolutionTiler>> tilers(origStages.size());
+    std::vector<std::exception_ptr> errors(origStages.size());
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
+    InferenceEngine::parallel_for(origStages.size(), [&](size_t ind) {
+        try {
+            auto tiler = HWTilingNS::HWConvolutionTiler::getCached(convolutionOptions[ind], direction, tilingsCount);
+            if (!tiler->isTilingPossible() && tiler->withPool()) {
+                tiler = HWTilingNS::HWConvolutionTiler::getCached(optionsWithoutPool[ind], direction, tilingsCount);
             }
-        }();
+            tilers[ind] = std::move(tiler);
+        } catch (...) {
+            errors[ind] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (size_t ind = 0; ind < origStages.size(); ++ind) {
+        const auto& origStage = origStages[ind];
+        const auto& tiler = *tilers[ind];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
@@ -0,0 +1,81 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// Transpose becomes a Permute node, which takes its JIT kernel from the process-wide cache. The cache is shared
+// by all tests of the process, so every test uses its own shape and checks the differences of the counters.
+std::shared_ptr<ngraph::Function> makeTranspose(const ngraph::Shape& shape) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    auto order = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 2, 3, 1});
+    auto transpose = std::make_shared<ngraph::opset1::Transpose>(param, order);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{transpose}, ngraph::ParameterVector{param});
+}
+
+std::map<std::string, uint64_t> statistics(Core& ie) {
+    return ie.GetMetric("CPU", METRIC_KEY(CPU_JIT_KERNEL_CACHE_STATISTICS));
+}
+
+}  // namespace
+
+TEST(CPUJitKernelCacheTests, SecondNetworkReusesKernels) {
+    Core ie;
+    CNNNetwork network(makeTranspose({1, 3, 16, 32}));
+
+    auto first = ie.LoadNetwork(network, "CPU");
+    auto before = statistics(ie);
+    ASSERT_GT(before["KERNELS"], 0u);
+
+    auto second = ie.LoadNetwork(network, "CPU");
+    auto after = statistics(ie);
+    EXPECT_EQ(before["MISSES"], after["MISSES"]);
+    EXPECT_EQ(before["KERNELS"], after["KERNELS"]);
+    EXPECT_GT(after["HITS"], before["HITS"]);
+
+    // the shared kernel is executed by both networks
+    auto firstRequest = first.CreateInferRequest();
+    auto secondRequest = second.CreateInferRequest();
+    ASSERT_NO_THROW(firstRequest.Infer());
+    ASSERT_NO_THROW(secondRequest.Infer());
+}
+
+TEST(CPUJitKernelCacheTests, StreamsShareKernels) {
+    Core ie;
+    CNNNetwork network(makeTranspose({1, 5, 8, 24}));
+
+    auto before = statistics(ie);
+    // the graphs of the streams are created in parallel, both may miss, but only one kernel is kept
+    auto executableNetwork = ie.LoadNetwork(network, "CPU", {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}});
+    auto after = statistics(ie);
+    EXPECT_EQ(2u, after["HITS"] + after["MISSES"] - before["HITS"] - before["MISSES"]);
+    EXPECT_EQ(before["KERNELS"] + 1, after["KERNELS"]);
+}
+
+TEST(CPUJitKernelCacheTests, CapacityIsSetByConfig) {
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(CPU_JIT_KERNEL_CACHE_CAPACITY), "0"}}, "CPU");
+    EXPECT_EQ("0", ie.GetConfig("CPU", CONFIG_KEY(CPU_JIT_KERNEL_CACHE_CAPACITY)).as<std::string>());
+    EXPECT_EQ(0u, statistics(ie)["KERNELS"]);
+
+    // the network gets its own kernel, which is not cached
+    auto executableNetwork = ie.LoadNetwork(CNNNetwork(makeTranspose({1, 7, 4, 12})), "CPU");
+    EXPECT_EQ(0u, statistics(ie)["KERNELS"]);
+    auto request = executableNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+
+    ie.SetConfig({{CONFIG_KEY(CPU_JIT_KERNEL_CACHE_CAPACITY), std::to_string(16 * 1024 * 1024)}}, "CPU");
+}
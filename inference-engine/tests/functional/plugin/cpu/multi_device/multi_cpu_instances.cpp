@@ -0,0 +1,56 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <multi-device/multi_device_config.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeRelu() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{param});
+}
+
+using Statistics = std::map<std::string, std::map<std::string, float>>;
+
+}  // namespace
+
+TEST(MultiCPUInstancesTests, EveryEntryOfTheDeviceGetsItsOwnRequests) {
+    Core ie;
+    auto executableNetwork = ie.LoadNetwork(CNNNetwork(makeRelu()), "MULTI:CPU(1),CPU(1)");
+
+    Statistics statistics = executableNetwork.GetMetric(MULTI_METRIC_KEY(DEVICE_STATISTICS));
+    ASSERT_EQ(statistics.size(), 2);
+    ASSERT_EQ(statistics.count("CPU"), 1);
+    ASSERT_EQ(statistics.count("CPU#2"), 1);
+    EXPECT_EQ(statistics["CPU"]["REQUESTS"], 1.f);
+    EXPECT_EQ(statistics["CPU#2"]["REQUESTS"], 1.f);
+
+    // each entry has a single request, so two requests in flight keep both of them busy
+    const int iterations = 20;
+    std::vector<InferRequest> requests = {executableNetwork.CreateInferRequest(), executableNetwork.CreateInferRequest()};
+    for (int i = 0; i < iterations; i++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+    }
+
+    statistics = executableNetwork.GetMetric(MULTI_METRIC_KEY(DEVICE_STATISTICS)).as<Statistics>();
+    EXPECT_GT(statistics["CPU"]["COMPLETED"], 0.f);
+    EXPECT_GT(statistics["CPU#2"]["COMPLETED"], 0.f);
+    EXPECT_EQ(statistics["CPU"]["COMPLETED"] + statistics["CPU#2"]["COMPLETED"], 2.f * iterations);
+}
@@ -0,0 +1,17 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <behavior/load_network_phases.hpp>
+#include <common_test_utils/test_constants.hpp>
+
+namespace {
+
+const LoadNetworkPhasesParams params[] = {
+    LoadNetworkPhasesParams { CommonTestUtils::DEVICE_CPU, {} },
+    LoadNetworkPhasesParams { CommonTestUtils::DEVICE_CPU, { { CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2" } } },
+};
+
+}  // namespace
+
+INSTANTIATE_TEST_CASE_P(CPU, LoadNetworkPhasesTests, testing::ValuesIn(params), LoadNetworkPhasesTests::getTestCaseName);
@@ -0,0 +1,263 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "network_serializer.h"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const size_t batch = 4, channels = 16, spatial = 2, outputs = 32;
+const size_t inputs = channels * spatial * spatial;
+const size_t convWeights = channels * channels;
+
+std::string dims(const SizeVector& shape) {
+    std::string result;
+    for (auto dim : shape)
+        result += "<dim>" + std::to_string(dim) + "</dim>";
+    return result;
+}
+
+std::string blobs(size_t offset, size_t weights, size_t biases) {
+    return R"V0G0N(
+            <blobs>
+                <weights offset=")V0G0N" + std::to_string(offset * sizeof(float)) + R"V0G0N(" size=")V0G0N" +
+                std::to_string(weights * sizeof(float)) + R"V0G0N("/>
+                <biases offset=")V0G0N" + std::to_string((offset + weights) * sizeof(float)) + R"V0G0N(" size=")V0G0N" +
+                std::to_string(biases * sizeof(float)) + R"V0G0N("/>
+            </blobs>)V0G0N";
+}
+
+std::string layer(const std::string& name, const std::string& type, size_t id, const std::string& data,
+                  const SizeVector& in, const SizeVector& out, const std::string& weights = "") {
+    return R"V0G0N(
+        <layer name=")V0G0N" + name + R"V0G0N(" type=")V0G0N" + type + R"V0G0N(" precision="FP32" id=")V0G0N" +
+        std::to_string(id) + R"V0G0N(">)V0G0N" + data + R"V0G0N(
+            <input>
+                <port id="0">)V0G0N" + dims(in) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + dims(out) + R"V0G0N(</port>
+            </output>)V0G0N" + weights + R"V0G0N(
+        </layer>)V0G0N";
+}
+
+// input -> [Convolution ->] fc -> [ReLU]
+// The convolution makes the input of the FullyConnected layer blocked, the ReLU is fused into it.
+// The weights of fc have ~10% of non-zeros by default, the seed changes their values, but not the names of the layers.
+CNNNetwork makeNetwork(Core& ie, bool withConvolution, bool withRelu, unsigned seed = 1,
+                       size_t fcInputs = inputs, size_t fcOutputs = outputs, float density = 0.1f) {
+    const SizeVector inDims = withConvolution ? SizeVector{batch, channels, spatial, spatial} : SizeVector{batch, fcInputs};
+    const SizeVector outDims = {batch, fcOutputs};
+    const size_t fcWeights = fcOutputs * fcInputs;
+
+    std::string model = R"V0G0N(
+<net name="SparseFC" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">)V0G0N" + dims(inDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    std::string edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>)V0G0N";
+    size_t id = 1, offset = 0;
+    if (withConvolution) {
+        model += layer("conv", "Convolution", id++, R"V0G0N(
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output=")V0G0N" +
+            std::to_string(channels) + R"V0G0N(" group="1"/>)V0G0N", inDims, inDims, blobs(offset, convWeights, channels));
+        edges += R"V0G0N(
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>)V0G0N";
+        offset += convWeights + channels;
+    }
+    model += layer("fc", "FullyConnected", id++, R"V0G0N(
+            <fc_data out-size=")V0G0N" + std::to_string(fcOutputs) + R"V0G0N("/>)V0G0N", inDims, outDims,
+            blobs(offset, fcWeights, fcOutputs));
+    offset += fcWeights + fcOutputs;
+    if (withRelu) {
+        model += layer("relu", "ReLU", id, "", outDims, outDims);
+        edges += R"V0G0N(
+        <edge from-layer=")V0G0N" + std::to_string(id - 1) + R"V0G0N(" from-port="1" to-layer=")V0G0N" +
+        std::to_string(id) + R"V0G0N(" to-port="0"/>)V0G0N";
+    }
+    model += R"V0G0N(
+    </layers>
+    <edges>)V0G0N" + edges + R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, {offset * sizeof(float)}, Layout::C});
+    weights->allocate();
+    auto data = weights->buffer().as<float*>();
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> values(-1.f, 1.f);
+    std::bernoulli_distribution nonZero(density);
+    const size_t fcOffset = withConvolution ? convWeights + channels : 0;
+    for (size_t i = 0; i < offset; i++) {
+        const bool isFcWeight = i >= fcOffset && i < fcOffset + fcWeights;
+        data[i] = !isFcWeight || nonZero(gen) ? values(gen) : 0.f;
+    }
+    return ie.ReadNetwork(model, weights);
+}
+
+std::map<std::string, std::string> sparse(std::map<std::string, std::string> config = {}) {
+    config[CONFIG_KEY(CPU_SPARSE_WEIGHTS_DENSITY)] = "0.3";
+    return config;
+}
+
+IE_SUPPRESS_DEPRECATED_START
+std::string fcPrimitiveType(ExecutableNetwork& executableNetwork) {
+    CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+    for (auto& node : Serialization::TopologicalSort(execGraphInfo)) {
+        if (node->type == "FullyConnected")
+            return node->params["primitiveType"];
+    }
+    return {};
+}
+IE_SUPPRESS_DEPRECATED_END
+
+std::vector<float> infer(ExecutableNetwork& executableNetwork, int dynamicBatch = 0) {
+    auto request = executableNetwork.CreateInferRequest();
+    auto input = request.GetBlob(executableNetwork.GetInputsInfo().begin()->first);
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = static_cast<float>(i % 13) / 13.f - 0.5f;
+    if (dynamicBatch)
+        request.SetBatch(dynamicBatch);
+    request.Infer();
+
+    auto output = request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+    const size_t size = dynamicBatch ? dynamicBatch * outputs : output->size();
+    auto result = output->cbuffer().as<const float*>();
+    return {result, result + size};
+}
+
+void expectNear(const std::vector<float>& expected, const std::vector<float>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_NEAR(expected[i], actual[i], 1e-4f) << "at " << i;
+}
+
+}  // namespace
+
+TEST(CPUSparseWeightsTests, SparsePathIsChosen) {
+    Core ie;
+    auto network = makeNetwork(ie, false, false);
+
+    auto dense = ie.LoadNetwork(network, "CPU");
+    auto packed = ie.LoadNetwork(network, "CPU", sparse());
+    EXPECT_EQ(std::string::npos, fcPrimitiveType(dense).find("sparse"));
+    EXPECT_EQ("sparse_FP32", fcPrimitiveType(packed));
+    expectNear(infer(dense), infer(packed));
+}
+
+TEST(CPUSparseWeightsTests, DenserWeightsAreNotPacked) {
+    Core ie;
+    auto network = makeNetwork(ie, false, false);
+
+    auto executableNetwork = ie.LoadNetwork(network, "CPU", {{CONFIG_KEY(CPU_SPARSE_WEIGHTS_DENSITY), "0.01"}});
+    EXPECT_EQ(std::string::npos, fcPrimitiveType(executableNetwork).find("sparse"));
+}
+
+TEST(CPUSparseWeightsTests, FusedActivationFallsBackToDense) {
+    Core ie;
+    auto network = makeNetwork(ie, false, true);
+
+    auto dense = ie.LoadNetwork(network, "CPU");
+    auto fused = ie.LoadNetwork(network, "CPU", sparse());
+    EXPECT_EQ(std::string::npos, fcPrimitiveType(fused).find("sparse"));
+    expectNear(infer(dense), infer(fused));
+}
+
+TEST(CPUSparseWeightsTests, BlockedInputFallsBackToDense) {
+    Core ie;
+    auto network = makeNetwork(ie, true, false);
+
+    auto dense = ie.LoadNetwork(network, "CPU");
+    auto blocked = ie.LoadNetwork(network, "CPU", sparse());
+    // the convolution produces a blocked layout on the targets with jit convolutions only, the planar one is packed
+    IE_SUPPRESS_DEPRECATED_START
+    CNNNetwork execGraphInfo = blocked.GetExecGraphInfo();
+    for (auto& node : Serialization::TopologicalSort(execGraphInfo)) {
+        if (node->type == "Convolution" && node->params["outputLayouts"] != "nchw")
+            EXPECT_EQ(std::string::npos, fcPrimitiveType(blocked).find("sparse"));
+    }
+    IE_SUPPRESS_DEPRECATED_END
+    expectNear(infer(dense), infer(blocked));
+}
+
+TEST(CPUSparseWeightsTests, DynamicBatchProcessesRequestedRows) {
+    Core ie;
+    auto network = makeNetwork(ie, false, false);
+    const std::map<std::string, std::string> dynBatch = {{CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_VALUE(YES)}};
+
+    auto dense = ie.LoadNetwork(network, "CPU", dynBatch);
+    auto packed = ie.LoadNetwork(network, "CPU", sparse(dynBatch));
+    ASSERT_EQ("sparse_FP32", fcPrimitiveType(packed));
+    for (int rows : {1, 3, static_cast<int>(batch)})
+        expectNear(infer(dense, rows), infer(packed, rows));
+}
+
+TEST(CPUSparseWeightsTests, WeightsCacheKeepsPackedAndDenseWeightsApart) {
+    // all networks loaded by one Core share the weights cache of the plugin, the layers have the same names
+    Core ie, reference;
+    auto first = makeNetwork(ie, false, false, 1);
+    auto second = makeNetwork(ie, false, false, 2);
+
+    auto dense = ie.LoadNetwork(first, "CPU");
+    auto packed = ie.LoadNetwork(first, "CPU", sparse());
+    auto packedAgain = ie.LoadNetwork(first, "CPU", sparse());
+    auto packedOther = ie.LoadNetwork(second, "CPU", sparse());
+    ASSERT_EQ("sparse_FP32", fcPrimitiveType(packed));
+
+    auto firstExpected = reference.LoadNetwork(first, "CPU");
+    auto secondExpected = reference.LoadNetwork(second, "CPU");
+    const auto expected = infer(firstExpected);
+    expectNear(expected, infer(dense));
+    expectNear(expected, infer(packed));
+    expectNear(expected, infer(packedAgain));
+    expectNear(infer(secondExpected), infer(packedOther));
+}
+
+// Times the dense mkldnn inner product against the packed kernel on the same layer for several densities of weights,
+// run with --gtest_also_run_disabled_tests. Sizes of packed weights are reported by BlockSparseWeightsTest.DISABLED_PackedSize
+TEST(CPUSparseWeightsTests, DISABLED_Performance) {
+    auto measure = [](ExecutableNetwork& executableNetwork) {
+        const int iterations = 1000;
+        auto request = executableNetwork.CreateInferRequest();
+        request.Infer();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            request.Infer();
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+    };
+
+    for (float density : {0.01f, 0.05f, 0.1f, 0.2f, 0.3f, 0.5f}) {
+        // separate cores, so the weights cache of the plugin does not keep weights of the previous density
+        Core ie;
+        auto network = makeNetwork(ie, false, false, 1, 1024, 1024, density);
+        network.setBatchSize(64);
+
+        auto dense = ie.LoadNetwork(network, "CPU");
+        auto packed = ie.LoadNetwork(network, "CPU", {{CONFIG_KEY(CPU_SPARSE_WEIGHTS_DENSITY), "1"}});
+        ASSERT_EQ("sparse_FP32", fcPrimitiveType(packed));
+        const double denseTime = measure(dense);
+        const double packedTime = measure(packed);
+        std::cout << "density " << density << ": " << fcPrimitiveType(dense) << " " << denseTime << " us, "
+                  << fcPrimitiveType(packed) << " " << packedTime << " us, speedup " << denseTime / packedTime << std::endl;
+    }
+}
@@ -0,0 +1,16 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <behavior/compiled_model_cache.hpp>
+#include <common_test_utils/test_constants.hpp>
+
+namespace {
+
+const CompiledModelCacheParams params[] = {
+    CompiledModelCacheParams { CommonTestUtils::DEVICE_MYRIAD, {} },
+};
+
+}  // namespace
+
+INSTANTIATE_TEST_CASE_P(MYRIAD, CompiledModelCacheTests, testing::ValuesIn(params), CompiledModelCacheTests::getTestCaseName);
@@ -0,0 +1,112 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_core.hpp>
+#include <ie_iextension.h>
+#include <ie_plugin_config.hpp>
+
+#include <common_test_utils/file_utils.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+using CompiledModelCacheParams = std::tuple<std::string, std::map<std::string, std::string>>;
+
+class CompiledModelCacheTests : public ::testing::TestWithParam<CompiledModelCacheParams> {
+public:
+    // the extension does not implement anything, it changes the cache key only
+    class EmptyExtension : public InferenceEngine::IExtension {
+    public:
+        void GetVersion(const InferenceEngine::Version*& versionInfo) const noexcept override {
+            static const InferenceEngine::Version version = {{2, 1}, "1", "CompiledModelCacheTests extension"};
+            versionInfo = &version;
+        }
+        void Unload() noexcept override {}
+        void Release() noexcept override {}
+    };
+
+    void SetUp() override {
+        std::tie(deviceName, config) = GetParam();
+        // the model name is unique, so the entries left by the previous runs are never hit,
+        // and the directory is bounded by CACHE_MAX_SIZE
+        const auto name = "compiled_model_cache_" + deviceName + "_" +
+            std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+        modelPath = name + ".xml";
+        weightsPath = name + ".bin";
+        auto function = ngraph::builder::subgraph::makeConvPoolRelu();
+        function->set_friendly_name(name);
+        InferenceEngine::CNNNetwork(function).serialize(modelPath, weightsPath);
+
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "compiled_model_cache"}, {CONFIG_KEY(CACHE_MAX_SIZE), "16"}});
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+    }
+
+    static std::string getTestCaseName(const testing::TestParamInfo<CompiledModelCacheParams>& obj) {
+        std::string deviceName;
+        std::map<std::string, std::string> config;
+        std::tie(deviceName, config) = obj.param;
+        std::string name = deviceName;
+        for (auto&& entry : config) {
+            name += "_" + entry.first + "_" + entry.second;
+        }
+        return name;
+    }
+
+    std::map<std::string, float> statistics() {
+        return ie.GetMetric("", METRIC_KEY(COMPILED_MODEL_CACHE_STATISTICS));
+    }
+
+    void loadAndInfer() {
+        auto executableNetwork = ie.LoadNetwork(modelPath, deviceName, config);
+        auto request = executableNetwork.CreateInferRequest();
+        ASSERT_NO_THROW(request.Infer());
+    }
+
+    InferenceEngine::Core ie;
+    std::string deviceName;
+    std::map<std::string, std::string> config;
+    std::string modelPath;
+    std::string weightsPath;
+};
+
+TEST_P(CompiledModelCacheTests, smoke_SecondLoadIsImported) {
+    ASSERT_TRUE(ie.GetMetric(deviceName, METRIC_KEY(IMPORT_EXPORT_SUPPORT)).as<bool>());
+
+    loadAndInfer();
+    auto counters = statistics();
+    EXPECT_EQ(0.f, counters["HITS"]);
+    EXPECT_EQ(1.f, counters["MISSES"]);
+
+    loadAndInfer();
+    counters = statistics();
+    EXPECT_EQ(1.f, counters["HITS"]);
+    EXPECT_EQ(1.f, counters["MISSES"]);
+    EXPECT_GE(counters["SAVED_COMPILE_TIME_MS"], 0.f);
+}
+
+TEST_P(CompiledModelCacheTests, smoke_ExtensionChangesKey) {
+    loadAndInfer();
+
+    ie.AddExtension(std::make_shared<EmptyExtension>(), deviceName);
+    loadAndInfer();
+    auto counters = statistics();
+    EXPECT_EQ(0.f, counters["HITS"]);
+    EXPECT_EQ(2.f, counters["MISSES"]);
+
+    loadAndInfer();
+    counters = statistics();
+    EXPECT_EQ(1.f, counters["HITS"]);
+    EXPECT_EQ(2.f, counters["MISSES"]);
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include <ngraph_functions/subgraph_builders.hpp>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using LoadNetworkPhasesParams = std::tuple<std::string, std::map<std::string, std::string>>;
+
+class LoadNetworkPhasesTests : public ::testing::TestWithParam<LoadNetworkPhasesParams> {
+public:
+    void SetUp() override {
+        std::tie(deviceName, config) = GetParam();
+    }
+
+    static std::string getTestCaseName(const testing::TestParamInfo<LoadNetworkPhasesParams>& obj) {
+        std::string deviceName;
+        std::map<std::string, std::string> config;
+        std::tie(deviceName, config) = obj.param;
+        std::string name = deviceName;
+        for (auto&& entry : config) {
+            name += "_" + entry.first + "_" + entry.second;
+        }
+        return name;
+    }
+
+    std::map<std::string, float> loadNetworkPhases(InferenceEngine::Core& ie, const std::shared_ptr<ngraph::Function>& function) {
+        auto executableNetwork = ie.LoadNetwork(InferenceEngine::CNNNetwork(function), deviceName, config);
+        std::vector<std::string> supportedMetrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+        EXPECT_NE(supportedMetrics.end(), std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(COMPILE_PHASES)));
+        return executableNetwork.GetMetric(METRIC_KEY(COMPILE_PHASES));
+    }
+
+    std::string deviceName;
+    std::map<std::string, std::string> config;
+};
+
+TEST_P(LoadNetworkPhasesTests, smoke_PhasesAreReported) {
+    InferenceEngine::Core ie;
+    auto phases = loadNetworkPhases(ie, ngraph::builder::subgraph::makeConvPoolRelu());
+
+    ASSERT_NE(phases.end(), phases.find("LoadNetwork"));
+    ASSERT_GT(phases.size(), 1u);
+    for (auto&& phase : phases) {
+        EXPECT_EQ(0u, phase.first.find("LoadNetwork")) << phase.first;
+        EXPECT_GE(phase.second, 0.f) << phase.first;
+    }
+}
+
+//
+// Loads the networks built by ngraph_functions several times and prints median durations of phases.
+// If LOAD_NETWORK_PHASES_REPORT environment variable is set, the medians are appended to this CSV file
+// with a timestamp, so the timings can be tracked over time.
+//
+TEST_P(LoadNetworkPhasesTests, DISABLED_benchmark_LoadNetworkPhases) {
+    const std::vector<std::pair<std::string, std::function<std::shared_ptr<ngraph::Function>()>>> models = {
+        {"ConvPoolRelu", [] { return ngraph::builder::subgraph::makeConvPoolRelu(); }},
+        {"SplitConvConcat", [] { return ngraph::builder::subgraph::makeSplitConvConcat(); }},
+        {"SplitMultiConvConcat", [] { return ngraph::builder::subgraph::makeSplitMultiConvConcat(); }},
+        {"TIwithLSTMcell", [] { return ngraph::builder::subgraph::makeTIwithLSTMcell(); }},
+        {"SingleConv", [] { return ngraph::builder::subgraph::makeSingleConv(); }},
+        {"MultiSingleConv", [] { return ngraph::builder::subgraph::makeMultiSingleConv(); }},
+        {"2InputSubtract", [] { return ngraph::builder::subgraph::make2InputSubtract(); }},
+    };
+    constexpr int iterations = 10;
+
+    std::ofstream report;
+    if (const char* reportPath = std::getenv("LOAD_NETWORK_PHASES_REPORT")) {
+        report.open(reportPath, std::ios::app);
+    }
+    const auto timestamp = std::time(nullptr);
+
+    InferenceEngine::Core ie;
+    for (auto&& model : models) {
+        std::map<std::string, std::vector<float>> durations;
+        for (int i = 0; i < iterations; i++) {
+            for (auto&& phase : loadNetworkPhases(ie, model.second())) {
+                durations[phase.first].push_back(phase.second);
+            }
+        }
+
+        std::cout << model.first << std::endl;
+        for (auto&& phase : durations) {
+            auto& values = phase.second;
+            std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+            const float median = values[values.size() / 2];
+            std::cout << "    " << phase.first << ": " << median << " ms" << std::endl;
+            if (report.is_open()) {
+                report << timestamp << "," << deviceName << "," << model.first << "," << phase.first << "," << median << std::endl;
+            }
+        }
+    }
+}
@@ -0,0 +1,186 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "mkldnn_graph_test_utils.hpp"
+
+using namespace MKLDNNGraphTestUtils;
+
+namespace {
+
+std::atomic<bool> countAllocations{false};
+std::atomic<size_t> allocationsNum{0};
+
+void* allocate(size_t size) {
+    if (countAllocations)
+        allocationsNum++;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+// Counts operator new calls made by the current scope
+class AllocationsCounter {
+public:
+    AllocationsCounter() {
+        allocationsNum = 0;
+        countAllocations = true;
+    }
+
+    ~AllocationsCounter() {
+        countAllocations = false;
+    }
+
+    size_t count() const {
+        return allocationsNum;
+    }
+};
+
+}  // namespace
+
+void* operator new(size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](size_t size) {
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+const size_t C = 16, H = 8, W = 8;
+const size_t weightsSize = C * C * sizeof(float);
+const size_t biasesSize = C * sizeof(float);
+
+std::string convolution(const std::string& name, size_t id, const InferenceEngine::SizeVector& shape) {
+    return R"V0G0N(
+        <layer name=")V0G0N" + name + R"V0G0N(" type="Convolution" precision="FP32" id=")V0G0N" + std::to_string(id) + R"V0G0N(">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="0">)V0G0N" + irDims(shape) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + irDims(shape) + R"V0G0N(</port>
+            </output>
+            <blobs>
+                <weights offset="0" size=")V0G0N" + std::to_string(weightsSize) + R"V0G0N("/>
+                <biases offset=")V0G0N" + std::to_string(weightsSize) + R"V0G0N(" size=")V0G0N" + std::to_string(biasesSize) + R"V0G0N("/>
+            </blobs>
+        </layer>)V0G0N";
+}
+
+// Convolutions and pooling work in a blocked layout, so reorders are inserted for the planar input and output
+std::string getModel() {
+    const InferenceEngine::SizeVector inDims = {1, C, H, W};
+    const InferenceEngine::SizeVector outDims = {1, C, H / 2, W / 2};
+    std::string model = R"V0G0N(
+<net Name="ConvPool_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">)V0G0N" + irDims(inDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    model += convolution("conv1", 1, inDims);
+    model += R"V0G0N(
+        <layer name="pool" type="Pooling" precision="FP32" id="2">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" pool-method="max"/>
+            <input>
+                <port id="0">)V0G0N" + irDims(inDims) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    model += convolution("conv2", 3, outDims);
+    model += R"V0G0N(
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    return model;
+}
+
+InferenceEngine::Blob::Ptr getWeights() {
+    auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+            {InferenceEngine::Precision::U8, {weightsSize + biasesSize}, InferenceEngine::Layout::C});
+    weights->allocate();
+    auto data = weights->buffer().as<float*>();
+    for (size_t i = 0; i < (weightsSize + biasesSize) / sizeof(float); i++)
+        data[i] = static_cast<float>(i % 7) - 3.f;
+    return weights;
+}
+
+}  // namespace
+
+TEST(MKLDNNAllocationFreeInferTest, SteadyStateInferDoesNotAllocate) {
+    InferenceEngine::Core core;
+    auto network = core.ReadNetwork(getModel(), getWeights());
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+
+    InferenceEngine::BlobMap inputs, outputs;
+    graph.getInputBlobs(inputs);
+    graph.getOutputBlobs(outputs);
+    ASSERT_EQ(inputs.size(), 1);
+    ASSERT_EQ(outputs.size(), 1);
+
+    // Nodes which submit an mkldnn primitive on every inference
+    size_t submittingNodes = 0, reorders = 0;
+    for (auto& node : graph.GetNodes()) {
+        if (node->isConstant())
+            continue;
+        auto type = node->getType();
+        if (type == MKLDNNPlugin::Reorder)
+            reorders++;
+        if (type == MKLDNNPlugin::Reorder || type == MKLDNNPlugin::Convolution || type == MKLDNNPlugin::Pooling)
+            submittingNodes++;
+    }
+    ASSERT_GT(reorders, 0) << "the graph is expected to have real reorder primitives";
+
+    // warm up: lazily created caches are filled by first inferences
+    for (int i = 0; i < 3; i++)
+        graph.InferWithBlobs(inputs, outputs);
+
+    // mkldnn eager stream records submitted primitives and can not be reused, so every Infer() call
+    // creates a new one. mkldnn allocates on stream creation and on submissions, which can not be avoided
+    // without changes in mkldnn. Everything else must not allocate, so Infer() has to cost exactly as much
+    // as a stream with the same number of single primitive submissions.
+    mkldnn::engine engine(mkldnn::engine::kind::cpu, 0);
+    mkldnn::memory::primitive_desc pd({{1}, mkldnn::memory::data_type::f32, mkldnn::memory::format::x}, engine);
+    mkldnn::memory src(pd), dst(pd);
+    mkldnn::reorder copy(src, dst);
+    size_t streamAllocations = 0;
+    {
+        AllocationsCounter counter;
+        mkldnn::stream stream(mkldnn::stream::kind::eager);
+        for (size_t i = 0; i < submittingNodes; i++)
+            MKLDNNPlugin::MKLDNNPrimitive::submit(stream, copy);
+        streamAllocations = counter.count();
+    }
+
+    for (int i = 0; i < 10; i++) {
+        AllocationsCounter counter;
+        graph.InferWithBlobs(inputs, outputs);
+        EXPECT_EQ(counter.count(), streamAllocations) << "iteration: " << i;
+    }
+}
@@ -0,0 +1,317 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_graph_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNGraphTestUtils;
+
+namespace {
+
+// The layer under test is placed between two identity 1x1 convolutions, so it gets blocked
+// neighbours and the network output is equal to the output of the layer itself
+const size_t C = 16, H = 4, W = 5;
+const size_t weightsSize = C * C * sizeof(float);
+const size_t biasesSize = C * sizeof(float);
+const size_t constOffset = weightsSize + biasesSize;
+
+std::string convolution(const std::string& name, size_t id, const SizeVector& shape) {
+    return R"V0G0N(
+        <layer name=")V0G0N" + name + R"V0G0N(" type="Convolution" precision="FP32" id=")V0G0N" + std::to_string(id) + R"V0G0N(">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="0">)V0G0N" + irDims(shape) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + irDims(shape) + R"V0G0N(</port>
+            </output>
+            <blobs>
+                <weights offset="0" size=")V0G0N" + std::to_string(weightsSize) + R"V0G0N("/>
+                <biases offset=")V0G0N" + std::to_string(weightsSize) + R"V0G0N(" size=")V0G0N" + std::to_string(biasesSize) + R"V0G0N("/>
+            </blobs>
+        </layer>)V0G0N";
+}
+
+std::string constInput(const std::string& name, size_t id, size_t index) {
+    return R"V0G0N(
+        <layer name=")V0G0N" + name + R"V0G0N(" type="Const" precision="I32" id=")V0G0N" + std::to_string(id) + R"V0G0N(">
+            <output>
+                <port id="0"><dim>4</dim></port>
+            </output>
+            <blobs>
+                <custom offset=")V0G0N" + std::to_string(constOffset + index * 4 * sizeof(int32_t)) + R"V0G0N(" size="16"/>
+            </blobs>
+        </layer>)V0G0N";
+}
+
+// layer is the XML of the layer with id 2, its input port is 0 and its output port is 4
+std::string getModel(const std::string& layer, const SizeVector& outDims, size_t constInputs) {
+    const SizeVector inDims = {1, C, H, W};
+    std::string model = R"V0G0N(
+<net Name="BlockedExtensions_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">)V0G0N" + irDims(inDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    model += convolution("conv1", 1, inDims);
+    model += layer;
+    model += convolution("conv2", 3, outDims);
+    for (size_t i = 0; i < constInputs; i++)
+        model += constInput("const" + std::to_string(i), 5 + i, i);
+    model += R"V0G0N(
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="0"/>)V0G0N";
+    for (size_t i = 0; i < constInputs; i++)
+        model += R"V0G0N(
+        <edge from-layer=")V0G0N" + std::to_string(5 + i) + R"V0G0N(" from-port="0" to-layer="2" to-port=")V0G0N" +
+                 std::to_string(i + 1) + R"V0G0N("/>)V0G0N";
+    model += R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+    return model;
+}
+
+Blob::Ptr getWeights(const std::vector<int32_t>& constData) {
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, {constOffset + constData.size() * sizeof(int32_t)}, Layout::C});
+    weights->allocate();
+    auto data = weights->buffer().as<uint8_t*>();
+    std::memset(data, 0, weights->byteSize());
+
+    auto identity = reinterpret_cast<float*>(data);
+    for (size_t c = 0; c < C; c++)
+        identity[c * C + c] = 1.f;
+    std::memcpy(data + constOffset, constData.data(), constData.size() * sizeof(int32_t));
+    return weights;
+}
+
+// Runs the network and checks that no reorder was inserted around the layer
+std::vector<float> infer(const std::string& model, const std::vector<int32_t>& constData, const std::string& layerName) {
+    Core core;
+    auto network = core.ReadNetwork(model, getWeights(constData));
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+
+    size_t reorders = 0;
+    bool found = false;
+    for (auto& node : graph.GetNodes()) {
+        if (node->getType() == MKLDNNPlugin::Reorder)
+            reorders++;
+        if (node->getName() != layerName)
+            continue;
+        found = true;
+        EXPECT_NE(node->getParentEdgeAt(0)->getParent()->getType(), MKLDNNPlugin::Reorder);
+        EXPECT_NE(node->getChildEdgeAt(0)->getChild()->getType(), MKLDNNPlugin::Reorder);
+    }
+    EXPECT_TRUE(found);
+    // only the network input and output are converted to the planar layout, a planar-only layer adds a reorder
+    // pair around itself
+    EXPECT_LE(reorders, 2) << "reorders in the graph: " << reorders;
+    ::testing::Test::RecordProperty("reorders", static_cast<int>(reorders));
+
+    auto input = make_shared_blob<float>({Precision::FP32, {1, C, H, W}, Layout::NCHW});
+    input->allocate();
+    auto src = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        src[i] = static_cast<float>(i % 23) * 0.5f - 5.f;
+    graph.PushInputData("input", input);
+    graph.Infer();
+
+    BlobMap outputs;
+    graph.PullOutputData(outputs);
+    EXPECT_EQ(outputs.size(), 1);
+    auto output = outputs.begin()->second;
+    auto dst = output->cbuffer().as<const float*>();
+    return std::vector<float>(dst, dst + output->size());
+}
+
+float inputValue(size_t c, size_t h, size_t w) {
+    return static_cast<float>(((c * H + h) * W + w) % 23) * 0.5f - 5.f;
+}
+
+}  // namespace
+
+TEST(MKLDNNBlockedExtensionsTest, PadKeepsBlockedLayout) {
+    const int padsBegin[] = {1, 2};
+    const SizeVector outDims = {1, C, H + 3, W + 3};
+    const std::string pad = R"V0G0N(
+        <layer name="pad" type="Pad" precision="FP32" id="2">
+            <data pads_begin="0,0,1,2" pads_end="0,0,2,1" pad_mode="reflect"/>
+            <input>
+                <port id="0">)V0G0N" + irDims({1, C, H, W}) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="4">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+
+    auto output = infer(getModel(pad, outDims, 0), {}, "pad");
+    ASSERT_EQ(output.size(), C * outDims[2] * outDims[3]);
+
+    auto reflect = [](int c, int begin, int size) {
+        c -= begin;
+        return c < 0 ? -c : (c >= size ? 2 * (size - 1) - c : c);
+    };
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < outDims[2]; h++) {
+            for (size_t w = 0; w < outDims[3]; w++) {
+                float expected = inputValue(c, reflect(h, padsBegin[0], H), reflect(w, padsBegin[1], W));
+                EXPECT_EQ(output[(c * outDims[2] + h) * outDims[3] + w], expected) << "c: " << c << " h: " << h << " w: " << w;
+            }
+        }
+    }
+}
+
+TEST(MKLDNNBlockedExtensionsTest, StridedSliceKeepsBlockedLayout) {
+    const SizeVector outDims = {1, C, 3, 3};
+    const std::string stridedSlice = R"V0G0N(
+        <layer name="slice" type="StridedSlice" precision="FP32" id="2">
+            <data begin_mask="1,1,1,1" end_mask="1,1,1,1" ellipsis_mask="" new_axis_mask="" shrink_axis_mask=""/>
+            <input>
+                <port id="0">)V0G0N" + irDims({1, C, H, W}) + R"V0G0N(</port>
+                <port id="1"><dim>4</dim></port>
+                <port id="2"><dim>4</dim></port>
+                <port id="3"><dim>4</dim></port>
+            </input>
+            <output>
+                <port id="4">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    // begin, end and strides: rows 1..3 and every second column
+    const std::vector<int32_t> constData = {0, 0, 1, 0,  1, 16, 4, 5,  1, 1, 1, 2};
+
+    auto output = infer(getModel(stridedSlice, outDims, 3), constData, "slice");
+    ASSERT_EQ(output.size(), C * outDims[2] * outDims[3]);
+
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < outDims[2]; h++) {
+            for (size_t w = 0; w < outDims[3]; w++) {
+                EXPECT_EQ(output[(c * outDims[2] + h) * outDims[3] + w], inputValue(c, 1 + h, 2 * w))
+                    << "c: " << c << " h: " << h << " w: " << w;
+            }
+        }
+    }
+}
+
+TEST(MKLDNNBlockedExtensionsTest, TileKeepsBlockedLayout) {
+    const SizeVector outDims = {1, C, 2 * H, W};
+    const std::string tile = R"V0G0N(
+        <layer name="tile" type="Tile" precision="FP32" id="2">
+            <data axis="2" tiles="2"/>
+            <input>
+                <port id="0">)V0G0N" + irDims({1, C, H, W}) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="4">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+
+    auto output = infer(getModel(tile, outDims, 0), {}, "tile");
+    ASSERT_EQ(output.size(), C * outDims[2] * outDims[3]);
+
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < outDims[2]; h++) {
+            for (size_t w = 0; w < outDims[3]; w++) {
+                EXPECT_EQ(output[(c * outDims[2] + h) * outDims[3] + w], inputValue(c, h % H, w))
+                    << "c: " << c << " h: " << h << " w: " << w;
+            }
+        }
+    }
+}
+
+TEST(MKLDNNBlockedExtensionsTest, GatherKeepsBlockedLayout) {
+    const SizeVector outDims = {1, C, 4, W};
+    const std::string gather = R"V0G0N(
+        <layer name="gather" type="Gather" precision="FP32" id="2">
+            <data axis="2"/>
+            <input>
+                <port id="0">)V0G0N" + irDims({1, C, H, W}) + R"V0G0N(</port>
+                <port id="1"><dim>4</dim></port>
+            </input>
+            <output>
+                <port id="4">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    const std::vector<int32_t> indexes = {3, 0, 2, 2};
+
+    auto output = infer(getModel(gather, outDims, 1), indexes, "gather");
+    ASSERT_EQ(output.size(), C * outDims[2] * outDims[3]);
+
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < outDims[2]; h++) {
+            for (size_t w = 0; w < outDims[3]; w++) {
+                EXPECT_EQ(output[(c * outDims[2] + h) * outDims[3] + w], inputValue(c, indexes[h], w))
+                    << "c: " << c << " h: " << h << " w: " << w;
+            }
+        }
+    }
+}
+
+TEST(MKLDNNBlockedExtensionsTest, BroadcastKeepsBlockedLayout) {
+    const SizeVector outDims = {2, C, H, W};
+    const std::string broadcast = R"V0G0N(
+        <layer name="broadcast" type="Broadcast" precision="FP32" id="2">
+            <input>
+                <port id="0">)V0G0N" + irDims({1, C, H, W}) + R"V0G0N(</port>
+                <port id="1"><dim>4</dim></port>
+            </input>
+            <output>
+                <port id="4">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    const std::vector<int32_t> shape = {2, static_cast<int32_t>(C), static_cast<int32_t>(H), static_cast<int32_t>(W)};
+
+    auto output = infer(getModel(broadcast, outDims, 1), shape, "broadcast");
+    ASSERT_EQ(output.size(), 2 * C * H * W);
+
+    for (size_t n = 0; n < 2; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t h = 0; h < H; h++) {
+                for (size_t w = 0; w < W; w++) {
+                    EXPECT_EQ(output[((n * C + c) * H + h) * W + w], inputValue(c, h, w))
+                        << "n: " << n << " c: " << c << " h: " << h << " w: " << w;
+                }
+            }
+        }
+    }
+}
+
+TEST(MKLDNNBlockedExtensionsTest, ShuffleChannelsKeepsBlockedLayout) {
+    const SizeVector outDims = {1, C, H, W};
+    const std::string shuffle = R"V0G0N(
+        <layer name="shuffle" type="ShuffleChannels" precision="FP32" id="2">
+            <data axis="2" group="2"/>
+            <input>
+                <port id="0">)V0G0N" + irDims({1, C, H, W}) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="4">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+
+    auto output = infer(getModel(shuffle, outDims, 0), {}, "shuffle");
+    ASSERT_EQ(output.size(), C * H * W);
+
+    // rows are split into 2 groups and interleaved: out[a * 2 + b] = in[b * H / 2 + a]
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < H; h++) {
+            for (size_t w = 0; w < W; w++) {
+                EXPECT_EQ(output[(c * H + h) * W + w], inputValue(c, (h % 2) * (H / 2) + h / 2, w))
+                    << "c: " << c << " h: " << h << " w: " << w;
+            }
+        }
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_graph_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNGraphTestUtils;
+
+namespace {
+
+// probabilities [T = 2, N = 2, C = 2], the last class is blank
+const std::vector<float> probabilities = {
+    0.4f, 0.6f,  0.9f, 0.1f,
+    0.4f, 0.6f,  0.2f, 0.8f
+};
+
+const std::string model = R"V0G0N(
+<net Name="CTCDecoders_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="probabilities" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0"><dim>2</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="indicators" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0"><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="greedy" type="CTCGreedyDecoder" precision="FP32" id="2">
+            <data ctc_merge_repeated="1"/>
+            <input>
+                <port id="0"><dim>2</dim><dim>2</dim><dim>2</dim></port>
+                <port id="1"><dim>2</dim><dim>2</dim></port>
+            </input>
+            <output>
+                <port id="2"><dim>2</dim><dim>2</dim><dim>1</dim><dim>1</dim></port>
+            </output>
+        </layer>
+        <layer name="beam" type="CTCBeamSearchDecoder" precision="FP32" id="3">
+            <data beam_width="4" top_paths="2"/>
+            <input>
+                <port id="0"><dim>2</dim><dim>2</dim><dim>2</dim></port>
+                <port id="1"><dim>2</dim><dim>2</dim></port>
+            </input>
+            <output>
+                <port id="2"><dim>2</dim><dim>2</dim><dim>2</dim></port>
+                <port id="3"><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+std::vector<float> toVector(const Blob::Ptr& blob) {
+    auto data = blob->cbuffer().as<const float*>();
+    return std::vector<float>(data, data + blob->size());
+}
+
+}  // namespace
+
+TEST(MKLDNNCTCDecodersTest, BeamSearchFindsMostProbableLabelings) {
+    Core core;
+    auto network = core.ReadNetwork(model, Blob::CPtr());
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+
+    graph.PushInputData("probabilities", makeBlob(probabilities, {2, 2, 2}));
+    graph.PushInputData("indicators", makeBlob({1, 1, 1, 1}, {2, 2}));
+    graph.Infer();
+
+    BlobMap outputs;
+    graph.PullOutputData(outputs);
+    ASSERT_EQ(outputs.size(), 3);
+
+    // the most probable paths are blank for the first sequence and "0, blank" for the second one
+    EXPECT_EQ(toVector(outputs["greedy"]), std::vector<float>({-1, -1,  0, -1}));
+
+    // "0" has probability 0.64 against 0.36 of the empty labeling for the first sequence,
+    // and 0.92 against 0.08 for the second one
+    EXPECT_EQ(toVector(outputs["beam.0"]), std::vector<float>({0, -1, -1, -1,  0, -1, -1, -1}));
+    auto logProbs = toVector(outputs["beam.1"]);
+    ASSERT_EQ(logProbs.size(), 4);
+    EXPECT_NEAR(logProbs[0], std::log(0.64f), 1e-5f);
+    EXPECT_NEAR(logProbs[1], std::log(0.36f), 1e-5f);
+    EXPECT_NEAR(logProbs[2], std::log(0.92f), 1e-5f);
+    EXPECT_NEAR(logProbs[3], std::log(0.08f), 1e-5f);
+}
+
+TEST(MKLDNNCTCDecodersTest, BeamSearchWithoutProbabilitiesOutputIsReshaped) {
+    const std::string oneOutputModel = R"V0G0N(
+<net Name="CTCBeamSearch_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="probabilities" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0"><dim>2</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="beam" type="CTCBeamSearchDecoder" precision="FP32" id="1">
+            <data beam_width="4" top_paths="2"/>
+            <input>
+                <port id="0"><dim>2</dim><dim>2</dim><dim>2</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>2</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core core;
+    auto network = core.ReadNetwork(oneOutputModel, Blob::CPtr());
+
+    // the sequence length T is the first dimension of probabilities and the last one of sequences
+    ASSERT_NO_THROW(network.reshape({{"probabilities", {3, 2, 2}}}));
+    auto outputsInfo = network.getOutputsInfo();
+    ASSERT_EQ(outputsInfo.size(), 1);
+    EXPECT_EQ(outputsInfo.begin()->second->getTensorDesc().getDims(), SizeVector({2, 2, 3}));
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+
+    // the last timestep repeats the first one
+    std::vector<float> reshaped = probabilities;
+    reshaped.insert(reshaped.end(), probabilities.begin(), probabilities.begin() + 4);
+    graph.PushInputData("probabilities", makeBlob(reshaped, {3, 2, 2}));
+    graph.Infer();
+
+    BlobMap outputs;
+    graph.PullOutputData(outputs);
+    ASSERT_EQ(outputs.size(), 1);
+    auto sequences = toVector(outputs.begin()->second);
+    ASSERT_EQ(sequences.size(), 12);
+    // labels of a decoded sequence are valid classes followed by padding
+    for (auto label : sequences)
+        EXPECT_TRUE(label == -1.f || label == 0.f) << label;
+}
@@ -0,0 +1,241 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_graph_test_utils.hpp"
+#include "mkldnn_detection_output_reference.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNGraphTestUtils;
+
+namespace {
+
+struct DetectionOutputParams {
+    size_t batch;
+    size_t priors;
+    size_t classes;
+    int keepTopK;
+    int topK;
+    bool shareLocation;
+    bool decreaseLabelId;  // MXNet style NMS
+};
+
+std::ostream& operator<<(std::ostream& os, const DetectionOutputParams& p) {
+    return os << "N" << p.batch << "_P" << p.priors << "_C" << p.classes << "_keepTopK" << p.keepTopK
+              << "_topK" << p.topK << (p.shareLocation ? "_shared" : "_perClass")
+              << (p.decreaseLabelId ? "_mxnet" : "_caffe");
+}
+
+struct DetectionOutputInputs {
+    SizeVector locDims, confDims, priorsDims, outDims;
+    std::vector<float> loc, conf, priors;
+};
+
+DetectionOutputInputs makeInputs(const DetectionOutputParams& p) {
+    DetectionOutputInputs in;
+    const size_t locClasses = p.shareLocation ? 1 : p.classes;
+    in.locDims = {p.batch, p.priors * locClasses * 4};
+    in.confDims = {p.batch, p.priors * p.classes};
+    in.priorsDims = {1, 2, p.priors * 4};
+    in.outDims = {1, 1, p.batch * p.keepTopK, 7};
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+    std::uniform_real_distribution<float> offset(-1.f, 1.f);
+
+    // corner priors overlap each other, so NMS suppresses a part of them
+    for (size_t i = 0; i < p.priors; i++) {
+        float x = unit(gen) * 0.8f, y = unit(gen) * 0.8f;
+        float w = 0.05f + unit(gen) * 0.2f, h = 0.05f + unit(gen) * 0.2f;
+        in.priors.insert(in.priors.end(), {x, y, x + w, y + h});
+    }
+    for (size_t i = 0; i < p.priors; i++)
+        in.priors.insert(in.priors.end(), {0.1f, 0.1f, 0.2f, 0.2f});
+
+    in.loc.resize(in.locDims[0] * in.locDims[1]);
+    for (auto& v : in.loc)
+        v = offset(gen);
+    in.conf.resize(in.confDims[0] * in.confDims[1]);
+    for (auto& v : in.conf)
+        v = unit(gen);
+    return in;
+}
+
+std::map<std::string, std::string> layerParams(const DetectionOutputParams& p) {
+    return {{"num_classes", std::to_string(p.classes)},
+            {"background_label_id", "0"},
+            {"top_k", std::to_string(p.topK)},
+            {"keep_top_k", std::to_string(p.keepTopK)},
+            {"nms_threshold", "0.45"},
+            {"confidence_threshold", "0.01"},
+            {"share_location", p.shareLocation ? "1" : "0"},
+            {"decrease_label_id", p.decreaseLabelId ? "1" : "0"},
+            {"code_type", "caffe.PriorBoxParameter.CORNER"}};
+}
+
+std::string makeModel(const DetectionOutputParams& p, const DetectionOutputInputs& in) {
+    std::string data;
+    for (auto& param : layerParams(p))
+        data += " " + param.first + "=\"" + param.second + "\"";
+
+    return R"V0G0N(
+<net Name="DetectionOutput_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="0">
+            <output><port id="0">)V0G0N" + irDims(in.locDims) + R"V0G0N(</port></output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="1">
+            <output><port id="0">)V0G0N" + irDims(in.confDims) + R"V0G0N(</port></output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="2">
+            <output><port id="0">)V0G0N" + irDims(in.priorsDims) + R"V0G0N(</port></output>
+        </layer>
+        <layer name="detection_out" type="DetectionOutput" precision="FP32" id="3">
+            <data)V0G0N" + data + R"V0G0N(/>
+            <input>
+                <port id="0">)V0G0N" + irDims(in.locDims) + R"V0G0N(</port>
+                <port id="1">)V0G0N" + irDims(in.confDims) + R"V0G0N(</port>
+                <port id="2">)V0G0N" + irDims(in.priorsDims) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="3">)V0G0N" + irDims(in.outDims) + R"V0G0N(</port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+}
+
+// Runs the scalar implementation on the same layer description
+class ReferenceRunner {
+public:
+    ReferenceRunner(const DetectionOutputParams& p, const DetectionOutputInputs& in)
+            : layer({"detection_out", "DetectionOutput", Precision::FP32}) {
+        layer.params = layerParams(p);
+        for (auto& input : std::vector<std::pair<std::string, SizeVector>>{
+                {"loc", in.locDims}, {"conf", in.confDims}, {"priors", in.priorsDims}}) {
+            datas.push_back(std::make_shared<Data>(input.first,
+                    TensorDesc(Precision::FP32, input.second, TensorDesc::getLayoutByDims(input.second))));
+            layer.insData.push_back(datas.back());
+        }
+        layer.outData.push_back(std::make_shared<Data>("detection_out", TensorDesc(Precision::FP32, in.outDims, Layout::NCHW)));
+        impl.reset(new DetectionOutputReference::ReferenceDetectionOutput(&layer));
+
+        inputs = {makeBlob(in.loc, in.locDims), makeBlob(in.conf, in.confDims), makeBlob(in.priors, in.priorsDims)};
+        outputs = {makeBlob(std::vector<float>(p.batch * p.keepTopK * 7), in.outDims)};
+    }
+
+    std::vector<float> run() {
+        ResponseDesc resp;
+        EXPECT_EQ(OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+        auto data = outputs[0]->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + outputs[0]->size());
+    }
+
+private:
+    CNNLayer layer;
+    std::vector<DataPtr> datas;
+    std::unique_ptr<DetectionOutputReference::ReferenceDetectionOutput> impl;
+    std::vector<Blob::Ptr> inputs, outputs;
+};
+
+class MKLDNNGraphForDetectionOutput {
+public:
+    MKLDNNGraphForDetectionOutput(const DetectionOutputParams& p, const DetectionOutputInputs& in) {
+        Core core;
+        auto network = core.ReadNetwork(makeModel(p, in), Blob::CPtr());
+        graph.CreateGraph(network);
+        graph.PushInputData("loc", makeBlob(in.loc, in.locDims));
+        graph.PushInputData("conf", makeBlob(in.conf, in.confDims));
+        graph.PushInputData("priors", makeBlob(in.priors, in.priorsDims));
+    }
+
+    std::vector<float> run() {
+        graph.Infer();
+        BlobMap outputs;
+        graph.PullOutputData(outputs);
+        auto& blob = outputs["detection_out"];
+        auto data = blob->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + blob->size());
+    }
+
+private:
+    MKLDNNGraphForTest graph;
+};
+
+// Number of detections before the end of list marker
+size_t detectionsCount(const std::vector<float>& output) {
+    size_t count = 0;
+    while (count * 7 < output.size() && output[count * 7] != -1)
+        count++;
+    return count;
+}
+
+}  // namespace
+
+class MKLDNNDetectionOutputTest : public ::testing::TestWithParam<DetectionOutputParams> {};
+
+TEST_P(MKLDNNDetectionOutputTest, MatchesScalarImplementation) {
+    auto p = GetParam();
+    auto in = makeInputs(p);
+
+    auto expected = ReferenceRunner(p, in).run();
+    auto actual = MKLDNNGraphForDetectionOutput(p, in).run();
+
+    // keep_top_k is smaller than the number of kept detections, so the selection across classes is exercised
+    ASSERT_EQ(detectionsCount(expected), p.batch * p.keepTopK);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_FLOAT_EQ(actual[i], expected[i]) << "detection " << i / 7 << ", field " << i % 7;
+}
+
+INSTANTIATE_TEST_CASE_P(
+        Batches, MKLDNNDetectionOutputTest,
+        ::testing::Values(
+                DetectionOutputParams{1, 200, 21, 50, 100, true, false},
+                DetectionOutputParams{4, 200, 21, 50, 100, true, false},
+                DetectionOutputParams{3, 150, 37, 100, -1, true, false},
+                DetectionOutputParams{3, 100, 21, 40, 50, false, false},
+                DetectionOutputParams{4, 200, 21, 50, 100, true, true},
+                DetectionOutputParams{2, 150, 37, 100, -1, true, true}));
+
+// SSD300 on COCO sized layer: 8732 priors, 90 classes and the background
+TEST(MKLDNNDetectionOutputPerfTest, DISABLED_Performance) {
+    const int iterations = 20;
+
+    for (size_t batch : {1, 4, 8}) {
+        DetectionOutputParams p{batch, 8732, 91, 200, 400, true, false};
+        auto in = makeInputs(p);
+        ReferenceRunner reference(p, in);
+        MKLDNNGraphForDetectionOutput graph(p, in);
+
+        auto measure = [&](std::function<void()> run) {
+            run();
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+                run();
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+        };
+        double scalarMs = measure([&] { reference.run(); });
+        double parallelMs = measure([&] { graph.run(); });
+
+        std::cout << "batch " << batch << ": scalar " << scalarMs << " ms, parallel " << parallelMs
+                  << " ms, speedup " << scalarMs / parallelMs << "x" << std::endl;
+    }
+}
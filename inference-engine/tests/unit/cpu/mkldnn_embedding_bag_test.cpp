@@ -0,0 +1,353 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_graph_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNGraphTestUtils;
+
+namespace {
+
+const size_t tableRows = 10;
+const size_t rowSize = 37;                                  // vector blocks and a tail of a row
+const std::vector<float> lookup = {7, 2, 12, 0, 9};         // 12 is out of the table, gathered as zeros
+const std::vector<float> entries = {0, 1, 4, 2, 3, 3};      // indices of gathered rows
+const std::vector<float> segments = {0, 0, 0, 2, 2, 4};     // bags 1, 3 and 5 are empty
+
+std::string tableLayers(const Precision& precision, size_t gatheredRows) {
+    const std::string table = irDims({tableRows, rowSize});
+    const std::string gathered = irDims({gatheredRows, rowSize});
+    std::string layers = R"V0G0N(
+        <layer name="table" type="Input" precision="_PRECISION_" id="0">
+            <output>
+                <port id="0">)V0G0N" + table + R"V0G0N(</port>
+            </output>
+        </layer>
+        <layer name="lookup" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0"><dim>5</dim></port>
+            </output>
+        </layer>
+        <layer name="gather" type="Gather" precision="_PRECISION_" id="2">
+            <data axis="0"/>
+            <input>
+                <port id="0">)V0G0N" + table + R"V0G0N(</port>
+                <port id="1"><dim>5</dim></port>
+            </input>
+            <output>
+                <port id="2">)V0G0N" + gathered + R"V0G0N(</port>
+            </output>
+        </layer>
+        <layer name="convert" type="Convert" precision="FP32" id="3">
+            <data precision="FP32"/>
+            <input>
+                <port id="0">)V0G0N" + gathered + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + gathered + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    std::string name = precision.name();
+    for (auto pos = layers.find("_PRECISION_"); pos != std::string::npos; pos = layers.find("_PRECISION_"))
+        layers.replace(pos, 11, name);
+    return layers;
+}
+
+// Gathered rows of not FP32 tables are converted to FP32 before the reduction
+std::string tableEdges(const Precision& precision, size_t reduceId, size_t tablePort) {
+    std::string edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>)V0G0N";
+    if (precision == Precision::FP32) {
+        edges += R"V0G0N(
+        <edge from-layer="2" from-port="2" to-layer=")V0G0N" + std::to_string(reduceId) + R"V0G0N(" to-port=")V0G0N" +
+                 std::to_string(tablePort) + R"V0G0N("/>)V0G0N";
+    } else {
+        edges += R"V0G0N(
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer=")V0G0N" + std::to_string(reduceId) + R"V0G0N(" to-port=")V0G0N" +
+                 std::to_string(tablePort) + R"V0G0N("/>)V0G0N";
+    }
+    return edges;
+}
+
+std::string removeConvert(std::string model, const Precision& precision) {
+    if (precision != Precision::FP32)
+        return model;
+    auto begin = model.find("        <layer name=\"convert\"");
+    auto end = model.find("</layer>", begin) + 8;
+    return model.erase(begin, end - begin);
+}
+
+std::string getModel(const std::string& reduceType, const Precision& precision) {
+    const std::string gathered = irDims({lookup.size(), rowSize});
+    std::string model = R"V0G0N(
+<net Name="EmbeddingBag_net" version="2" precision="FP32" batch="1">
+    <layers>)V0G0N" + tableLayers(precision, lookup.size()) + R"V0G0N(
+        <layer name="entries" type="Input" precision="FP32" id="4">
+            <output>
+                <port id="0"><dim>6</dim></port>
+            </output>
+        </layer>
+        <layer name="segments" type="Input" precision="FP32" id="5">
+            <output>
+                <port id="0"><dim>6</dim></port>
+            </output>
+        </layer>
+        <layer name="reduce" type=")V0G0N" + reduceType + R"V0G0N(" precision="FP32" id="6">
+            <input>
+                <port id="0">)V0G0N" + gathered + R"V0G0N(</port>
+                <port id="1"><dim>6</dim></port>
+                <port id="2"><dim>6</dim></port>
+            </input>
+            <output>
+                <port id="3">)V0G0N" + irDims({segments.size(), rowSize}) + R"V0G0N(</port>
+            </output>
+        </layer>
+    </layers>
+    <edges>)V0G0N" + tableEdges(precision, 6, 0) + R"V0G0N(
+        <edge from-layer="4" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="5" from-port="0" to-layer="6" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+    return removeConvert(model, precision);
+}
+
+// Table values are small integers, so they are exact in all precisions
+std::vector<float> getTable(const Precision& precision) {
+    std::vector<float> table(tableRows * rowSize);
+    for (size_t i = 0; i < table.size(); i++)
+        table[i] = precision == Precision::U8 ? static_cast<float>(i % 7) : static_cast<float>(i % 7) - 3.f;
+    return table;
+}
+
+Blob::Ptr makeTableBlob(const std::vector<float>& table, const Precision& precision) {
+    const SizeVector dims = {tableRows, rowSize};
+    Blob::Ptr blob;
+    if (precision == Precision::FP32) {
+        blob = makeBlob(table, dims);
+    } else if (precision == Precision::BF16) {
+        blob = make_shared_blob<int16_t>({precision, dims, Layout::NC});
+        blob->allocate();
+        auto data = blob->buffer().as<uint16_t*>();
+        for (size_t i = 0; i < table.size(); i++) {
+            uint32_t bits;
+            std::memcpy(&bits, &table[i], sizeof(bits));
+            data[i] = static_cast<uint16_t>(bits >> 16);
+        }
+    } else if (precision == Precision::I8) {
+        blob = make_shared_blob<int8_t>({precision, dims, Layout::NC});
+        blob->allocate();
+        std::transform(table.begin(), table.end(), blob->buffer().as<int8_t*>(),
+                       [](float value) { return static_cast<int8_t>(value); });
+    } else {
+        blob = make_shared_blob<uint8_t>({precision, dims, Layout::NC});
+        blob->allocate();
+        std::transform(table.begin(), table.end(), blob->buffer().as<uint8_t*>(),
+                       [](float value) { return static_cast<uint8_t>(value); });
+    }
+    return blob;
+}
+
+std::vector<float> reference(const std::vector<float>& table, const std::string& reduceType) {
+    std::vector<float> result(segments.size() * rowSize, 0.f);
+    std::vector<size_t> counts(segments.size(), 0);
+    for (size_t e = 0; e < entries.size(); e++) {
+        size_t bag = static_cast<size_t>(segments[e]);
+        size_t row = static_cast<size_t>(lookup[static_cast<size_t>(entries[e])]);
+        counts[bag]++;
+        if (row >= tableRows)
+            continue;
+        for (size_t i = 0; i < rowSize; i++)
+            result[bag * rowSize + i] += table[row * rowSize + i];
+    }
+    for (size_t bag = 0; bag < counts.size(); bag++) {
+        if (counts[bag] == 0)
+            continue;
+        float divisor = reduceType == "SparseSegmentMean" ? static_cast<float>(counts[bag]) :
+                        reduceType == "SparseSegmentSqrtN" ? std::sqrt(static_cast<float>(counts[bag])) : 1.f;
+        for (size_t i = 0; i < rowSize; i++)
+            result[bag * rowSize + i] /= divisor;
+    }
+    return result;
+}
+
+// ExperimentalSparseWeightedSum: bag of every entry is the first column of indices
+const std::vector<int32_t> weightedIndices = {0, 0, 0, 1, 0, 2, 2, 0, 2, 1, 4, 0};
+const std::vector<int32_t> weightedEntries = {0, 1, 4, 2, 3, 3};
+const std::vector<float> weights = {0.5f, 2.f, 1.f, -1.f, 0.25f, 3.f};
+const int32_t defaultValue = 1;                             // lookup[1] is the row of empty bags
+
+std::string getWeightedModel(const Precision& precision) {
+    const std::string gathered = irDims({lookup.size(), rowSize});
+    const size_t bags = 6;
+    std::string model = R"V0G0N(
+<net Name="EmbeddingBag_net" version="2" precision="FP32" batch="1">
+    <layers>)V0G0N" + tableLayers(precision, lookup.size()) + R"V0G0N(
+        <layer name="indices" type="Input" precision="I32" id="4">
+            <output>
+                <port id="0"><dim>6</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="entries" type="Input" precision="I32" id="5">
+            <output>
+                <port id="0"><dim>6</dim></port>
+            </output>
+        </layer>
+        <layer name="dense_shape" type="Input" precision="I32" id="6">
+            <output>
+                <port id="0"><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="default_value" type="Input" precision="I32" id="7">
+            <output>
+                <port id="0"><dim>1</dim></port>
+            </output>
+        </layer>
+        <layer name="weights" type="Input" precision="FP32" id="8">
+            <output>
+                <port id="0"><dim>6</dim></port>
+            </output>
+        </layer>
+        <layer name="reduce" type="ExperimentalSparseWeightedSum" precision="FP32" id="9">
+            <input>
+                <port id="0"><dim>6</dim><dim>2</dim></port>
+                <port id="1"><dim>6</dim></port>
+                <port id="2"><dim>2</dim></port>
+                <port id="3">)V0G0N" + gathered + R"V0G0N(</port>
+                <port id="4"><dim>1</dim></port>
+                <port id="5"><dim>6</dim></port>
+            </input>
+            <output>
+                <port id="6">)V0G0N" + irDims({bags, rowSize}) + R"V0G0N(</port>
+            </output>
+        </layer>
+    </layers>
+    <edges>)V0G0N" + tableEdges(precision, 9, 3) + R"V0G0N(
+        <edge from-layer="4" from-port="0" to-layer="9" to-port="0"/>
+        <edge from-layer="5" from-port="0" to-layer="9" to-port="1"/>
+        <edge from-layer="6" from-port="0" to-layer="9" to-port="2"/>
+        <edge from-layer="7" from-port="0" to-layer="9" to-port="4"/>
+        <edge from-layer="8" from-port="0" to-layer="9" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+    return removeConvert(model, precision);
+}
+
+std::vector<float> weightedReference(const std::vector<float>& table, size_t bags) {
+    std::vector<float> result(bags * rowSize, 0.f);
+    std::vector<bool> empty(bags, true);
+    for (size_t e = 0; e < weightedEntries.size(); e++) {
+        size_t bag = static_cast<size_t>(weightedIndices[2 * e]);
+        size_t row = static_cast<size_t>(lookup[static_cast<size_t>(weightedEntries[e])]);
+        empty[bag] = false;
+        if (row >= tableRows)
+            continue;
+        for (size_t i = 0; i < rowSize; i++)
+            result[bag * rowSize + i] += weights[e] * table[row * rowSize + i];
+    }
+    size_t defaultRow = static_cast<size_t>(lookup[defaultValue]);
+    for (size_t bag = 0; bag < bags; bag++) {
+        if (empty[bag])
+            std::copy_n(table.begin() + defaultRow * rowSize, rowSize, result.begin() + bag * rowSize);
+    }
+    return result;
+}
+
+Blob::Ptr makeI32Blob(const std::vector<int32_t>& data, const SizeVector& dims) {
+    auto blob = make_shared_blob<int32_t>({Precision::I32, dims, TensorDesc::getLayoutByDims(dims)});
+    blob->allocate();
+    std::copy(data.begin(), data.end(), blob->buffer().as<int32_t*>());
+    return blob;
+}
+
+void checkFusion(MKLDNNGraphForTest& graph) {
+    size_t embeddingBags = 0;
+    for (auto& node : graph.GetNodes()) {
+        EXPECT_NE(node->getTypeStr(), "Gather");
+        EXPECT_NE(node->getTypeStr(), "Convert");
+        if (node->getType() == MKLDNNPlugin::EmbeddingBag)
+            embeddingBags++;
+    }
+    EXPECT_EQ(embeddingBags, 1);
+}
+
+void checkOutput(MKLDNNGraphForTest& graph, const std::vector<float>& expected) {
+    BlobMap outputs;
+    graph.PullOutputData(outputs);
+    ASSERT_EQ(outputs.size(), 1);
+    auto output = outputs.begin()->second->cbuffer().as<const float*>();
+    ASSERT_EQ(outputs.begin()->second->size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_NEAR(output[i], expected[i], 1e-5f) << "i: " << i;
+}
+
+}  // namespace
+
+class MKLDNNEmbeddingBagTest : public ::testing::TestWithParam<std::tuple<std::string, Precision>> {};
+
+TEST_P(MKLDNNEmbeddingBagTest, GatherIsFusedWithReduce) {
+    const std::string reduceType = std::get<0>(GetParam());
+    const Precision precision = std::get<1>(GetParam());
+
+    Core core;
+    auto network = core.ReadNetwork(getModel(reduceType, precision), Blob::CPtr());
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+    checkFusion(graph);
+
+    auto table = getTable(precision);
+    graph.PushInputData("table", makeTableBlob(table, precision));
+    graph.PushInputData("lookup", makeBlob(lookup, {lookup.size()}));
+    graph.PushInputData("entries", makeBlob(entries, {entries.size()}));
+    graph.PushInputData("segments", makeBlob(segments, {segments.size()}));
+    graph.Infer();
+
+    checkOutput(graph, reference(table, reduceType));
+}
+
+INSTANTIATE_TEST_CASE_P(Reduce, MKLDNNEmbeddingBagTest,
+                        ::testing::Combine(
+                            ::testing::Values("SparseSegmentSum", "SparseSegmentMean", "SparseSegmentSqrtN"),
+                            ::testing::Values(Precision::FP32, Precision::BF16, Precision::I8, Precision::U8)));
+
+class MKLDNNEmbeddingBagWeightedSumTest : public ::testing::TestWithParam<Precision> {};
+
+TEST_P(MKLDNNEmbeddingBagWeightedSumTest, GatherIsFusedWithReduce) {
+    const Precision precision = GetParam();
+    const size_t bags = 6;
+
+    Core core;
+    auto network = core.ReadNetwork(getWeightedModel(precision), Blob::CPtr());
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+    checkFusion(graph);
+
+    auto table = getTable(precision);
+    graph.PushInputData("table", makeTableBlob(table, precision));
+    graph.PushInputData("lookup", makeBlob(lookup, {lookup.size()}));
+    graph.PushInputData("indices", makeI32Blob(weightedIndices, {weightedEntries.size(), 2}));
+    graph.PushInputData("entries", makeI32Blob(weightedEntries, {weightedEntries.size()}));
+    graph.PushInputData("dense_shape", makeI32Blob({static_cast<int32_t>(bags), static_cast<int32_t>(rowSize)}, {2}));
+    graph.PushInputData("default_value", makeI32Blob({defaultValue}, {1}));
+    graph.PushInputData("weights", makeBlob(weights, {weights.size()}));
+    graph.Infer();
+
+    checkOutput(graph, weightedReference(table, bags));
+}
+
+INSTANTIATE_TEST_CASE_P(Reduce, MKLDNNEmbeddingBagWeightedSumTest,
+                        ::testing::Values(Precision::FP32, Precision::BF16, Precision::I8, Precision::U8));
@@ -0,0 +1,258 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_graph_test_utils.hpp"
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
+
+using namespace InferenceEngine;
+using namespace MKLDNNGraphTestUtils;
+
+namespace {
+
+class MKLDNNGraphWithPlan : public MKLDNNGraphForTest {
+public:
+    const std::vector<MKLDNNPlugin::MKLDNNNodePtr>& GetExecutableNodes() const {
+        return executableGraphNodes;
+    }
+
+    // Infer() as it was before the execution plan: all non-constant nodes are visited
+    void InferAllNodes() {
+        mkldnn::stream stream = mkldnn::stream(mkldnn::stream::kind::eager);
+        for (auto& node : graphNodes) {
+            if (!node->isConstant())
+                node->execute(stream);
+        }
+    }
+};
+
+const std::string model = R"V0G0N(
+<net Name="ExecutionPlan_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0"><dim>1</dim><dim>4</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="split" type="Split" precision="FP32" id="1">
+            <data axis="1"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>4</dim><dim>2</dim><dim>2</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>2</dim><dim>2</dim><dim>2</dim></port>
+                <port id="2"><dim>1</dim><dim>2</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="2">
+            <data axis="1"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>2</dim><dim>2</dim><dim>2</dim></port>
+                <port id="1"><dim>1</dim><dim>2</dim><dim>2</dim><dim>2</dim></port>
+            </input>
+            <output>
+                <port id="2"><dim>1</dim><dim>4</dim><dim>2</dim><dim>2</dim></port>
+            </output>
+        </layer>
+        <layer name="reshape" type="Reshape" precision="FP32" id="3">
+            <data dim="1,16" axis="0" num_axes="-1"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>4</dim><dim>2</dim><dim>2</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>16</dim></port>
+            </output>
+        </layer>
+        <layer name="const" type="Const" precision="FP32" id="4">
+            <output>
+                <port id="0"><dim>1</dim><dim>16</dim></port>
+            </output>
+            <blobs>
+                <custom offset="0" size="64"/>
+            </blobs>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="5">
+            <data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>16</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>16</dim></port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="6">
+            <data operation="sum"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>16</dim></port>
+                <port id="1"><dim>1</dim><dim>16</dim></port>
+            </input>
+            <output>
+                <port id="2"><dim>1</dim><dim>16</dim></port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+        <edge from-layer="4" from-port="0" to-layer="5" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer="6" to-port="0"/>
+        <edge from-layer="5" from-port="1" to-layer="6" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+// Chain of ReLU layers separated by pairs of Reshape layers
+std::string getSmallOpsModel(size_t blocks) {
+    std::string layers = R"V0G0N(
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0"><dim>1</dim><dim>16</dim></port>
+            </output>
+        </layer>)V0G0N";
+    std::string edges;
+    size_t id = 1;
+    for (size_t b = 0; b < blocks; b++) {
+        layers += R"V0G0N(
+        <layer name="relu)V0G0N" + std::to_string(b) + R"V0G0N(" type="ReLU" precision="FP32" id=")V0G0N" + std::to_string(id) + R"V0G0N(">
+            <input>
+                <port id="0"><dim>1</dim><dim>16</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>16</dim></port>
+            </output>
+        </layer>
+        <layer name="to4x4_)V0G0N" + std::to_string(b) + R"V0G0N(" type="Reshape" precision="FP32" id=")V0G0N" + std::to_string(id + 1) + R"V0G0N(">
+            <data dim="1,4,4" axis="0" num_axes="-1"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>16</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>4</dim><dim>4</dim></port>
+            </output>
+        </layer>
+        <layer name="to16_)V0G0N" + std::to_string(b) + R"V0G0N(" type="Reshape" precision="FP32" id=")V0G0N" + std::to_string(id + 2) + R"V0G0N(">
+            <data dim="1,16" axis="0" num_axes="-1"/>
+            <input>
+                <port id="0"><dim>1</dim><dim>4</dim><dim>4</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>16</dim></port>
+            </output>
+        </layer>)V0G0N";
+        edges += R"V0G0N(
+        <edge from-layer=")V0G0N" + std::to_string(id - 1) + R"V0G0N(" from-port=")V0G0N" + (id == 1 ? "0" : "1") +
+                 R"V0G0N(" to-layer=")V0G0N" + std::to_string(id) + R"V0G0N(" to-port="0"/>
+        <edge from-layer=")V0G0N" + std::to_string(id) + R"V0G0N(" from-port="1" to-layer=")V0G0N" + std::to_string(id + 1) +
+                 R"V0G0N(" to-port="0"/>
+        <edge from-layer=")V0G0N" + std::to_string(id + 1) + R"V0G0N(" from-port="1" to-layer=")V0G0N" + std::to_string(id + 2) +
+                 R"V0G0N(" to-port="0"/>)V0G0N";
+        id += 3;
+    }
+
+    return R"V0G0N(
+<net Name="SmallOps_net" version="2" precision="FP32" batch="1">
+    <layers>)V0G0N" + layers + R"V0G0N(
+    </layers>
+    <edges>)V0G0N" + edges + R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+}
+
+}  // namespace
+
+TEST(MKLDNNExecutionPlanTest, SkipsConstantAndNotExecutableNodes) {
+    std::vector<float> constant(16);
+    for (size_t i = 0; i < constant.size(); i++)
+        constant[i] = 0.5f * static_cast<float>(i);
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, {constant.size() * sizeof(float)}, Layout::C});
+    weights->allocate();
+    std::copy(constant.begin(), constant.end(), weights->buffer().as<float*>());
+
+    Core core;
+    auto network = core.ReadNetwork(model, weights);
+
+    MKLDNNGraphWithPlan graph;
+    graph.CreateGraph(network);
+
+    const auto& plan = graph.GetExecutableNodes();
+    size_t constantNodes = 0, reshapeNodes = 0, splitNodes = 0, concatNodes = 0;
+    for (auto& node : graph.GetNodes()) {
+        const bool planned = std::find(plan.begin(), plan.end(), node) != plan.end();
+        EXPECT_EQ(planned, !node->isConstant() && node->isExecutable()) << node->getName();
+
+        if (node->isConstant()) {
+            constantNodes++;
+            EXPECT_FALSE(planned) << node->getName();
+        } else if (node->getType() == MKLDNNPlugin::Reshape) {
+            reshapeNodes++;
+            EXPECT_FALSE(planned) << node->getName();
+        } else if (node->getType() == MKLDNNPlugin::Split) {
+            splitNodes++;
+            auto split = std::dynamic_pointer_cast<MKLDNNPlugin::MKLDNNSplitNode>(node);
+            ASSERT_NE(split, nullptr);
+            EXPECT_EQ(planned, !split->isOptimized()) << node->getName();
+        } else if (node->getType() == MKLDNNPlugin::Concatenation) {
+            concatNodes++;
+            auto concat = std::dynamic_pointer_cast<MKLDNNPlugin::MKLDNNConcatNode>(node);
+            ASSERT_NE(concat, nullptr);
+            EXPECT_EQ(planned, !concat->isOptimized()) << node->getName();
+        }
+    }
+    EXPECT_GT(constantNodes, 0);
+    EXPECT_EQ(reshapeNodes, 1);
+    EXPECT_EQ(splitNodes, 1);
+    EXPECT_EQ(concatNodes, 1);
+    EXPECT_LT(plan.size(), graph.GetNodes().size() - constantNodes);
+
+    // skipped nodes do not change the result
+    std::vector<float> data(16);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<float>(i) - 8.f;
+    graph.PushInputData("data", makeBlob(data, {1, 4, 2, 2}));
+    graph.Infer();
+
+    BlobMap outputs;
+    graph.PullOutputData(outputs);
+    ASSERT_EQ(outputs.size(), 1);
+    auto output = outputs.begin()->second->cbuffer().as<const float*>();
+    for (size_t i = 0; i < data.size(); i++)
+        EXPECT_FLOAT_EQ(output[i], data[i] + 2.f * constant[i]) << "i = " << i;
+}
+
+TEST(MKLDNNExecutionPlanTest, DISABLED_ManySmallOpsPerformance) {
+    const int iterations = 10000;
+
+    for (size_t blocks : {10, 100, 500}) {
+        Core core;
+        auto network = core.ReadNetwork(getSmallOpsModel(blocks), Blob::CPtr());
+
+        MKLDNNGraphWithPlan graph;
+        graph.CreateGraph(network);
+        graph.PushInputData("data", makeBlob(std::vector<float>(16, 1.f), {1, 16}));
+
+        auto measure = [&](bool withPlan) {
+            withPlan ? graph.Infer() : graph.InferAllNodes();
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+                withPlan ? graph.Infer() : graph.InferAllNodes();
+            return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+        };
+        double allNodesUs = measure(false);
+        double planUs = measure(true);
+
+        std::cout << blocks * 3 << " layers: " << graph.GetNodes().size() << " nodes, "
+                  << graph.GetExecutableNodes().size() << " in the plan; all nodes " << allNodesUs
+                  << " us, plan " << planUs << " us per inference" << std::endl;
+    }
+}
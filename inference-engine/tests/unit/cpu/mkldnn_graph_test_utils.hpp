@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <mkldnn_graph.h>
+#include <nodes/list.hpp>
+
+namespace MKLDNNGraphTestUtils {
+
+// Graph which is created directly from a network with the built-in CPU extensions
+class MKLDNNGraphForTest : public MKLDNNPlugin::MKLDNNGraph {
+public:
+    void CreateGraph(const InferenceEngine::CNNNetwork& network, MKLDNNPlugin::MKLDNNWeightsSharing::Ptr cache = nullptr) {
+        auto extensionManager = std::make_shared<MKLDNNPlugin::MKLDNNExtensionManager>();
+        extensionManager->AddExtension(std::make_shared<InferenceEngine::Extensions::Cpu::MKLDNNExtensions>());
+        MKLDNNGraph::CreateGraph(network, extensionManager, cache);
+    }
+
+    // Mirrors the work done by MKLDNNInferRequest when blobs of the graph are used as request blobs
+    void InferWithBlobs(InferenceEngine::BlobMap& inputs, InferenceEngine::BlobMap& outputs) {
+        for (auto& input : inputs)
+            PushInputData(input.first, input.second);
+        Infer();
+        PullOutputData(outputs);
+    }
+};
+
+inline InferenceEngine::Blob::Ptr makeBlob(const std::vector<float>& data, const InferenceEngine::SizeVector& dims) {
+    auto blob = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims)});
+    blob->allocate();
+    std::copy(data.begin(), data.end(), blob->buffer().as<float*>());
+    return blob;
+}
+
+// <dim> elements of an IR port
+inline std::string irDims(const InferenceEngine::SizeVector& shape) {
+    std::string result;
+    for (auto dim : shape)
+        result += "<dim>" + std::to_string(dim) + "</dim>";
+    return result;
+}
+
+}  // namespace MKLDNNGraphTestUtils
@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_jit_kernel_cache.hpp"
+
+using MKLDNNPlugin::JitKernelKey;
+using MKLDNNPlugin::MKLDNNJitKernelCache;
+
+namespace {
+
+struct TestKernel {
+    explicit TestKernel(int param) : param(param) {}
+    virtual ~TestKernel() = default;
+    int param;
+};
+
+struct TestKernelImpl : public TestKernel {
+    TestKernelImpl(int param, size_t size) : TestKernel(param), size(size) {}
+    size_t getSize() const { return size; }
+    size_t size;
+};
+
+JitKernelKey makeKey(int param) {
+    JitKernelKey key("test");
+    key << param;
+    return key;
+}
+
+}  // namespace
+
+TEST(JitKernelCacheTest, KeysDependOnAllParameters) {
+    JitKernelKey a("test"), b("test"), c("other");
+    a << 1 << std::vector<size_t>{2, 3};
+    b << 1 << std::vector<size_t>{2, 3};
+    c << 1 << std::vector<size_t>{2, 3};
+    EXPECT_EQ(a.str(), b.str());
+    EXPECT_NE(a.str(), c.str());
+
+    JitKernelKey d("test"), e("test");
+    d << std::vector<int>{1} << std::vector<int>{2, 3};
+    e << std::vector<int>{1, 2} << std::vector<int>{3};
+    EXPECT_NE(d.str(), e.str());
+}
+
+TEST(JitKernelCacheTest, IdenticalKernelsAreShared) {
+    MKLDNNJitKernelCache cache;
+    int created = 0;
+    auto create = [&](int param) {
+        return cache.findOrCreate<TestKernel>(makeKey(param), [&] {
+            created++;
+            return new TestKernelImpl(param, 100);
+        });
+    };
+
+    auto first = create(1);
+    auto second = create(1);
+    auto other = create(2);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(2, other->param);
+    EXPECT_EQ(2, created);
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+    EXPECT_EQ(2u, statistics.kernels);
+    EXPECT_EQ(200u, statistics.codeSize);
+}
+
+TEST(JitKernelCacheTest, LeastRecentlyUsedKernelsAreEvicted) {
+    MKLDNNJitKernelCache cache(250);
+    auto create = [&](int param) {
+        return cache.findOrCreate<TestKernel>(makeKey(param), [&] { return new TestKernelImpl(param, 100); });
+    };
+
+    auto first = create(1);
+    create(2);
+    create(1);
+    create(3);  // evicts the second kernel
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_EQ(2u, statistics.kernels);
+    EXPECT_EQ(200u, statistics.codeSize);
+
+    EXPECT_EQ(first, create(1));
+    EXPECT_EQ(3u, cache.getStatistics().misses);
+    create(2);
+    EXPECT_EQ(4u, cache.getStatistics().misses);
+
+    cache.setCapacity(0);
+    statistics = cache.getStatistics();
+    EXPECT_EQ(0u, statistics.kernels);
+    EXPECT_EQ(0u, statistics.codeSize);
+    // evicted kernels stay alive while they are used
+    EXPECT_EQ(1, first->param);
+}
+
+TEST(JitKernelCacheTest, ConcurrentRequestsGetTheSameKernel) {
+    MKLDNNJitKernelCache cache;
+    constexpr int threadsNum = 8;
+    std::vector<std::shared_ptr<TestKernel>> kernels(threadsNum);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadsNum; i++) {
+        threads.emplace_back([&, i] {
+            kernels[i] = cache.findOrCreate<TestKernel>(makeKey(1), [] { return new TestKernelImpl(1, 100); });
+        });
+    }
+    for (auto &&thread : threads)
+        thread.join();
+
+    for (auto &&kernel : kernels)
+        EXPECT_EQ(kernels.front(), kernel);
+    EXPECT_EQ(1u, cache.getStatistics().kernels);
+}
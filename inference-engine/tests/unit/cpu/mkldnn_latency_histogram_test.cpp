@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_latency_histogram.hpp"
+
+using MKLDNNPlugin::LatencyHistogram;
+using MKLDNNPlugin::NodesLatencyHistograms;
+
+TEST(LatencyHistogramTest, BucketsAreContinuousAndMonotonic) {
+    for (size_t i = 1; i < LatencyHistogram::kBucketsNum; i++) {
+        auto lower = LatencyHistogram::bucketUpperBound(i - 1) + 1;
+        auto upper = LatencyHistogram::bucketUpperBound(i);
+        ASSERT_LE(lower, upper);
+        EXPECT_EQ(LatencyHistogram::bucketIndex(lower), i);
+        EXPECT_EQ(LatencyHistogram::bucketIndex(upper), i);
+    }
+}
+
+TEST(LatencyHistogramTest, RelativeErrorIsBounded) {
+    for (uint64_t value = 1; value < (uint64_t(1) << 30); value = value * 3 + 1) {
+        auto upper = LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(value));
+        EXPECT_GE(upper, value);
+        EXPECT_LE(static_cast<double>(upper - value) / value, 1.0 / LatencyHistogram::kSubBucketCount);
+    }
+}
+
+TEST(LatencyHistogramTest, HugeValuesGoToLastBucket) {
+    EXPECT_EQ(LatencyHistogram::bucketIndex(~uint64_t(0)), LatencyHistogram::kBucketsNum - 1);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.percentile(50), 0);
+
+    for (uint64_t i = 1; i <= 1000; i++)
+        histogram.record(i * 1000);
+
+    EXPECT_EQ(histogram.count(), 1000);
+    EXPECT_EQ(histogram.min(), 1000);
+    EXPECT_EQ(histogram.max(), 1000000);
+    EXPECT_NEAR(histogram.percentile(50), 500000, 500000 / LatencyHistogram::kSubBucketCount);
+    EXPECT_NEAR(histogram.percentile(99), 990000, 990000 / LatencyHistogram::kSubBucketCount);
+    EXPECT_EQ(histogram.percentile(100), 1000000);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0);
+    EXPECT_TRUE(histogram.buckets().empty());
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecordsAreMerged) {
+    NodesLatencyHistograms histograms;
+    const int threadsNum = 4;
+    const int samplesNum = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&] {
+            auto histogram = histograms.get("conv");
+            for (int i = 0; i < samplesNum; i++)
+                histogram->record(i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    auto summary = histograms.percentiles();
+    ASSERT_EQ(summary.size(), 1);
+    EXPECT_EQ(summary["conv"]["count"], threadsNum * samplesNum);
+}
@@ -0,0 +1,174 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <mkldnn_plugin.h>
+#include <mkldnn_exec_network.h>
+
+using namespace InferenceEngine;
+
+namespace {
+
+// out = in + state, the state keeps the last output
+const std::string model = R"V0G0N(
+<net name="Accumulator" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="state_read" type="Memory" precision="FP32" id="1">
+            <data id="state" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="2">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="state_write" type="Memory" precision="FP32" id="3">
+            <data id="state" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+MKLDNNPlugin::MKLDNNExecNetwork& getExecNetwork(const IExecutableNetwork::Ptr& executableNetwork) {
+    auto base = dynamic_cast<ExecutableNetworkBase<ExecutableNetworkInternal>*>(executableNetwork.get());
+    if (base == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get executable network implementation";
+    return *std::dynamic_pointer_cast<MKLDNNPlugin::MKLDNNExecNetwork>(base->getImpl());
+}
+
+void infer(InferRequest& request, float value) {
+    auto input = request.GetBlob("in");
+    auto data = input->buffer().as<float*>();
+    std::fill(data, data + input->size(), value);
+    request.Infer();
+}
+
+float output(InferRequest& request) {
+    return request.GetBlob("sum")->cbuffer().as<const float*>()[0];
+}
+
+}  // namespace
+
+TEST(MKLDNNMemoryStateTest, GraphDoesNotReferStateOfDestroyedRequest) {
+    Core core;
+    auto network = core.ReadNetwork(model, Blob::CPtr());
+    network.begin();  // Call conversion from CNNNetwork NgraphImpl to CNNNetwork
+    network.addOutput("sum");
+
+    auto engine = std::make_shared<MKLDNNPlugin::Engine>();
+    IExecutableNetwork::Ptr executableNetworkPtr;
+    engine->LoadNetwork(executableNetworkPtr, network, {});
+    ExecutableNetwork executableNetwork(executableNetworkPtr);
+    auto& graph = *getExecNetwork(executableNetworkPtr)._graphs.begin()->get();
+
+    auto second = executableNetwork.CreateInferRequest();
+    const void* firstState = nullptr;
+    {
+        auto first = executableNetwork.CreateInferRequest();
+        infer(first, 5.f);
+        infer(first, 5.f);
+        EXPECT_EQ(10.f, output(first));
+
+        auto states = first.QueryState();
+        ASSERT_EQ(1, states.size());
+        firstState = states[0].GetLastState()->cbuffer().as<const void*>();
+    }
+
+    // state memory of a request is bound to the graph only while the request is inferred
+    for (auto& node : graph.GetMemoryInputNodes()) {
+        for (size_t i = 0; i < node.second->getChildEdges().size(); i++)
+            EXPECT_NE(firstState, node.second->getChildEdgeAt(i)->getMemory().GetData());
+    }
+
+    infer(second, 1.f);
+    EXPECT_EQ(1.f, output(second));
+    infer(second, 1.f);
+    EXPECT_EQ(2.f, output(second));
+
+    auto third = executableNetwork.CreateInferRequest();
+    infer(third, 3.f);
+    EXPECT_EQ(3.f, output(third));
+    infer(second, 1.f);
+    EXPECT_EQ(3.f, output(second));
+}
+
+TEST(MKLDNNMemoryStateTest, ResetDoesNotWipeSharedBlob) {
+    Core core;
+    auto network = core.ReadNetwork(model, Blob::CPtr());
+    network.begin();  // Call conversion from CNNNetwork NgraphImpl to CNNNetwork
+    network.addOutput("sum");
+
+    auto engine = std::make_shared<MKLDNNPlugin::Engine>();
+    IExecutableNetwork::Ptr executableNetworkPtr;
+    engine->LoadNetwork(executableNetworkPtr, network, {});
+    ExecutableNetwork executableNetwork(executableNetworkPtr);
+    auto request = executableNetwork.CreateInferRequest();
+    auto states = request.QueryState();
+    ASSERT_EQ(1, states.size());
+
+    // the blob has the layout of the state, so it is used without copying
+    auto userState = make_shared_blob<float>({Precision::FP32, {1, 16}, Layout::NC});
+    userState->allocate();
+    std::fill_n(userState->buffer().as<float*>(), userState->size(), 2.f);
+    states[0].SetState(userState);
+    infer(request, 1.f);
+    EXPECT_EQ(3.f, output(request));
+    ASSERT_EQ(userState->cbuffer().as<const void*>(), states[0].GetLastState()->cbuffer().as<const void*>());
+
+    states[0].Reset();
+    auto userData = userState->cbuffer().as<const float*>();
+    EXPECT_TRUE(std::all_of(userData, userData + userState->size(), [](float value) { return value == 3.f; }));
+    auto lastState = states[0].GetLastState();
+    EXPECT_NE(userState->cbuffer().as<const void*>(), lastState->cbuffer().as<const void*>());
+    auto stateData = lastState->cbuffer().as<const float*>();
+    EXPECT_TRUE(std::all_of(stateData, stateData + lastState->size(), [](float value) { return value == 0.f; }));
+
+    infer(request, 1.f);
+    EXPECT_EQ(1.f, output(request));
+    EXPECT_TRUE(std::all_of(userData, userData + userState->size(), [](float value) { return value == 3.f; }));
+}
@@ -0,0 +1,398 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_graph_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNGraphTestUtils;
+
+namespace {
+
+const SizeVector srcDims = {2, 3, 4, 5};
+
+std::string getModel(const std::string& reduceType, const std::vector<int32_t>& axes) {
+    std::string model = R"V0G0N(
+<net Name="Reduce_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0"><dim>2</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+            </output>
+        </layer>
+        <layer name="axes" type="Const" precision="I32" id="1">
+            <output>
+                <port id="0"><dim>_AXES_NUM_</dim></port>
+            </output>
+            <blobs>
+                <custom offset="0" size="_AXES_SIZE_"/>
+            </blobs>
+        </layer>
+        <layer name="reduce" type="_REDUCE_" precision="FP32" id="2">
+            <data keep_dims="1"/>
+            <input>
+                <port id="0"><dim>2</dim><dim>3</dim><dim>4</dim><dim>5</dim></port>
+                <port id="1"><dim>_AXES_NUM_</dim></port>
+            </input>
+            <output>
+                <port id="2">_OUT_</port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="3">
+            <input>
+                <port id="0">_OUT_</port>
+            </input>
+            <output>
+                <port id="1">_OUT_</port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string outDims;
+    for (size_t i = 0; i < srcDims.size(); i++) {
+        bool reduced = std::find(axes.begin(), axes.end(), static_cast<int32_t>(i)) != axes.end();
+        outDims += "<dim>" + std::to_string(reduced ? 1 : srcDims[i]) + "</dim>";
+    }
+
+    auto replace = [&model](const std::string& pattern, const std::string& value) {
+        for (size_t pos = model.find(pattern); pos != std::string::npos; pos = model.find(pattern))
+            model.replace(pos, pattern.size(), value);
+    };
+    replace("_REDUCE_", reduceType);
+    replace("_AXES_NUM_", std::to_string(axes.size()));
+    replace("_AXES_SIZE_", std::to_string(axes.size() * sizeof(int32_t)));
+    replace("_OUT_", outDims);
+    return model;
+}
+
+// keep_dims reference over the planar source
+std::vector<float> reference(const std::vector<float>& src, const SizeVector& srcDims, const std::string& reduceType,
+                             const std::vector<int32_t>& axes) {
+    SizeVector dstDims = srcDims;
+    for (auto axis : axes)
+        dstDims[axis] = 1;
+    size_t dstSize = 1;
+    for (auto dim : dstDims)
+        dstSize *= dim;
+
+    float init = 0.f;
+    if (reduceType == "ReduceProd" || reduceType == "ReduceAnd")
+        init = 1.f;
+    else if (reduceType == "ReduceMax")
+        init = -std::numeric_limits<float>::infinity();
+    else if (reduceType == "ReduceMin")
+        init = std::numeric_limits<float>::infinity();
+    std::vector<float> dst(dstSize, init);
+
+    size_t count = src.size() / dstSize;
+    for (size_t i = 0; i < src.size(); i++) {
+        size_t rest = i, dstIdx = 0, dstStride = 1;
+        for (size_t d = srcDims.size(); d-- > 0;) {
+            size_t idx = rest % srcDims[d];
+            rest /= srcDims[d];
+            dstIdx += (dstDims[d] == 1 ? 0 : idx) * dstStride;
+            dstStride *= dstDims[d];
+        }
+
+        float& acc = dst[dstIdx];
+        float value = src[i];
+        if (reduceType == "ReduceSum" || reduceType == "ReduceMean") acc += value;
+        else if (reduceType == "ReduceL1") acc += std::abs(value);
+        else if (reduceType == "ReduceL2" || reduceType == "ReduceSumSquare") acc += value * value;
+        else if (reduceType == "ReduceLogSumExp") acc += std::exp(value);
+        else if (reduceType == "ReduceMax") acc = std::max(acc, value);
+        else if (reduceType == "ReduceMin") acc = std::min(acc, value);
+        else if (reduceType == "ReduceProd") acc *= value;
+        else if (reduceType == "ReduceAnd") acc = acc && value != 0.f;
+        else if (reduceType == "ReduceOr") acc = acc || value != 0.f;
+    }
+
+    for (auto& value : dst) {
+        if (reduceType == "ReduceMean") value /= count;
+        else if (reduceType == "ReduceL2") value = std::sqrt(value);
+        else if (reduceType == "ReduceLogSumExp") value = std::log(value);
+    }
+    return dst;
+}
+
+// The reduce gets a blocked source from a convolution with a channel count that is not a multiple of
+// the block size, so the last channel block is padded. Per-tensor FakeQuantize maps zero to a non-zero
+// value, so padded lanes stay zero only if the node clears them after post ops.
+const size_t blkC = 5;
+const SizeVector blkSrcDims = {2, 3, 4, 5};
+const size_t convWeights = blkC * 3, convBiases = blkC;
+const float fqLow = -1.f, fqHigh = 1.f, fqOutLow = 0.5f, fqOutHigh = 2.5f;
+const size_t fqLevels = 256;
+
+std::string getBlockedModel(const std::string& reduceType, const std::vector<int32_t>& axes) {
+    const SizeVector convDims = {blkSrcDims[0], blkC, blkSrcDims[2], blkSrcDims[3]};
+    SizeVector outDims = convDims;
+    for (auto axis : axes)
+        outDims[axis] = 1;
+
+    const size_t axesOffset = (convWeights + convBiases) * sizeof(float);
+    const size_t fqOffset = axesOffset + axes.size() * sizeof(int32_t);
+    auto fqConst = [&](const std::string& name, size_t id, size_t index) {
+        return R"V0G0N(
+        <layer name=")V0G0N" + name + R"V0G0N(" type="Const" precision="FP32" id=")V0G0N" + std::to_string(id) + R"V0G0N(">
+            <output>
+                <port id="0"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+            </output>
+            <blobs>
+                <custom offset=")V0G0N" + std::to_string(fqOffset + index * sizeof(float)) + R"V0G0N(" size="4"/>
+            </blobs>
+        </layer>)V0G0N";
+    };
+
+    std::string model = R"V0G0N(
+<net Name="ReduceBlocked_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">)V0G0N" + irDims(blkSrcDims) + R"V0G0N(</port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output=")V0G0N" +
+            std::to_string(blkC) + R"V0G0N(" group="1"/>
+            <input>
+                <port id="0">)V0G0N" + irDims(blkSrcDims) + R"V0G0N(</port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + irDims(convDims) + R"V0G0N(</port>
+            </output>
+            <blobs>
+                <weights offset="0" size=")V0G0N" + std::to_string(convWeights * sizeof(float)) + R"V0G0N("/>
+                <biases offset=")V0G0N" + std::to_string(convWeights * sizeof(float)) + R"V0G0N(" size=")V0G0N" +
+            std::to_string(convBiases * sizeof(float)) + R"V0G0N("/>
+            </blobs>
+        </layer>
+        <layer name="axes" type="Const" precision="I32" id="2">
+            <output>
+                <port id="0"><dim>)V0G0N" + std::to_string(axes.size()) + R"V0G0N(</dim></port>
+            </output>
+            <blobs>
+                <custom offset=")V0G0N" + std::to_string(axesOffset) + R"V0G0N(" size=")V0G0N" +
+            std::to_string(axes.size() * sizeof(int32_t)) + R"V0G0N("/>
+            </blobs>
+        </layer>
+        <layer name="reduce" type=")V0G0N" + reduceType + R"V0G0N(" precision="FP32" id="3">
+            <data keep_dims="1"/>
+            <input>
+                <port id="0">)V0G0N" + irDims(convDims) + R"V0G0N(</port>
+                <port id="1"><dim>)V0G0N" + std::to_string(axes.size()) + R"V0G0N(</dim></port>
+            </input>
+            <output>
+                <port id="2">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>
+        <layer name="fq" type="FakeQuantize" precision="FP32" id="4">
+            <data levels=")V0G0N" + std::to_string(fqLevels) + R"V0G0N("/>
+            <input>
+                <port id="0">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+                <port id="1"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+                <port id="2"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+                <port id="3"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+                <port id="4"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+            </input>
+            <output>
+                <port id="5">)V0G0N" + irDims(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>)V0G0N";
+    model += fqConst("input_low", 5, 0);
+    model += fqConst("input_high", 6, 1);
+    model += fqConst("output_low", 7, 2);
+    model += fqConst("output_high", 8, 3);
+    model += R"V0G0N(
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="3" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="5" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="6" from-port="0" to-layer="4" to-port="2"/>
+        <edge from-layer="7" from-port="0" to-layer="4" to-port="3"/>
+        <edge from-layer="8" from-port="0" to-layer="4" to-port="4"/>
+    </edges>
+</net>
+)V0G0N";
+    return model;
+}
+
+float convWeight(size_t oc, size_t ic) {
+    return static_cast<float>(static_cast<int>((oc + 2 * ic) % 5) - 2) * 0.3f;
+}
+
+float convBias(size_t oc) {
+    return 0.1f * static_cast<float>(oc);
+}
+
+float fakeQuantize(float x) {
+    if (x <= fqLow)
+        return fqOutLow;
+    if (x > fqHigh)
+        return fqOutHigh;
+    const float levels = static_cast<float>(fqLevels - 1);
+    return std::round((x - fqLow) / (fqHigh - fqLow) * levels) / levels * (fqOutHigh - fqOutLow) + fqOutLow;
+}
+
+}  // namespace
+
+class MKLDNNReduceTest : public ::testing::TestWithParam<std::tuple<std::string, std::vector<int32_t>>> {};
+
+TEST_P(MKLDNNReduceTest, MatchesReferenceWithFusedActivation) {
+    const std::string reduceType = std::get<0>(GetParam());
+    const std::vector<int32_t> axes = std::get<1>(GetParam());
+
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, {axes.size() * sizeof(int32_t)}, Layout::C});
+    weights->allocate();
+    std::copy(axes.begin(), axes.end(), weights->buffer().as<int32_t*>());
+
+    Core core;
+    auto network = core.ReadNetwork(getModel(reduceType, axes), weights);
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+
+    size_t reduceNodes = 0;
+    for (auto& node : graph.GetNodes()) {
+        EXPECT_NE(node->getType(), MKLDNNPlugin::Activation);
+        if (node->getType() == MKLDNNPlugin::Reduce)
+            reduceNodes++;
+    }
+    EXPECT_EQ(reduceNodes, 1);
+
+    std::vector<float> src(2 * 3 * 4 * 5);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (static_cast<float>(i % 9) - 3.f) * 0.25f;
+
+    auto input = make_shared_blob<float>({Precision::FP32, srcDims, Layout::NCHW});
+    input->allocate();
+    std::copy(src.begin(), src.end(), input->buffer().as<float*>());
+    graph.PushInputData("input", input);
+    graph.Infer();
+
+    BlobMap outputs;
+    graph.PullOutputData(outputs);
+    ASSERT_EQ(outputs.size(), 1);
+    auto output = outputs.begin()->second->cbuffer().as<const float*>();
+
+    auto expected = reference(src, srcDims, reduceType, axes);
+    for (auto& value : expected)
+        value = std::max(value, 0.f);
+    ASSERT_EQ(outputs.begin()->second->size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_NEAR(output[i], expected[i], 1e-4f * std::max(1.f, std::abs(expected[i]))) << "i: " << i;
+}
+
+INSTANTIATE_TEST_CASE_P(Reduce, MKLDNNReduceTest,
+                        ::testing::Combine(
+                            ::testing::Values("ReduceSum", "ReduceMean", "ReduceMax", "ReduceMin", "ReduceProd", "ReduceL1",
+                                              "ReduceL2", "ReduceSumSquare", "ReduceLogSumExp", "ReduceAnd", "ReduceOr"),
+                            ::testing::Values(std::vector<int32_t>{1}, std::vector<int32_t>{3}, std::vector<int32_t>{2, 3},
+                                              std::vector<int32_t>{0, 2}, std::vector<int32_t>{0, 1, 2, 3})));
+
+class MKLDNNReduceBlockedTest : public ::testing::TestWithParam<std::tuple<std::string, std::vector<int32_t>>> {};
+
+TEST_P(MKLDNNReduceBlockedTest, ZeroesChannelPaddingAfterFusedFakeQuantize) {
+    const std::string reduceType = std::get<0>(GetParam());
+    const std::vector<int32_t> axes = std::get<1>(GetParam());
+
+    std::vector<float> constData;
+    for (size_t oc = 0; oc < blkC; oc++)
+        for (size_t ic = 0; ic < blkSrcDims[1]; ic++)
+            constData.push_back(convWeight(oc, ic));
+    for (size_t oc = 0; oc < blkC; oc++)
+        constData.push_back(convBias(oc));
+    const size_t axesOffset = constData.size() * sizeof(float);
+    const std::vector<float> fqData = {fqLow, fqHigh, fqOutLow, fqOutHigh};
+
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, {axesOffset + axes.size() * sizeof(int32_t) +
+                                                              fqData.size() * sizeof(float)}, Layout::C});
+    weights->allocate();
+    auto data = weights->buffer().as<uint8_t*>();
+    std::copy(constData.begin(), constData.end(), reinterpret_cast<float*>(data));
+    std::copy(axes.begin(), axes.end(), reinterpret_cast<int32_t*>(data + axesOffset));
+    std::copy(fqData.begin(), fqData.end(), reinterpret_cast<float*>(data + axesOffset + axes.size() * sizeof(int32_t)));
+
+    Core core;
+    auto network = core.ReadNetwork(getBlockedModel(reduceType, axes), weights);
+
+    MKLDNNGraphForTest graph;
+    graph.CreateGraph(network);
+
+    MKLDNNPlugin::MKLDNNNodePtr reduceNode;
+    for (auto& node : graph.GetNodes()) {
+        EXPECT_NE(node->getType(), MKLDNNPlugin::Quantize);
+        if (node->getType() == MKLDNNPlugin::Reduce)
+            reduceNode = node;
+    }
+    ASSERT_NE(reduceNode, nullptr);
+    ASSERT_EQ(reduceNode->getFusedWith().size(), 1);
+
+    std::vector<float> src(blkSrcDims[0] * blkSrcDims[1] * blkSrcDims[2] * blkSrcDims[3]);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (static_cast<float>(i % 9) - 3.f) * 0.25f;
+    graph.PushInputData("input", makeBlob(src, blkSrcDims));
+    graph.Infer();
+
+    BlobMap outputs;
+    graph.PullOutputData(outputs);
+    ASSERT_EQ(outputs.size(), 1);
+    auto output = outputs.begin()->second->cbuffer().as<const float*>();
+
+    const size_t N = blkSrcDims[0], IC = blkSrcDims[1], spatial = blkSrcDims[2] * blkSrcDims[3];
+    std::vector<float> conv(N * blkC * spatial);
+    for (size_t n = 0; n < N; n++)
+        for (size_t oc = 0; oc < blkC; oc++)
+            for (size_t s = 0; s < spatial; s++) {
+                float value = convBias(oc);
+                for (size_t ic = 0; ic < IC; ic++)
+                    value += convWeight(oc, ic) * src[(n * IC + ic) * spatial + s];
+                conv[(n * blkC + oc) * spatial + s] = value;
+            }
+
+    auto expected = reference(conv, {N, blkC, blkSrcDims[2], blkSrcDims[3]}, reduceType, axes);
+    ASSERT_EQ(outputs.begin()->second->size(), expected.size());
+    const float step = (fqOutHigh - fqOutLow) / (fqLevels - 1);
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_NEAR(output[i], fakeQuantize(expected[i]), step + 1e-5f) << "i: " << i;
+
+    const auto dstDesc = reduceNode->getChildEdgeAt(0)->getDesc();
+    ASSERT_EQ(dstDesc.getLayout(), Layout::BLOCKED);
+
+    const auto& blockDims = dstDesc.getBlockingDesc().getBlockDims();
+    const size_t blk = blockDims.back();
+    ASSERT_NE(blkC % blk, 0);
+    auto dst = static_cast<const float*>(reduceNode->getChildEdgeAt(0)->getMemory().GetData());
+    size_t dstSize = 1;
+    for (auto dim : blockDims)
+        dstSize *= dim;
+    for (size_t i = 0; i < dstSize; i++) {
+        const size_t c = (i / (dstSize / (blockDims[0] * blockDims[1])) % blockDims[1]) * blk + i % blk;
+        if (c >= blkC)
+            EXPECT_EQ(dst[i], 0.f) << "i: " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(Reduce, MKLDNNReduceBlockedTest,
+                        ::testing::Combine(
+                            ::testing::Values("ReduceSum", "ReduceMean", "ReduceMax", "ReduceProd", "ReduceL2"),
+                            ::testing::Values(std::vector<int32_t>{3}, std::vector<int32_t>{2, 3},
+                                              std::vector<int32_t>{0, 2})));
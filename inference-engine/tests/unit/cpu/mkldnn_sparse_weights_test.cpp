@@ -0,0 +1,137 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/block_sparse_weights.h"
+#include "nodes/sparse_fc_imp.hpp"
+
+using MKLDNNPlugin::BlockSparseWeights;
+using InferenceEngine::Extensions::Cpu::XARCH::sparse_fc;
+
+namespace {
+
+std::vector<float> generateWeights(size_t outputs, size_t inputs, float density, unsigned seed = 1) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> values(-1.f, 1.f);
+    std::bernoulli_distribution nonZero(density);
+    std::vector<float> weights(outputs * inputs);
+    for (auto &w : weights)
+        w = nonZero(gen) ? values(gen) : 0.f;
+    return weights;
+}
+
+std::vector<uint8_t> packWeights(const std::vector<float> &weights, size_t outputs, size_t inputs) {
+    std::vector<uint8_t> packed(BlockSparseWeights::pack(weights.data(), outputs, inputs, nullptr));
+    BlockSparseWeights::pack(weights.data(), outputs, inputs, packed.data());
+    return packed;
+}
+
+void denseFc(const float *src, float *dst, const float *bias, const float *weights,
+             size_t batch, size_t outputs, size_t inputs) {
+    for (size_t b = 0; b < batch; b++) {
+        for (size_t o = 0; o < outputs; o++) {
+            float sum = bias ? bias[o] : 0.f;
+            for (size_t i = 0; i < inputs; i++)
+                sum += src[b * inputs + i] * weights[o * inputs + i];
+            dst[b * outputs + o] = sum;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BlockSparseWeightsTest, PackKeepsAllNonZeroWeights) {
+    const size_t outputs = 37, inputs = 29;
+    const auto weights = generateWeights(outputs, inputs, 0.1f);
+    const auto packed = packWeights(weights, outputs, inputs);
+    const BlockSparseWeights layout(packed.data(), outputs);
+
+    ASSERT_EQ(3u, layout.blocks);
+    const auto valuesOffset = reinterpret_cast<const uint8_t *>(layout.values) - packed.data();
+    EXPECT_EQ(0, valuesOffset % BlockSparseWeights::kAlignment);
+
+    std::vector<float> unpacked(outputs * inputs, 0.f);
+    for (size_t block = 0; block < layout.blocks; block++) {
+        for (int32_t c = layout.offsets[block]; c < layout.offsets[block + 1]; c++) {
+            for (size_t r = 0; r < BlockSparseWeights::kBlockSize; r++) {
+                const size_t o = block * BlockSparseWeights::kBlockSize + r;
+                const float value = layout.values[c * BlockSparseWeights::kBlockSize + r];
+                if (o < outputs)
+                    unpacked[o * inputs + layout.indices[c]] = value;
+                else
+                    EXPECT_EQ(0.f, value);
+            }
+        }
+    }
+    EXPECT_EQ(weights, unpacked);
+}
+
+TEST(BlockSparseWeightsTest, DensityIsShareOfNonZeros) {
+    const std::vector<float> weights = {0.f, 1.f, 0.f, -2.f, 0.f, 0.f, 0.f, 3.f};
+    EXPECT_FLOAT_EQ(0.375f, BlockSparseWeights::density(weights.data(), weights.size()));
+    EXPECT_FLOAT_EQ(0.f, BlockSparseWeights::density(nullptr, 0));
+}
+
+// batch, outputs, inputs, density, with bias
+using SparseFcParams = std::tuple<size_t, size_t, size_t, float, bool>;
+
+class SparseFcTest : public ::testing::TestWithParam<SparseFcParams> {};
+
+TEST_P(SparseFcTest, MatchesDenseProduct) {
+    size_t batch, outputs, inputs;
+    float density;
+    bool withBias;
+    std::tie(batch, outputs, inputs, density, withBias) = GetParam();
+
+    const auto weights = generateWeights(outputs, inputs, density);
+    const auto packed = packWeights(weights, outputs, inputs);
+    const auto src = generateWeights(batch, inputs, 1.f, 2);
+    const auto bias = generateWeights(1, outputs, 1.f, 3);
+
+    std::vector<float> expected(batch * outputs), actual(batch * outputs, -1.f);
+    denseFc(src.data(), expected.data(), withBias ? bias.data() : nullptr, weights.data(), batch, outputs, inputs);
+    sparse_fc(src.data(), actual.data(), withBias ? bias.data() : nullptr, packed.data(), batch, outputs, inputs);
+
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_NEAR(expected[i], actual[i], 1e-4f) << "at " << i;
+}
+
+INSTANTIATE_TEST_CASE_P(Shapes, SparseFcTest, ::testing::Values(
+        SparseFcParams{1, 16, 64, 0.1f, false},
+        SparseFcParams{4, 32, 100, 0.05f, true},
+        SparseFcParams{7, 37, 129, 0.2f, true},
+        SparseFcParams{3, 5, 11, 0.5f, false},
+        SparseFcParams{9, 64, 256, 0.f, true},
+        SparseFcParams{2, 48, 70, 1.f, false}));
+
+// Reports the size of packed weights next to the size of dense ones and the time of the packed kernel for several
+// densities, run with --gtest_also_run_disabled_tests. CPUSparseWeightsTests.DISABLED_Performance compares the time
+// with the dense mkldnn inner product
+TEST(BlockSparseWeightsTest, DISABLED_PackedSize) {
+    const size_t batch = 64, outputs = 1024, inputs = 1024, iterations = 100;
+    const auto src = generateWeights(batch, inputs, 1.f, 2);
+    std::vector<float> dst(batch * outputs);
+
+    for (float density : {0.01f, 0.05f, 0.1f, 0.2f, 0.3f, 0.5f}) {
+        const auto weights = generateWeights(outputs, inputs, density);
+        const auto packed = packWeights(weights, outputs, inputs);
+
+        sparse_fc(src.data(), dst.data(), nullptr, packed.data(), batch, outputs, inputs);
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            sparse_fc(src.data(), dst.data(), nullptr, packed.data(), batch, outputs, inputs);
+        const double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+        std::cout << "density " << density << ": packed " << packed.size() << " bytes of dense "
+                  << weights.size() * sizeof(float) << " bytes (" << 100.0 * packed.size() / (weights.size() * sizeof(float))
+                  << "%), packed kernel " << time << " us" << std::endl;
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <mkldnn_plugin.h>
+#include <mkldnn_streams_autotuner.h>
+
+using namespace InferenceEngine;
+using MKLDNNPlugin::MKLDNNStreamsAutotuner;
+
+namespace {
+
+std::string getModel(const std::string& activation) {
+    return R"V0G0N(
+<net Name="Autotuner_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port>
+            </output>
+        </layer>
+        <layer name="activation" type=")V0G0N" + activation + R"V0G0N(" precision="FP32" id="1">
+            <input>
+                <port id="0"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port>
+            </input>
+            <output>
+                <port id="1"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+}
+
+uint64_t hashModel(const std::string& model) {
+    Core core;
+    auto network = core.ReadNetwork(model, Blob::CPtr());
+    return MKLDNNStreamsAutotuner::hashNetwork(network);
+}
+
+}  // namespace
+
+TEST(MKLDNNStreamsAutotunerTest, CandidatesAreDivisorsAndPowersOfTwo) {
+    EXPECT_EQ(MKLDNNStreamsAutotuner::candidateStreams(12), (std::vector<int>{1, 2, 3, 4, 6, 8, 12}));
+    EXPECT_EQ(MKLDNNStreamsAutotuner::candidateStreams(7), (std::vector<int>{1, 2, 4, 7}));
+    EXPECT_EQ(MKLDNNStreamsAutotuner::candidateStreams(1), (std::vector<int>{1}));
+    EXPECT_EQ(MKLDNNStreamsAutotuner::candidateStreams(0), (std::vector<int>{1}));
+}
+
+TEST(MKLDNNStreamsAutotunerTest, SelectsHighestThroughputWithinLatencyLimit) {
+    std::map<int, MKLDNNStreamsAutotuner::Measurement> measurements;
+    measurements[1].throughput = 100.f;
+    measurements[1].latency = 10.f;
+    measurements[2].throughput = 180.f;
+    measurements[2].latency = 11.f;
+    measurements[4].throughput = 250.f;
+    measurements[4].latency = 16.f;
+
+    EXPECT_EQ(MKLDNNStreamsAutotuner::selectStreams(measurements, 0.f), 4);
+    EXPECT_EQ(MKLDNNStreamsAutotuner::selectStreams(measurements, 12.f), 2);
+    // nothing fits the limit, so the lowest latency wins
+    EXPECT_EQ(MKLDNNStreamsAutotuner::selectStreams(measurements, 5.f), 1);
+    EXPECT_THROW(MKLDNNStreamsAutotuner::selectStreams({}, 0.f), details::InferenceEngineException);
+}
+
+TEST(MKLDNNStreamsAutotunerTest, NetworkHashDependsOnLayers) {
+    EXPECT_EQ(hashModel(getModel("ReLU")), hashModel(getModel("ReLU")));
+    EXPECT_NE(hashModel(getModel("ReLU")), hashModel(getModel("Sigmoid")));
+}
+
+TEST(MKLDNNStreamsAutotunerTest, LoadNetworkReusesTunedStreamsAndThreads) {
+    using Results = std::map<int, std::pair<float, float>>;
+    MKLDNNStreamsAutotuner::clearCache();
+
+    Core core;
+    auto network = core.ReadNetwork(getModel("ReLU"), Blob::CPtr());
+    network.begin();  // Call conversion from CNNNetwork NgraphImpl to CNNNetwork
+
+    const std::map<std::string, std::string> config = {{PluginConfigParams::KEY_CPU_THROUGHPUT_AUTOTUNE, PluginConfigParams::YES}};
+    auto engine = std::make_shared<MKLDNNPlugin::Engine>();
+    IExecutableNetwork::Ptr firstPtr, secondPtr;
+    engine->LoadNetwork(firstPtr, network, config);
+    engine->LoadNetwork(secondPtr, network, config);
+    ExecutableNetwork first(firstPtr), second(secondPtr);
+
+    auto results = first.GetMetric(EXEC_NETWORK_METRIC_KEY(STREAMS_AUTOTUNE_RESULTS)).as<Results>();
+    ASSERT_FALSE(results.empty());
+    const int streams = std::stoi(first.GetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS).as<std::string>());
+    EXPECT_EQ(results.count(streams), 1);
+    // the network runs with the threads number the streams were measured with
+    const int threads = std::stoi(first.GetConfig(PluginConfigParams::KEY_CPU_THREADS_NUM).as<std::string>());
+    EXPECT_GT(threads, 0);
+    EXPECT_EQ(MKLDNNStreamsAutotuner::candidateStreams(threads).size(), results.size());
+
+    // measurements of the second load come from the cache, so they are exactly the same
+    auto cachedResults = second.GetMetric(EXEC_NETWORK_METRIC_KEY(STREAMS_AUTOTUNE_RESULTS)).as<Results>();
+    EXPECT_EQ(cachedResults, results);
+    EXPECT_EQ(second.GetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS).as<std::string>(), std::to_string(streams));
+    EXPECT_EQ(second.GetConfig(PluginConfigParams::KEY_CPU_THREADS_NUM).as<std::string>(), std::to_string(threads));
+
+    MKLDNNStreamsAutotuner::clearCache();
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "ie_compile_profiler.hpp"
+
+using namespace InferenceEngine;
+
+TEST(CompileProfilerTests, noPhaseOutsideOfScopes) {
+    EXPECT_EQ(nullptr, CompilePhaseScope::current());
+    EXPECT_EQ(nullptr, CompilePhaseScope::root());
+    EXPECT_TRUE(getCompilePhaseDurations(nullptr).empty());
+}
+
+TEST(CompileProfilerTests, nestedPhasesFormTree) {
+    CompilePhase::Ptr root;
+    {
+        IE_COMPILE_PHASE("Load");
+        root = CompilePhaseScope::root();
+        {
+            IE_COMPILE_PHASE("Transform");
+            EXPECT_EQ(root, CompilePhaseScope::root());
+            EXPECT_EQ("Transform", CompilePhaseScope::current()->name);
+        }
+        for (int i = 0; i < 3; i++) {
+            IE_COMPILE_PHASE("Compile");
+        }
+    }
+    EXPECT_EQ(nullptr, CompilePhaseScope::current());
+
+    ASSERT_NE(nullptr, root);
+    EXPECT_EQ(1u, root->count);
+    ASSERT_EQ(2u, root->children.size());
+    EXPECT_EQ("Transform", root->children[0]->name);
+    EXPECT_EQ("Compile", root->children[1]->name);
+    EXPECT_EQ(3u, root->children[1]->count);
+
+    auto durations = getCompilePhaseDurations(root);
+    ASSERT_EQ(3u, durations.size());
+    EXPECT_EQ(1u, durations.count("Load"));
+    EXPECT_EQ(1u, durations.count("Load/Transform"));
+    EXPECT_EQ(1u, durations.count("Load/Compile"));
+    EXPECT_GE(durations["Load"], durations["Load/Transform"]);
+}
+
+TEST(CompileProfilerTests, phasesOfOtherThreadsAreAttachedToParent) {
+    CompilePhase::Ptr root;
+    {
+        IE_COMPILE_PHASE("Load");
+        root = CompilePhaseScope::root();
+        auto parent = CompilePhaseScope::current();
+        std::thread thread{[parent] {
+            CompilePhaseScope graph{"CreateGraph", parent};
+            IE_COMPILE_PHASE("CreatePrimitives");
+        }};
+        thread.join();
+    }
+
+    auto durations = getCompilePhaseDurations(root);
+    EXPECT_EQ(1u, durations.count("Load/CreateGraph"));
+    EXPECT_EQ(1u, durations.count("Load/CreateGraph/CreatePrimitives"));
+}
@@ -0,0 +1,186 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <ie_compiled_model_cache.hpp>
+#include "common_test_utils/file_utils.hpp"
+#include "unit_test_utils/mocks/mock_iexecutable_network.hpp"
+
+using namespace InferenceEngine;
+using testing::_;
+using testing::An;
+using testing::Invoke;
+
+class CompiledModelCacheTests : public ::testing::Test {
+protected:
+    const std::string cacheDir = "ie_compiled_model_cache_test";
+    const std::string modelPath = "ie_compiled_model_cache_test.xml";
+    const std::string key = "0123456789abcdef";
+    int compiled = 0;
+    int imported = 0;
+    bool deviceBusy = false;
+
+    void SetUp() override {
+        writeFile(modelPath, "model");
+        cache.setDir(cacheDir);
+    }
+
+    void TearDown() override {
+        std::remove(modelPath.c_str());
+        std::remove(blobPath().c_str());
+        std::remove(metaPath().c_str());
+        std::remove(cacheDir.c_str());
+    }
+
+    static void writeFile(const std::string& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+    }
+
+    std::string blobPath() const {
+        return CommonTestUtils::makePath(cacheDir, key + ".blob");
+    }
+
+    std::string metaPath() const {
+        return CommonTestUtils::makePath(cacheDir, key + ".meta");
+    }
+
+    ExecutableNetwork compile() {
+        compiled++;
+        auto network = std::make_shared<MockIExecutableNetwork>();
+        EXPECT_CALL(*network, Export(An<const std::string&>(), _))
+            .WillRepeatedly(Invoke([](const std::string& path, ResponseDesc*) {
+                writeFile(path, "compiled");
+                return StatusCode::OK;
+            }));
+        return ExecutableNetwork{network};
+    }
+
+    ExecutableNetwork import(const std::string& path) {
+        imported++;
+        if (deviceBusy) {
+            THROW_IE_EXCEPTION << "Device is busy";
+        }
+        std::ifstream file(path, std::ios::binary);
+        std::string content;
+        file >> content;
+        if (content != "compiled") {
+            THROW_IE_EXCEPTION << details::as_status << NETWORK_NOT_READ << "Wrong blob";
+        }
+        return ExecutableNetwork{std::make_shared<MockIExecutableNetwork>()};
+    }
+
+    ExecutableNetwork load() {
+        return cache.load(key, [this] { return compile(); },
+                          [this](const std::string& path) { return import(path); });
+    }
+
+    CompiledModelCache cache;
+};
+
+TEST_F(CompiledModelCacheTests, KeyDependsOnModelDeviceVersionConfigAndExtensions) {
+    const auto reference = CompiledModelCache::computeKey({modelPath}, "MYRIAD", "1", {{"KEY", "VALUE"}});
+    EXPECT_EQ(reference, CompiledModelCache::computeKey({modelPath}, "MYRIAD", "1", {{"KEY", "VALUE"}}));
+    EXPECT_NE(reference, CompiledModelCache::computeKey({modelPath}, "GNA", "1", {{"KEY", "VALUE"}}));
+    EXPECT_NE(reference, CompiledModelCache::computeKey({modelPath}, "MYRIAD", "2", {{"KEY", "VALUE"}}));
+    EXPECT_NE(reference, CompiledModelCache::computeKey({modelPath}, "MYRIAD", "1", {{"KEY", "OTHER"}}));
+    EXPECT_NE(reference, CompiledModelCache::computeKey({modelPath}, "MYRIAD", "1", {{"KEY", "VALUE"}}, {"1.0 ext"}));
+
+    writeFile(modelPath, "modified model");
+    EXPECT_NE(reference, CompiledModelCache::computeKey({modelPath}, "MYRIAD", "1", {{"KEY", "VALUE"}}));
+}
+
+TEST_F(CompiledModelCacheTests, ThrowsIfModelFileIsMissing) {
+    EXPECT_THROW(CompiledModelCache::computeKey({"not_existing.xml"}, "MYRIAD", "1", {}),
+                 details::InferenceEngineException);
+}
+
+TEST_F(CompiledModelCacheTests, CompilesOnMissAndImportsOnHit) {
+    load();
+    EXPECT_EQ(1, compiled);
+    EXPECT_EQ(0, imported);
+    EXPECT_TRUE(CommonTestUtils::fileExists(blobPath()));
+
+    load();
+    EXPECT_EQ(1, compiled);
+    EXPECT_EQ(1, imported);
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+}
+
+TEST_F(CompiledModelCacheTests, RemovesEntryIfBlobCannotBeRead) {
+    load();
+    // the size is kept, so the blob is passed to the plugin
+    writeFile(blobPath(), "damaged!");
+
+    load();
+    EXPECT_EQ(2, compiled);
+    EXPECT_EQ(1, imported);
+    EXPECT_EQ(2u, cache.getStatistics().misses);
+
+    load();
+    EXPECT_EQ(2, compiled);
+    EXPECT_EQ(2, imported);
+}
+
+TEST_F(CompiledModelCacheTests, RemovesEntryWithBadHeader) {
+    load();
+    writeFile(metaPath(), "ie_compiled_model_cache 0 8\n10");
+
+    load();
+    EXPECT_EQ(2, compiled);
+    EXPECT_EQ(0, imported);
+
+    writeFile(blobPath(), "compi");
+
+    load();
+    EXPECT_EQ(3, compiled);
+    EXPECT_EQ(0, imported);
+
+    load();
+    EXPECT_EQ(3, compiled);
+    EXPECT_EQ(1, imported);
+}
+
+TEST_F(CompiledModelCacheTests, KeepsEntryIfImportFailsForOtherReason) {
+    load();
+    deviceBusy = true;
+
+    load();
+    EXPECT_EQ(2, compiled);
+    EXPECT_EQ(1, imported);
+    EXPECT_TRUE(CommonTestUtils::fileExists(blobPath()));
+
+    deviceBusy = false;
+    load();
+    EXPECT_EQ(2, compiled);
+    EXPECT_EQ(2, imported);
+}
+
+TEST_F(CompiledModelCacheTests, EvictsEntriesAboveMaxSize) {
+    cache.setMaxSize(1);
+    load();
+    EXPECT_FALSE(CommonTestUtils::fileExists(blobPath()));
+
+    load();
+    EXPECT_EQ(2, compiled);
+}
+
+TEST_F(CompiledModelCacheTests, CompilesAlwaysIfDisabled) {
+    cache.setDir("");
+    EXPECT_FALSE(cache.enabled());
+    load();
+    load();
+    EXPECT_EQ(2, compiled);
+    EXPECT_EQ(0u, cache.getStatistics().misses);
+}
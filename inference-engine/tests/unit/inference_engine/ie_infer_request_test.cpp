@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <vector>
+
+#include "cpp/ie_infer_request.hpp"
+
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/mock_ie_imemory_state.hpp"
+
+using testing::_;
+using testing::Return;
+using testing::SetArgReferee;
+
+class InferRequestTests : public ::testing::Test {
+protected:
+    std::shared_ptr<MockIInferRequest> mockIInferReq_p;
+    std::unique_ptr<InferenceEngine::InferRequest> inferRequest;
+
+    void TearDown() override {
+        inferRequest.reset();
+        mockIInferReq_p.reset();
+    }
+
+    void SetUp() override {
+        mockIInferReq_p = std::make_shared<MockIInferRequest>();
+        inferRequest.reset(new InferenceEngine::InferRequest(mockIInferReq_p));
+    }
+};
+
+TEST_F(InferRequestTests, QueryStateThrowsIfReturnErr) {
+    EXPECT_CALL(*mockIInferReq_p.get(), QueryState(_, _, _))
+            .Times(1)
+            .WillOnce(Return(InferenceEngine::GENERAL_ERROR));
+    EXPECT_THROW(inferRequest->QueryState(), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(InferRequestTests, QueryStateIfReturnOutOfBounds) {
+    EXPECT_CALL(*mockIInferReq_p.get(), QueryState(_, _, _))
+            .Times(1)
+            .WillOnce(Return(InferenceEngine::OUT_OF_BOUNDS));
+    std::vector<InferenceEngine::MemoryState> MemState_;
+    EXPECT_NO_THROW(MemState_ = inferRequest->QueryState());
+    EXPECT_EQ(MemState_.size(), 0);
+}
+
+TEST_F(InferRequestTests, QueryState) {
+    std::shared_ptr<MockIMemoryState> mockIMemState_p = std::make_shared<MockIMemoryState>();
+    EXPECT_CALL(*mockIInferReq_p.get(), QueryState(_, _, _))
+            .Times(2)
+            .WillOnce(DoAll(SetArgReferee<0>(mockIMemState_p), Return(InferenceEngine::OK)))
+            .WillOnce(Return(InferenceEngine::OUT_OF_BOUNDS));
+    std::vector<InferenceEngine::MemoryState> MemState_v;
+    EXPECT_NO_THROW(MemState_v = inferRequest->QueryState());
+    EXPECT_EQ(MemState_v.size(), 1);
+}
@@ -0,0 +1,154 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_executor_manager.hpp>
+#include <threading/ie_shared_streams_executor.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+
+IStreamsExecutor::Ptr makeExecutor(int streams) {
+    return std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"SharedStreamsExecutorTest", streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+}
+
+bool waitFor(const std::function<bool()>& predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void updateMax(std::atomic<int>& maxValue, int value) {
+    int current = maxValue.load();
+    while (value > current && !maxValue.compare_exchange_weak(current, value)) {}
+}
+
+}  // namespace
+
+TEST(SharedStreamsExecutorTests, AdmitsTasksAccordingToWeights) {
+    auto scheduler = std::make_shared<SharedStreamsScheduler>(makeExecutor(1), 1);
+    auto heavy = scheduler->createClient(3);
+    auto light = scheduler->createClient(1);
+    auto gate = scheduler->createClient(1);
+
+    // the executor is kept busy until both clients have queued all their tasks
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    gate->run([released] { released.wait(); });
+
+    const int tasksNum = 40;
+    std::mutex mutex;
+    std::vector<int> order;
+    for (int i = 0; i < tasksNum; i++) {
+        heavy->run([&] { std::lock_guard<std::mutex> lock{mutex}; order.push_back(0); });
+        light->run([&] { std::lock_guard<std::mutex> lock{mutex}; order.push_back(1); });
+    }
+    EXPECT_EQ(scheduler->getOccupancy().queued, 2 * tasksNum);
+    EXPECT_EQ(scheduler->getOccupancy().inFlight, 1);
+
+    release.set_value();
+    ASSERT_TRUE(waitFor([&] { return scheduler->getOccupancy().completed == 2 * tasksNum + 1; }));
+
+    // while both clients have queued tasks, the heavy one gets three of every four slots
+    std::lock_guard<std::mutex> lock{mutex};
+    ASSERT_EQ(order.size(), 2 * tasksNum);
+    const auto heavyTasks = std::count(order.begin(), order.begin() + tasksNum / 2, 0);
+    EXPECT_GE(heavyTasks, 14);
+    EXPECT_LE(heavyTasks, 16);
+}
+
+TEST(SharedStreamsExecutorTests, RespectsQuotaAndGlobalLimit) {
+    const size_t maxInFlight = 3;
+    auto scheduler = std::make_shared<SharedStreamsScheduler>(makeExecutor(4), maxInFlight);
+    auto limited = scheduler->createClient(1, 1);
+    auto unlimited = scheduler->createClient(1);
+
+    std::atomic<int> limitedRunning{0}, totalRunning{0};
+    std::atomic<int> limitedMax{0}, totalMax{0};
+    auto makeTask = [&](bool isLimited) {
+        return [&, isLimited] {
+            updateMax(totalMax, ++totalRunning);
+            if (isLimited)
+                updateMax(limitedMax, ++limitedRunning);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (isLimited)
+                --limitedRunning;
+            --totalRunning;
+        };
+    };
+
+    const int tasksNum = 30;
+    for (int i = 0; i < tasksNum; i++) {
+        limited->run(makeTask(true));
+        unlimited->run(makeTask(false));
+    }
+    ASSERT_TRUE(waitFor([&] { return scheduler->getOccupancy().completed == 2 * tasksNum; }));
+
+    EXPECT_EQ(limitedMax.load(), 1);
+    EXPECT_LE(totalMax.load(), static_cast<int>(maxInFlight));
+
+    auto occupancy = scheduler->getOccupancy();
+    EXPECT_EQ(occupancy.inFlight, 0);
+    EXPECT_EQ(occupancy.queued, 0);
+    EXPECT_EQ(occupancy.maxInFlight, maxInFlight);
+    EXPECT_EQ(occupancy.clients, 2);
+
+    auto limitedOccupancy = limited->getOccupancy();
+    EXPECT_EQ(limitedOccupancy.completed, tasksNum);
+    EXPECT_EQ(limitedOccupancy.maxInFlight, 1);
+}
+
+TEST(SharedStreamsExecutorTests, ClientsAreUnregisteredOnDestruction) {
+    auto scheduler = std::make_shared<SharedStreamsScheduler>(makeExecutor(1), 1);
+    auto client = scheduler->createClient();
+    client->run([] {});
+    ASSERT_TRUE(waitFor([&] { return scheduler->getOccupancy().completed == 1; }));
+    EXPECT_EQ(scheduler->getOccupancy().clients, 1);
+
+    client.reset();
+    EXPECT_EQ(scheduler->getOccupancy().clients, 0);
+}
+
+TEST(SharedStreamsExecutorTests, ExecutorManagerSharesSchedulerBetweenCallers) {
+    IStreamsExecutor::Config config{"SharedStreamsExecutorManagerTest", 2, 1};
+    auto first = ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(config);
+    auto second = ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(config);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->getOccupancy().maxInFlight, 2);
+
+    config._streams = 1;
+    EXPECT_NE(ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(config), first);
+
+    ExecutorManager::getInstance()->clear("SharedStreamsExecutorManagerTest");
+}
+
+TEST(SharedStreamsExecutorTests, ExecutorManagerKeepsLimitOfFirstCaller) {
+    IStreamsExecutor::Config config{"SharedStreamsExecutorLimitTest", 2, 1};
+    auto first = ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(config, 3);
+    EXPECT_EQ(first->getOccupancy().maxInFlight, 3);
+
+    EXPECT_EQ(ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(config), first);
+    EXPECT_EQ(ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(config, 3), first);
+    EXPECT_THROW(ExecutorManager::getInstance()->getSharedCPUStreamsScheduler(config, 1), details::InferenceEngineException);
+    EXPECT_EQ(first->getOccupancy().maxInFlight, 3);
+
+    ExecutorManager::getInstance()->clear("SharedStreamsExecutorLimitTest");
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ie_system_conf.h"
+
+using namespace InferenceEngine;
+
+#if defined(__linux__)
+
+#include <unistd.h>
+
+TEST(SystemConfTests, cpusOfNumaNodesMatchNodeOfCpu) {
+    for (auto numaNode : getAvailableNUMANodes()) {
+        for (auto cpu : getNUMANodeCPUs(numaNode)) {
+            EXPECT_EQ(getNUMANodeOfCPU(cpu), numaNode) << "cpu: " << cpu;
+        }
+    }
+}
+
+TEST(SystemConfTests, memoryIsMovedToNumaNode) {
+    const auto numaNode = getAvailableNUMANodes().back();
+    std::vector<char> buffer(1 << 20, 1);
+
+    // moving pages may be not permitted in the environment
+    if (!moveMemoryToNUMANodes(buffer.data(), buffer.size(), {numaNode}))
+        return;
+
+    auto placement = getMemoryNUMAPlacement(buffer.data(), buffer.size());
+    ASSERT_EQ(placement.size(), 1);
+    EXPECT_EQ(placement.begin()->first, numaNode);
+    // the buffer is not page aligned, so its first and last pages are shared with other allocations
+    EXPECT_GE(placement.begin()->second, buffer.size() / sysconf(_SC_PAGESIZE) - 1);
+}
+
+TEST(SystemConfTests, onlyFullyCoveredPagesAreVisited) {
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<char> buffer(4 * pageSize, 1);
+    auto aligned = reinterpret_cast<char*>(
+            (reinterpret_cast<uintptr_t>(buffer.data()) + pageSize - 1) & ~(pageSize - 1));
+
+    // the buffer touches three pages, but only the middle one lies inside it
+    size_t pages = 0;
+    for (auto& node : getMemoryNUMAPlacement(aligned + 1, 2 * pageSize))
+        pages += node.second;
+    EXPECT_EQ(pages, 1);
+
+    EXPECT_TRUE(getMemoryNUMAPlacement(aligned + 1, pageSize - 1).empty());
+    EXPECT_TRUE(moveMemoryToNUMANodes(aligned + 1, pageSize - 1, {getAvailableNUMANodes().back()}));
+}
+
+#endif  // defined(__linux__)
+
+TEST(SystemConfTests, emptyBufferHasNoPlacement) {
+    EXPECT_TRUE(getMemoryNUMAPlacement(nullptr, 0).empty());
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "precision_utils.h"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// covers both vectorized body and scalar tail, bigger than one parallel block
+constexpr size_t kArraySize = 100003;
+
+std::vector<float> makeFloats() {
+    std::vector<float> values = {
+        0.f, -0.f, 1.f, -1.f, 65504.f, -65504.f, 65519.f, 65520.f, 1e10f, -1e10f,
+        6.1035156e-05f, 3.0517578e-05f, 3.0e-05f, 1e-8f, -1e-8f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::denorm_min()
+    };
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> bits;
+    std::uniform_real_distribution<float> regular(-70000.f, 70000.f);
+    while (values.size() < kArraySize) {
+        uint32_t u = bits(gen);
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+        values.push_back(f);
+        values.push_back(regular(gen));
+    }
+    values.resize(kArraySize);
+    return values;
+}
+
+bool bitwiseEqual(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+}  // namespace
+
+TEST(PrecisionUtilsTests, f16tof32ArraysMatchesScalarForAllValues) {
+    std::vector<ie_fp16> src(65536);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<ie_fp16>(i);
+
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_TRUE(bitwiseEqual(dst[i], PrecisionUtils::f16tof32(src[i]))) << "fp16 value: " << i;
+}
+
+TEST(PrecisionUtilsTests, f32tof16ArraysMatchesScalar) {
+    auto src = makeFloats();
+    std::vector<ie_fp16> dst(src.size());
+
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(dst[i], PrecisionUtils::f32tof16(src[i])) << "value: " << src[i];
+
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size(), 0.5f, 0.25f);
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(dst[i], PrecisionUtils::f32tof16(src[i] * 0.5f + 0.25f)) << "value: " << src[i];
+}
+
+TEST(PrecisionUtilsTests, bf16ArraysMatchScalar) {
+    auto src = makeFloats();
+    std::vector<ie_bf16> bf16(src.size());
+    std::vector<float> back(src.size());
+
+    PrecisionUtils::f32tobf16Arrays(bf16.data(), src.data(), src.size());
+    PrecisionUtils::bf16tof32Arrays(back.data(), bf16.data(), bf16.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(bf16[i], PrecisionUtils::f32tobf16(src[i])) << "value: " << src[i];
+        ASSERT_TRUE(bitwiseEqual(back[i], PrecisionUtils::bf16tof32(bf16[i]))) << "value: " << src[i];
+    }
+}
+
+TEST(PrecisionUtilsTests, f32tobf16RoundsToNearestEven) {
+    EXPECT_EQ(PrecisionUtils::bf16tof32(PrecisionUtils::f32tobf16(1.f)), 1.f);
+    // 1 + 2^-8 is exactly between 1 and 1 + 2^-7, rounded to even
+    EXPECT_EQ(PrecisionUtils::bf16tof32(PrecisionUtils::f32tobf16(1.f + std::ldexp(1.f, -8))), 1.f);
+    EXPECT_EQ(PrecisionUtils::bf16tof32(PrecisionUtils::f32tobf16(1.f + 3 * std::ldexp(1.f, -8))),
+              1.f + std::ldexp(1.f, -6));
+    EXPECT_TRUE(std::isnan(PrecisionUtils::bf16tof32(
+        PrecisionUtils::f32tobf16(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(PrecisionUtilsTests, integerArraysToF32) {
+    std::vector<uint8_t> u8(kArraySize);
+    std::vector<int8_t> i8(kArraySize);
+    for (size_t i = 0; i < kArraySize; i++) {
+        u8[i] = static_cast<uint8_t>(i);
+        i8[i] = static_cast<int8_t>(i);
+    }
+
+    std::vector<float> dst(kArraySize);
+    PrecisionUtils::u8tof32Arrays(dst.data(), u8.data(), u8.size(), 0.1f, 3.f);
+    for (size_t i = 0; i < kArraySize; i++)
+        ASSERT_EQ(dst[i], static_cast<float>(u8[i]) * 0.1f + 3.f);
+
+    PrecisionUtils::i8tof32Arrays(dst.data(), i8.data(), i8.size());
+    for (size_t i = 0; i < kArraySize; i++)
+        ASSERT_EQ(dst[i], static_cast<float>(i8[i]));
+}
+
+TEST(PrecisionUtilsTests, shortArraysToF32) {
+    std::vector<uint16_t> u16(kArraySize);
+    std::vector<int16_t> i16(kArraySize);
+    for (size_t i = 0; i < kArraySize; i++) {
+        u16[i] = static_cast<uint16_t>(i * 7);
+        i16[i] = static_cast<int16_t>(i * 7);
+    }
+
+    std::vector<float> dst(kArraySize);
+    PrecisionUtils::u16tof32Arrays(dst.data(), u16.data(), u16.size());
+    for (size_t i = 0; i < kArraySize; i++)
+        ASSERT_EQ(dst[i], static_cast<float>(u16[i]));
+
+    PrecisionUtils::i16tof32Arrays(dst.data(), i16.data(), i16.size(), 0.5f, -1.f);
+    for (size_t i = 0; i < kArraySize; i++)
+        ASSERT_EQ(dst[i], static_cast<float>(i16[i]) * 0.5f - 1.f);
+}
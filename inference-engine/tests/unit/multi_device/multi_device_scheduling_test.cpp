@@ -0,0 +1,205 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "multi_device_statistics.hpp"
+
+using namespace MultiDevicePlugin;
+using namespace std::chrono;
+
+namespace {
+
+// device with a fixed execution time, the statistics are updated the way the worker requests of the plugin do
+struct MockDevice {
+    MockDevice(int numRequests, milliseconds executionTime) : _executionTime{executionTime} {
+        _statistics._numRequests = numRequests;
+    }
+    DeviceStatistics            _statistics;
+    milliseconds                _executionTime;
+    std::vector<milliseconds>   _finishTimes;
+    std::size_t                 _scheduled = 0;
+};
+
+class MockScheduler {
+public:
+    explicit MockScheduler(std::vector<std::unique_ptr<MockDevice>>& devices) : _devices(devices) {
+        for (auto&& device : _devices) {
+            _statistics.push_back(&device->_statistics);
+        }
+    }
+
+    // mirrors MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest: the tasks go to the first device
+    // in the schedule order that has an idle request, returns the index of the device of the last started task
+    int Schedule() {
+        int last = -1;
+        while (_pending > 0) {
+            int scheduled = -1;
+            for (auto index : OrderDevicesBySchedule(_statistics, _pending, _sequence)) {
+                auto& device = *_devices[index];
+                if (device._statistics._inFlight < device._statistics._numRequests) {
+                    scheduled = static_cast<int>(index);
+                    break;
+                }
+            }
+            if (-1 == scheduled) {
+                break;
+            }
+            auto& device = *_devices[scheduled];
+            _pending--;
+            device._statistics.Started(_sequence++);
+            device._finishTimes.push_back(_now + device._executionTime);
+            device._scheduled++;
+            last = scheduled;
+        }
+        return last;
+    }
+
+    // completes the earliest running request
+    void FinishNext() {
+        MockDevice* earliest = nullptr;
+        for (auto&& device : _devices) {
+            if (!device->_finishTimes.empty() &&
+                (nullptr == earliest || device->_finishTimes.front() < earliest->_finishTimes.front())) {
+                earliest = device.get();
+            }
+        }
+        ASSERT_NE(nullptr, earliest);
+        _now = earliest->_finishTimes.front();
+        earliest->_finishTimes.erase(earliest->_finishTimes.begin());
+        earliest->_statistics.Finished(earliest->_executionTime);
+    }
+
+    int             _pending = 0;
+    std::uint64_t   _sequence = 0;
+    milliseconds    _now{0};
+
+private:
+    std::vector<std::unique_ptr<MockDevice>>&   _devices;
+    std::vector<const DeviceStatistics*>        _statistics;
+};
+
+std::unique_ptr<MockDevice> makeDevice(int numRequests, milliseconds executionTime, milliseconds averageTime,
+                                       int inFlight = 0) {
+    std::unique_ptr<MockDevice> device{new MockDevice{numRequests, executionTime}};
+    device->_statistics._serviceTime = duration_cast<nanoseconds>(averageTime).count();
+    device->_statistics._inFlight = inFlight;
+    return device;
+}
+
+}  // namespace
+
+TEST(MultiDeviceSchedulingTest, FirstSamplesAreAveragedEqually) {
+    DeviceStatistics statistics;
+    statistics._numRequests = 1;
+    statistics.Started(0);
+    statistics.Finished(milliseconds{80});
+    for (int i = 1; i < 8; i++) {
+        statistics.Started(i);
+        statistics.Finished(milliseconds{10});
+    }
+    EXPECT_EQ(duration_cast<nanoseconds>(milliseconds{150}).count() / 8, statistics._serviceTime);
+    EXPECT_EQ(8, statistics._completed);
+    EXPECT_EQ(0, statistics._inFlight);
+
+    // then the new sample has 1/8 weight
+    const auto average = statistics._serviceTime.load();
+    statistics.Started(8);
+    statistics.Finished(milliseconds{2});
+    EXPECT_EQ(average - average / 8 + duration_cast<nanoseconds>(milliseconds{2}).count() / 8, statistics._serviceTime);
+}
+
+TEST(MultiDeviceSchedulingTest, OrdersByExpectedCompletionAndPriority) {
+    auto slow = makeDevice(2, milliseconds{8}, milliseconds{8});
+    auto fast = makeDevice(2, milliseconds{2}, milliseconds{2});
+    auto sameAsFast = makeDevice(2, milliseconds{2}, milliseconds{2});
+    auto noRequests = makeDevice(0, milliseconds{1}, milliseconds{0});
+
+    EXPECT_EQ((std::vector<std::size_t>{1, 2, 0}),
+              OrderDevicesBySchedule({&slow->_statistics, &fast->_statistics, &sameAsFast->_statistics,
+                                      &noRequests->_statistics}, 1, 0));
+    // all requests of the fast device are busy and it has to serve 4 more rounds, so it is expected after the slow one
+    fast->_statistics._inFlight = 2;
+    EXPECT_EQ((std::vector<std::size_t>{2, 0, 1}),
+              OrderDevicesBySchedule({&slow->_statistics, &fast->_statistics, &sameAsFast->_statistics}, 8, 0));
+}
+
+TEST(MultiDeviceSchedulingTest, BusyDeviceWithoutSamplesIsNotExpectedFirst) {
+    auto unknownBusy = makeDevice(2, milliseconds{2}, milliseconds{0}, 2);
+    auto unknownIdle = makeDevice(2, milliseconds{2}, milliseconds{0}, 1);
+    auto known = makeDevice(2, milliseconds{2}, milliseconds{5});
+
+    EXPECT_EQ((std::vector<std::size_t>{1, 2, 0}),
+              OrderDevicesBySchedule({&unknownBusy->_statistics, &unknownIdle->_statistics,
+                                      &known->_statistics}, 4, 0));
+}
+
+TEST(MultiDeviceSchedulingTest, FallsBackToIdleDeviceWhenEarliestIsBusy) {
+    std::vector<std::unique_ptr<MockDevice>> devices;
+    // all requests of the fast device are busy, it is still expected to finish a new request first
+    devices.push_back(makeDevice(1, milliseconds{8}, milliseconds{8}));
+    devices.push_back(makeDevice(1, milliseconds{1}, milliseconds{1}, 1));
+    devices[1]->_finishTimes.push_back(milliseconds{1});
+
+    std::vector<const DeviceStatistics*> statistics{&devices[0]->_statistics, &devices[1]->_statistics};
+    EXPECT_EQ((std::vector<std::size_t>{1, 0}), OrderDevicesBySchedule(statistics, 1, 0));
+
+    MockScheduler scheduler{devices};
+    scheduler._pending = 1;
+    EXPECT_EQ(0, scheduler.Schedule());
+    EXPECT_EQ(0, scheduler._pending);
+}
+
+TEST(MultiDeviceSchedulingTest, ExploresDeviceWithStaleSlowAverage) {
+    std::vector<std::unique_ptr<MockDevice>> devices;
+    devices.push_back(makeDevice(1, milliseconds{10}, milliseconds{10}));
+    // the first request of the second device was slow (e.g. a warm-up), but it is twice as fast as the first one
+    devices.push_back(makeDevice(1, milliseconds{5}, milliseconds{100}));
+    devices[0]->_statistics._completed = 8;
+    devices[1]->_statistics._completed = 1;
+
+    MockScheduler scheduler{devices};
+    // requests come one by one, so the first device is always idle
+    for (int i = 0; i < 2000; i++) {
+        scheduler._pending = 1;
+        ASSERT_NE(-1, scheduler.Schedule());
+        scheduler.FinishNext();
+        if (i < static_cast<int>(DeviceStatistics::kExplorationInterval)) {
+            ASSERT_EQ(0, devices[1]->_scheduled) << i;
+        }
+    }
+    EXPECT_LT(devices[1]->_statistics._serviceTime, devices[0]->_statistics._serviceTime);
+    // once the average is refreshed the faster device takes the requests, the other one is only explored
+    const auto scheduled = devices[0]->_scheduled;
+    for (std::uint64_t i = 0; i < 4 * DeviceStatistics::kExplorationInterval; i++) {
+        scheduler._pending = 1;
+        scheduler.Schedule();
+        scheduler.FinishNext();
+    }
+    EXPECT_EQ(scheduled + 4, devices[0]->_scheduled);
+}
+
+TEST(MultiDeviceSchedulingTest, KeepsAllDevicesBusyUnderLoad) {
+    std::vector<std::unique_ptr<MockDevice>> devices;
+    devices.push_back(makeDevice(2, milliseconds{6}, milliseconds{0}));
+    devices.push_back(makeDevice(2, milliseconds{2}, milliseconds{0}));
+
+    MockScheduler scheduler{devices};
+    scheduler._pending = 1200;
+    scheduler.Schedule();
+    while (scheduler._pending > 0) {
+        // no device waits while there are pending requests
+        for (auto&& device : devices) {
+            ASSERT_EQ(device->_statistics._numRequests, device->_statistics._inFlight);
+        }
+        scheduler.FinishNext();
+        scheduler.Schedule();
+    }
+    EXPECT_EQ(1200, devices[0]->_scheduled + devices[1]->_scheduled);
+    // the requests are shared in the proportion of the device speeds
+    EXPECT_NEAR(3., static_cast<double>(devices[1]->_scheduled) / devices[0]->_scheduled, 0.1);
+}
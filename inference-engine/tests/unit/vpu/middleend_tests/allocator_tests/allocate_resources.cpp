@@ -0,0 +1,262 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+#include "reference_free_pool.hpp"
+
+#include <vpu/middleend/allocator/allocator.hpp>
+#include <vpu/middleend/allocator/structs.hpp>
+#include <vpu/utils/numeric.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vpu {
+
+namespace {
+
+struct DataLifetime final {
+    MemoryType memType = MemoryType::DDR;
+    int size = 0;
+    int begin = -1;
+    int end = -1;
+};
+
+// Lifetimes of intermediate data allocated by allocateResources in terms of stage indices.
+// Child datas share the memory of their top parent, so they extend its lifetime.
+std::vector<DataLifetime> collectLifetimes(const Model& model) {
+    std::map<int, int> stageInds;
+    for (const auto& stage : model->getStages()) {
+        stageInds.emplace(stage->id(), static_cast<int>(stageInds.size()));
+    }
+
+    std::map<Data, DataLifetime> lifetimes;
+    for (const auto& data : model->datas()) {
+        const auto topParent = data->getTopParentData();
+        if (topParent->usage() != DataUsage::Intermediate) {
+            continue;
+        }
+
+        auto& lifetime = lifetimes[topParent];
+        lifetime.memType = topParent->dataLocation().location == Location::CMX ? MemoryType::CMX : MemoryType::DDR;
+        lifetime.size = alignVal(topParent->totalByteSize(), DATA_ALIGNMENT);
+
+        auto use = [&lifetime](int stageInd) {
+            lifetime.begin = lifetime.begin < 0 ? stageInd : std::min(lifetime.begin, stageInd);
+            lifetime.end = std::max(lifetime.end, stageInd);
+        };
+        if (const auto producer = data->producer()) {
+            use(stageInds.at(producer->id()));
+        }
+        for (const auto& consumer : data->consumers()) {
+            use(stageInds.at(consumer->id()));
+        }
+    }
+
+    std::vector<DataLifetime> result;
+    for (const auto& lifetime : lifetimes) {
+        if (lifetime.second.begin >= 0) {
+            result.push_back(lifetime.second);
+        }
+    }
+    return result;
+}
+
+// Replays the lifetimes in the order runAllocator() goes through the stages: outputs of a stage
+// are allocated before its inputs are freed. Returns the peak of used memory of the given type.
+template <class Pool>
+int replayLifetimes(const std::vector<DataLifetime>& lifetimes, MemoryType memType) {
+    int numStages = 0;
+    for (const auto& lifetime : lifetimes) {
+        numStages = std::max(numStages, lifetime.end + 1);
+    }
+
+    Pool pool;
+    int curOffset = 0;
+    int peakOffset = 0;
+    std::vector<int> offsets(lifetimes.size(), -1);
+    for (int stageInd = 0; stageInd < numStages; ++stageInd) {
+        for (size_t i = 0; i < lifetimes.size(); ++i) {
+            if (lifetimes[i].memType != memType || lifetimes[i].begin != stageInd) {
+                continue;
+            }
+
+            auto offset = pool.takeBestFit(lifetimes[i].size);
+            if (offset < 0) {
+                offset = curOffset;
+                curOffset += lifetimes[i].size;
+                peakOffset = std::max(peakOffset, curOffset);
+            }
+            offsets[i] = offset;
+        }
+
+        for (size_t i = 0; i < lifetimes.size(); ++i) {
+            if (lifetimes[i].memType != memType || lifetimes[i].end != stageInd) {
+                continue;
+            }
+
+            auto merged = pool.merge(freeMemory(offsets[i], lifetimes[i].size));
+            if (merged.offset + merged.size == curOffset) {
+                curOffset = merged.offset;
+            } else {
+                pool.insert(merged);
+            }
+        }
+    }
+    return peakOffset;
+}
+
+}  // namespace
+
+class AllocateResourcesTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _middleEnd = passManager->buildMiddleEnd();
+    }
+
+    // Chain of stages with outputs of different sizes
+    Model buildChain(int numStages) {
+        auto testModel = CreateTestModel();
+        testModel.createInputs({DataDesc{32, 32, 16}});
+        testModel.createOutputs({DataDesc{32, 32, 16}});
+
+        testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(DataDesc{32, 32, 8})});
+        for (int i = 1; i < numStages - 1; ++i) {
+            testModel.addStage({InputInfo::fromPrevStage(i - 1)}, {OutputInfo::intermediate(DataDesc{32, 32, 8 * (1 + i % 5)})});
+        }
+        testModel.addStage({InputInfo::fromPrevStage(numStages - 2)}, {OutputInfo::fromNetwork()});
+        return testModel.getBaseModel();
+    }
+
+    // Residual blocks: the shortcut of every block lives in CMX while its two-stage branch is computed
+    Model buildResidual(int numBlocks) {
+        auto testModel = CreateTestModel();
+        testModel.createInputs({DataDesc{16, 16, 32}});
+        testModel.createOutputs({DataDesc{16, 16, 32}});
+
+        InputInfo blockInput = InputInfo::fromNetwork();
+        for (int block = 0; block < numBlocks; ++block) {
+            const auto branchDesc = DataDesc{16, 16, 16 * (1 + block % 4)};
+            const auto split = testModel.addStage({blockInput}, {OutputInfo::intermediate(branchDesc),
+                                                                 OutputInfo::intermediate(DataDesc{8, 8, 16})});
+            split->output(1)->setMemReqs(MemoryType::CMX);
+
+            const auto splitInd = static_cast<int>(testModel.getStages().size()) - 1;
+            testModel.addStage({InputInfo::fromPrevStage(splitInd).output(0)}, {OutputInfo::intermediate(branchDesc)});
+            testModel.addStage({InputInfo::fromPrevStage(splitInd + 1)}, {OutputInfo::intermediate(DataDesc{16, 16, 32})});
+
+            if (block == numBlocks - 1) {
+                testModel.addStage({InputInfo::fromPrevStage(splitInd + 2), InputInfo::fromPrevStage(splitInd).output(1)},
+                                   {OutputInfo::fromNetwork()});
+            } else {
+                testModel.addStage({InputInfo::fromPrevStage(splitInd + 2), InputInfo::fromPrevStage(splitInd).output(1)},
+                                   {OutputInfo::intermediate(DataDesc{16, 16, 32})});
+                blockInput = InputInfo::fromPrevStage(splitInd + 3);
+            }
+        }
+        return testModel.getBaseModel();
+    }
+
+    // Three branches of different lengths and sizes joined pairwise
+    Model buildBranches(int numBlocks) {
+        auto testModel = CreateTestModel();
+        testModel.createInputs({DataDesc{32, 32, 8}});
+        testModel.createOutputs({DataDesc{32, 32, 8}});
+
+        InputInfo blockInput = InputInfo::fromNetwork();
+        for (int block = 0; block < numBlocks; ++block) {
+            testModel.addStage({blockInput}, {OutputInfo::intermediate(DataDesc{32, 32, 8}),
+                                              OutputInfo::intermediate(DataDesc{32, 32, 24}),
+                                              OutputInfo::intermediate(DataDesc{32, 32, 40})});
+            const auto forkInd = static_cast<int>(testModel.getStages().size()) - 1;
+
+            int branchEnds[3] = {};
+            for (int branch = 0; branch < 3; ++branch) {
+                testModel.addStage({InputInfo::fromPrevStage(forkInd).output(branch)},
+                                   {OutputInfo::intermediate(DataDesc{32, 32, 8 + 16 * branch})});
+                for (int i = 0; i < branch; ++i) {
+                    const auto prevInd = static_cast<int>(testModel.getStages().size()) - 1;
+                    testModel.addStage({InputInfo::fromPrevStage(prevInd)}, {OutputInfo::intermediate(DataDesc{32, 32, 8 + 16 * branch})});
+                }
+                branchEnds[branch] = static_cast<int>(testModel.getStages().size()) - 1;
+            }
+
+            testModel.addStage({InputInfo::fromPrevStage(branchEnds[0]), InputInfo::fromPrevStage(branchEnds[1])},
+                               {OutputInfo::intermediate(DataDesc{32, 32, 8})});
+            const auto joinInd = static_cast<int>(testModel.getStages().size()) - 1;
+            if (block == numBlocks - 1) {
+                testModel.addStage({InputInfo::fromPrevStage(joinInd), InputInfo::fromPrevStage(branchEnds[2])},
+                                   {OutputInfo::fromNetwork()});
+            } else {
+                testModel.addStage({InputInfo::fromPrevStage(joinInd), InputInfo::fromPrevStage(branchEnds[2])},
+                                   {OutputInfo::intermediate(DataDesc{32, 32, 8})});
+                blockInput = InputInfo::fromPrevStage(joinInd + 1);
+            }
+        }
+        return testModel.getBaseModel();
+    }
+
+protected:
+    PassSet::Ptr _middleEnd = nullptr;
+};
+
+// Runs allocateResources over the test networks and compares memory used by the linear free list
+// allocator used before FreeMemoryPool ("before") and by FreeMemoryPool ("after"). Both pools are
+// fed with the same data lifetimes the middle end produced for the network.
+TEST_F(AllocateResourcesTests, DISABLED_Benchmark) {
+    const int repeats = 1000;
+
+    const std::vector<std::pair<std::string, std::function<Model()>>> networks = {
+        {"chain of 300 stages", [this]() { return buildChain(300); }},
+        {"50 residual blocks", [this]() { return buildResidual(50); }},
+        {"30 blocks of 3 branches", [this]() { return buildBranches(30); }},
+    };
+
+    for (const auto& network : networks) {
+        auto model = network.second();
+        ASSERT_NO_THROW(_middleEnd->run(model));
+
+        const auto usedMemory = model->attrs().get<UsedMemory>("usedMemory");
+        const auto lifetimes = collectLifetimes(model);
+
+        std::cout << network.first << " (" << lifetimes.size() << " intermediate datas)" << std::endl;
+        std::cout << "    allocateResources: DDR " << usedMemory.BSS << ", CMX " << usedMemory.CMX << std::endl;
+
+        auto measure = [&](const char* name, std::function<int(MemoryType)> replay) {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < repeats; ++i) {
+                replay(MemoryType::DDR);
+                replay(MemoryType::CMX);
+            }
+            const auto time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / repeats;
+
+            const auto ddr = replay(MemoryType::DDR);
+            const auto cmx = replay(MemoryType::CMX);
+            std::cout << "    " << name << ": DDR " << ddr << ", CMX " << cmx << ", " << time << " us" << std::endl;
+            return std::make_pair(ddr, cmx);
+        };
+
+        const auto before = measure("before (linear search)", [&](MemoryType memType) {
+            return replayLifetimes<ReferenceFreePool>(lifetimes, memType);
+        });
+        const auto after = measure("after (FreeMemoryPool)", [&](MemoryType memType) {
+            return replayLifetimes<allocator::FreeMemoryPool>(lifetimes, memType);
+        });
+
+        EXPECT_LE(after.first, before.first * 1.05) << network.first;
+        EXPECT_LE(after.second, before.second * 1.05) << network.first;
+    }
+}
+
+}  // namespace vpu
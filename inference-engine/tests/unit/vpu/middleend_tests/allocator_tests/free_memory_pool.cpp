@@ -0,0 +1,184 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "reference_free_pool.hpp"
+
+#include <vpu/middleend/allocator/structs.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace vpu {
+
+namespace {
+
+// Allocates liveBlocks blocks of random sizes, then frees a random block and allocates a new one
+// on every iteration, so the free pool is fragmented. Memory is taken from the free pool first and
+// from the end of used memory otherwise. Returns the peak of used memory.
+template <class Pool>
+int runWorkload(Pool& pool, int iterations, int liveBlocks) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> sizeDist(1, 16);
+
+    int curOffset = 0;
+    int peakOffset = 0;
+    std::vector<allocator::FreeMemory> allocated;
+    for (int iter = 0; iter < iterations; ++iter) {
+        if (static_cast<int>(allocated.size()) > liveBlocks || (iter >= liveBlocks && gen() % 2 == 0)) {
+            const auto ind = gen() % allocated.size();
+            auto merged = pool.merge(allocated[ind]);
+            allocated[ind] = allocated.back();
+            allocated.pop_back();
+
+            if (merged.offset + merged.size == curOffset) {
+                curOffset = merged.offset;
+            } else {
+                pool.insert(merged);
+            }
+        } else {
+            const auto size = sizeDist(gen) * 64;
+            auto offset = pool.takeBestFit(size);
+            if (offset < 0) {
+                offset = curOffset;
+                curOffset += size;
+                peakOffset = std::max(peakOffset, curOffset);
+            }
+            allocated.push_back(freeMemory(offset, size));
+        }
+    }
+    return peakOffset;
+}
+
+}  // namespace
+
+TEST(VPU_FreeMemoryPoolTest, MergesAdjacentBlocks) {
+    allocator::FreeMemoryPool pool;
+
+    pool.insert(pool.merge(freeMemory(0, 64)));
+    pool.insert(pool.merge(freeMemory(128, 64)));
+    ASSERT_EQ(pool.size(), 2);
+
+    auto merged = pool.merge(freeMemory(64, 64));
+    EXPECT_EQ(merged.offset, 0);
+    EXPECT_EQ(merged.size, 192);
+    EXPECT_TRUE(pool.empty());
+}
+
+TEST(VPU_FreeMemoryPoolTest, TakesMemoryFromEndOfSmallestSuitableBlock) {
+    allocator::FreeMemoryPool pool;
+
+    pool.insert(freeMemory(0, 256));
+    pool.insert(freeMemory(512, 128));
+    pool.insert(freeMemory(1024, 192));
+
+    EXPECT_EQ(pool.takeBestFit(512), -1);
+    EXPECT_EQ(pool.takeBestFit(160), 1024 + 192 - 160);
+    EXPECT_EQ(pool.takeBestFit(64), 512 + 128 - 64);
+    EXPECT_EQ(pool.takeBestFit(64), 512);
+    EXPECT_EQ(pool.takeBestFit(32), 1024);
+    EXPECT_EQ(pool.size(), 1);
+}
+
+TEST(VPU_FreeMemoryPoolTest, MatchesLinearSearchOnRandomSequence) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> sizeDist(1, 16);
+
+    allocator::FreeMemoryPool pool;
+    ReferenceFreePool reference;
+
+    // memory is allocated from the free pool first and from the end of used memory otherwise
+    int curOffset = 0;
+    std::vector<allocator::FreeMemory> allocated;
+
+    for (int iter = 0; iter < 5000; ++iter) {
+        if (allocated.empty() || gen() % 2 == 0) {
+            const auto size = sizeDist(gen) * 64;
+            auto offset = pool.takeBestFit(size);
+
+            // the pool may break a tie between equally sized blocks differently from the list order,
+            // the reference takes the same block to stay in sync
+            auto candidates = reference.bestFitCandidates(size);
+            if (offset < 0) {
+                ASSERT_TRUE(candidates.empty()) << "iteration " << iter;
+                offset = curOffset;
+                curOffset += size;
+            } else {
+                ASSERT_NE(std::find(candidates.begin(), candidates.end(), offset), candidates.end())
+                    << "iteration " << iter;
+                reference.takeAt(offset, size);
+            }
+            allocated.push_back(freeMemory(offset, size));
+        } else {
+            const auto ind = gen() % allocated.size();
+            auto mem = allocated[ind];
+            allocated.erase(allocated.begin() + ind);
+
+            auto merged = pool.merge(mem);
+            auto referenceMerged = reference.merge(mem);
+            ASSERT_EQ(merged.offset, referenceMerged.offset) << "iteration " << iter;
+            ASSERT_EQ(merged.size, referenceMerged.size) << "iteration " << iter;
+
+            if (merged.offset + merged.size == curOffset) {
+                curOffset = merged.offset;
+            } else {
+                pool.insert(merged);
+                reference.insert(merged);
+            }
+        }
+        ASSERT_EQ(pool.size(), reference.size()) << "iteration " << iter;
+    }
+}
+
+TEST(VPU_FreeMemoryPoolTest, HandlesManyBlocks) {
+    allocator::FreeMemoryPool pool;
+
+    // every second block is free, then the gaps are freed in reverse order, so each merge joins two blocks
+    const int blocksNum = 100000;
+    const int blockSize = 64;
+    for (int i = 0; i < blocksNum; i += 2) {
+        pool.insert(pool.merge(freeMemory(i * blockSize, blockSize)));
+    }
+    ASSERT_EQ(pool.size(), blocksNum / 2);
+
+    for (int i = blocksNum - 1; i > 0; i -= 2) {
+        pool.insert(pool.merge(freeMemory(i * blockSize, blockSize)));
+    }
+    ASSERT_EQ(pool.size(), 1);
+
+    EXPECT_EQ(pool.takeBestFit(blocksNum * blockSize), 0);
+    EXPECT_TRUE(pool.empty());
+}
+
+// Compares the pool with the linear algorithm on a workload with 20k live blocks
+TEST(VPU_FreeMemoryPoolTest, DISABLED_Performance) {
+    const int iterations = 200000;
+    const int liveBlocks = 20000;
+
+    auto measure = [&](const char* name, std::function<int()> run) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto usedMemory = run();
+        const auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << name << ": " << time << " ms, peak memory " << usedMemory << std::endl;
+        return usedMemory;
+    };
+
+    const auto poolMemory = measure("FreeMemoryPool", [&]() {
+        allocator::FreeMemoryPool pool;
+        return runWorkload(pool, iterations, liveBlocks);
+    });
+    const auto referenceMemory = measure("linear search", [&]() {
+        ReferenceFreePool pool;
+        return runWorkload(pool, iterations, liveBlocks);
+    });
+    EXPECT_LE(poolMemory, referenceMemory * 1.05);
+}
+
+}  // namespace vpu
@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vpu/middleend/allocator/structs.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <list>
+#include <vector>
+
+namespace vpu {
+
+inline allocator::FreeMemory freeMemory(int offset, int size) {
+    allocator::FreeMemory mem;
+    mem.offset = offset;
+    mem.size = size;
+    return mem;
+}
+
+//
+// The linear algorithm used by Allocator before FreeMemoryPool: free blocks are kept in a list
+// in the order they were freed, merging rescans the list until nothing merges and the best fit
+// is the first smallest suitable block of the list
+//
+
+class ReferenceFreePool {
+public:
+    allocator::FreeMemory merge(allocator::FreeMemory newMem) {
+        while (true) {
+            bool found = false;
+
+            for (auto memPoolIt = _freePool.begin(); memPoolIt != _freePool.end(); ++memPoolIt) {
+                if (newMem.offset + newMem.size == memPoolIt->offset) {
+                    newMem.size += memPoolIt->size;
+                    _freePool.erase(memPoolIt);
+                    found = true;
+                    break;
+                } else if (memPoolIt->offset + memPoolIt->size == newMem.offset) {
+                    newMem.offset = memPoolIt->offset;
+                    newMem.size += memPoolIt->size;
+                    _freePool.erase(memPoolIt);
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found) {
+                return newMem;
+            }
+        }
+    }
+
+    void insert(const allocator::FreeMemory& mem) {
+        _freePool.emplace_back(mem);
+    }
+
+    int takeBestFit(int size) {
+        auto minMemIt = findBestFit(size);
+        if (minMemIt == _freePool.end()) {
+            return -1;
+        }
+        return take(minMemIt, size);
+    }
+
+    // Offsets which the linear search could return if it broke ties between equally sized blocks differently
+    std::vector<int> bestFitCandidates(int size) {
+        std::vector<int> offsets;
+        auto minMemIt = findBestFit(size);
+        for (auto memPoolIt = _freePool.begin(); minMemIt != _freePool.end() && memPoolIt != _freePool.end(); ++memPoolIt) {
+            if (memPoolIt->size == minMemIt->size) {
+                offsets.push_back(memPoolIt->offset + memPoolIt->size - size);
+            }
+        }
+        return offsets;
+    }
+
+    // Takes size bytes at the given offset from the end of a block like takeBestFit() does
+    void takeAt(int offset, int size) {
+        for (auto memPoolIt = _freePool.begin(); memPoolIt != _freePool.end(); ++memPoolIt) {
+            if (memPoolIt->offset + memPoolIt->size - size == offset) {
+                take(memPoolIt, size);
+                return;
+            }
+        }
+        FAIL() << "no free block ends at " << offset + size;
+    }
+
+    size_t size() const { return _freePool.size(); }
+
+private:
+    std::list<allocator::FreeMemory>::iterator findBestFit(int size) {
+        auto minMemSizeToUse = std::numeric_limits<int>::max();
+        auto minMemIt = _freePool.end();
+
+        for (auto memPoolIt = _freePool.begin(); memPoolIt != _freePool.end(); ++memPoolIt) {
+            if (memPoolIt->size >= size && memPoolIt->size < minMemSizeToUse) {
+                minMemSizeToUse = memPoolIt->size;
+                minMemIt = memPoolIt;
+            }
+        }
+        return minMemIt;
+    }
+
+    int take(std::list<allocator::FreeMemory>::iterator minMemIt, int size) {
+        auto offset = minMemIt->offset + minMemIt->size - size;
+        minMemIt->size -= size;
+        if (minMemIt->size == 0) {
+            _freePool.erase(minMemIt);
+        }
+        return offset;
+    }
+
+    std::list<allocator::FreeMemory> _freePool;
+};
+
+}  // namespace vpu
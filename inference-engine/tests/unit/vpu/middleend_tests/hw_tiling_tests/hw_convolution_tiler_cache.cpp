@@ -0,0 +1,61 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+class VPU_HWConvolutionTilerCacheTest : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static HWTilingNS::ConvolutionOptions convolution(const std::string& name, int channels) {
+        const DimValues inputDims{{Dim::W, 56}, {Dim::H, 56}, {Dim::C, channels}, {Dim::N, 1}};
+        const DimValues outputDims{{Dim::W, 56}, {Dim::H, 56}, {Dim::C, 64}, {Dim::N, 1}};
+
+        return HWTilingNS::ConvolutionOptions(name, inputDims, outputDims, outputDims,
+                                              3, 3, 1, 1, 1, 1, 1, false);
+    }
+
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+};
+
+TEST_F(VPU_HWConvolutionTilerCacheTest, IdenticalConvolutionsShareTiler) {
+    const auto tiler1 = HWTilingNS::HWConvolutionTiler::getCached(convolution("conv1", 64), direction, 1);
+    const auto tiler2 = HWTilingNS::HWConvolutionTiler::getCached(convolution("conv2", 64), direction, 1);
+
+    ASSERT_NE(tiler1, nullptr);
+    EXPECT_EQ(tiler1, tiler2);
+    EXPECT_TRUE(tiler1->isTilingPossible());
+}
+
+TEST_F(VPU_HWConvolutionTilerCacheTest, CachedTilerMatchesSearch) {
+    const auto options = convolution("conv", 128);
+    const auto cached = HWTilingNS::HWConvolutionTiler::getCached(options, direction, 1);
+    const HWTilingNS::HWConvolutionTiler tiler(options, direction, 1);
+
+    ASSERT_EQ(cached->isTilingPossible(), tiler.isTilingPossible());
+    ASSERT_EQ(cached->getHwTilings().size(), tiler.getHwTilings().size());
+    for (size_t i = 0; i < tiler.getHwTilings().size(); ++i) {
+        const auto& expected = tiler.getHwTilings()[i];
+        const auto& actual = cached->getHwTilings()[i];
+        EXPECT_EQ(actual->sohTiles, expected->sohTiles);
+        EXPECT_EQ(actual->sowTiles, expected->sowTiles);
+        EXPECT_EQ(actual->socTiles, expected->socTiles);
+    }
+}
+
+TEST_F(VPU_HWConvolutionTilerCacheTest, DifferentConvolutionsAreTiledSeparately) {
+    const auto tiler1 = HWTilingNS::HWConvolutionTiler::getCached(convolution("conv", 64), direction, 1);
+    const auto tiler2 = HWTilingNS::HWConvolutionTiler::getCached(convolution("conv", 256), direction, 1);
+
+    EXPECT_NE(tiler1, tiler2);
+}
+
+}  // namespace vpu
@@ -360,6 +360,78 @@ INSTANTIATE_TEST_CASE_P(
     ),
     SingleLayerTransformationsTestParams::getLowPrecisionTransformerSingleLayerTestName);
 
+INSTANTIATE_TEST_CASE_P(
+    smoke_GemmTestFP32,
+    SingleLayerTransformationsTest,
+    ::testing::Values(
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(false)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(true)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(false, true)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(true, true)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(false, false, true)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(false, true, true)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(false, false, false, true)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(false, false, false, false, true)),
+            { { 1, 3, 16, 64 }, { 1, 3, 32, 64 } },
+            { { 1, 3, 16, 32 } })
+    ),
+    SingleLayerTransformationsTestParams::getLowPrecisionTransformerSingleLayerTestName);
+
+INSTANTIATE_TEST_CASE_P(
+    smoke_Gemm3DTestFP32,
+    SingleLayerTransformationsTest,
+    ::testing::Values(
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(false)),
+            { { 1, 16, 64 }, { 1, 32, 64 } },
+            { { 1, 16, 32 } }),
+
+        SingleLayerTransformationsTestParams(
+            "CPU",
+            SingleLayerTestModel::Ptr(new GemmTestModel(true)),
+            { { 1, 16, 64 }, { 1, 32, 64 } },
+            { { 1, 16, 32 } })
+    ),
+    SingleLayerTransformationsTestParams::getLowPrecisionTransformerSingleLayerTestName);
+
 INSTANTIATE_TEST_CASE_P(
     smoke_ConcatTestFP32,
     SingleLayerTransformationsTest,
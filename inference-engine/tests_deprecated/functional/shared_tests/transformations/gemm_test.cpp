@@ -0,0 +1,204 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformer_single_layer_tests.hpp"
+#include "low_precision_transformations/gemm.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+// Narrows the quantized second input to 128 levels in [-64, 63] before the layer is transformed:
+// the interval still does not fit 7 bits, so the transformation has to requantize it to [-63, 63]
+class GemmWithNarrowedSecondInputTransformation : public GemmTransformation {
+public:
+    GemmWithNarrowedSecondInputTransformation(const Params& params) : GemmTransformation(params) {}
+
+    void transform(TransformationContext& context, CNNLayer& layer) const override {
+        if (canBeTransformed(context, layer)) {
+            const CNNLayerPtr scaleShift = CNNNetworkHelper::getParent(layer, 1);
+            if ((scaleShift == nullptr) || (scaleShift->type != "ScaleShift")) {
+                THROW_IE_EXCEPTION << "dequantization of the second input is absent";
+            }
+            const CNNLayerPtr fakeQuantize = CNNNetworkHelper::getParent(*scaleShift, 0);
+            QuantizeLayer* quantizeLayer = dynamic_cast<QuantizeLayer*>(fakeQuantize.get());
+            if (quantizeLayer == nullptr) {
+                THROW_IE_EXCEPTION << "second input is not quantized";
+            }
+
+            // the step is 1/16, the requantized interval [-4, 4] keeps the input values exact
+            CNNNetworkHelper::updateBlobs(*fakeQuantize, 1, -4.f);
+            CNNNetworkHelper::updateBlobs(*fakeQuantize, 2, 3.9375f);
+            CNNNetworkHelper::updateBlobs(*fakeQuantize, 3, -64.f);
+            CNNNetworkHelper::updateBlobs(*fakeQuantize, 4, 63.f);
+            fakeQuantize->params["levels"] = "128";
+            quantizeLayer->levels = 128;
+            CNNNetworkHelper::updateBlobs(*scaleShift, "weights", 1.f / 16.f);
+        }
+
+        GemmTransformation::transform(context, layer);
+    }
+};
+
+}  // namespace
+
+std::string GemmTestModel::getModel(SingleLayerTransformationsTestParams& p) const {
+    size_t type_size = sizeof(PrecisionTrait<Precision::FP32>::value_type);
+    if (p._network_precision == "FP16")
+        type_size = sizeof(PrecisionTrait<Precision::FP16>::value_type);
+
+    const std::vector<size_t> constDimensions = perChannel ?
+        std::vector<size_t>({ 1ul, p.inputDimensions[0][1], 1ul, 1ul }) :
+        std::vector<size_t>({ 1ul });
+    const size_t constSize = perChannel ? p.inputDimensions[0][1] * type_size : type_size;
+
+    std::map<std::string, std::string> const_params = {};
+    std::map<std::string, std::string> fake_quantize_params1 = { {"levels", "256"} };
+    // the second input interval is exactly representable in 7 bits after requantization
+    std::map<std::string, std::string> fake_quantize_params2 = { {"levels", "255"} };
+    std::map<std::string, std::string> gemm_params = { {"alpha", "1"}, {"beta", "0"}, {"transpose_a", "false"}, {"transpose_b", "true"} };
+
+    std::vector<std::pair<std::string, std::string>> edges = {
+        {"0,0", "6,6"}, {"1,1", "11,16"}, // Inputs
+        {"2,2", "6,7"}, {"3,3", "6,8"}, {"4,4", "6,9"}, {"5,5", "6,10"}, // Const layers
+        {"7,12", "11,17"}, {"8,13", "11,18"}, {"9,14", "11,19"}, {"10,15", "11,20"}, // Const layers
+        {"6,11", "12,22"}, {"11,21", "12,23"} // FakeQuantize to GEMM
+    };
+
+    return CommonTestUtils::DefaultNetBuilder::buildNetworkWithOneInput("GemmTestModel", p.inputDimensions[0], p._network_precision)
+        .addInputLayer(p._network_precision, p.inputDimensions[1])
+        .addLayer("Const", p._network_precision, &const_params, {{}, {constDimensions}}, constSize, 0)
+        .addLayer("Const", p._network_precision, &const_params, {{}, {constDimensions}}, constSize, 0)
+        .addLayer("Const", p._network_precision, &const_params, {{}, {constDimensions}}, constSize, 0)
+        .addLayer("Const", p._network_precision, &const_params, {{}, {constDimensions}}, constSize, 0)
+        .addLayer("FakeQuantize", p._network_precision, &fake_quantize_params1,
+            {{p.inputDimensions[0], constDimensions, constDimensions, constDimensions, constDimensions}, {{p.inputDimensions[0]}}})
+        .addLayer("Const", p._network_precision, &const_params, {{}, {{1}}}, type_size, 0)
+        .addLayer("Const", p._network_precision, &const_params, {{}, {{1}}}, type_size, 0)
+        .addLayer("Const", p._network_precision, &const_params, {{}, {{1}}}, type_size, 0)
+        .addLayer("Const", p._network_precision, &const_params, {{}, {{1}}}, type_size, 0)
+        .addLayer("FakeQuantize", p._network_precision, &fake_quantize_params2, {{p.inputDimensions[1], {1}, {1}, {1}, {1}}, {{p.inputDimensions[1]}}})
+        .addLayer("GEMM", p._network_precision, &gemm_params, {{p.inputDimensions[0], p.inputDimensions[1]}, {p.outputDimensions[0]}}, "gemm")
+        .finish(&edges);
+}
+
+std::string GemmTestModel::getName() const {
+    return std::string("GemmTestModel") +
+        (signedIntervals ? "_signedInterval" : "_notsignedInterval") +
+        (perChannel ? "_perChannel" : "") +
+        (zeroPoint ? "_zeroPoint" : "") +
+        (shiftsOnSecondInput ? "_shiftsOnSecondInput" : "") +
+        (narrowedSecondInput ? "_narrowedSecondInput" : "");
+}
+
+bool GemmTestModel::transform(CNNNetwork& network, LayerTransformation::Params& params) const {
+    // integer GEMM is executed on quantized tensors only
+    params.updatePrecisions = true;
+    // signed asymmetric interval on the second input gets I8 with shifts
+    params.precisionsOnActivations = shiftsOnSecondInput ?
+        std::vector<Precision>({ Precision::I8, Precision::U8 }) :
+        std::vector<Precision>({ Precision::U8, Precision::I8 });
+
+    LowPrecisionTransformations transformations = getLowPrecisionTransformations(params);
+    if (narrowedSecondInput) {
+        transformations = transformations.
+            removeTransformations("GEMM").
+            add<GemmWithNarrowedSecondInputTransformation>(params, "GEMM");
+    }
+
+    LowPrecisionTransformer transformer(transformations);
+    transformer.transform(network);
+
+    if (!params.quantizeOutputs) {
+        return true;
+    }
+
+    // the layer is renamed if dequantization is moved after it
+    const CNNLayerPtr output = getLayer(network, "gemm");
+    if (shiftsOnSecondInput) {
+        if (output->type != "GEMM") {
+            THROW_IE_EXCEPTION << "layer " << output->type << " " << output->name << " was quantized with shifts on the second input";
+        }
+
+        const CNNLayerPtr scaleShift = CNNNetworkHelper::getParent(*output, 1);
+        if ((scaleShift == nullptr) || (scaleShift->type != "ScaleShift")) {
+            THROW_IE_EXCEPTION << "dequantization of the second input was removed";
+        }
+        return true;
+    }
+
+    if (output->type != "ScaleShift") {
+        THROW_IE_EXCEPTION << "layer " << output->type << " " << output->name << " was not quantized";
+    }
+
+    const CNNLayerPtr gemm = CNNNetworkHelper::getParent(*output, 0);
+    if ((gemm == nullptr) || (gemm->type != "GEMM")) {
+        THROW_IE_EXCEPTION << "dequantization is not after GEMM";
+    }
+
+    CNNLayerPtr fakeQuantize1 = CNNNetworkHelper::getParent(*gemm, 0);
+    if (zeroPoint) {
+        if ((fakeQuantize1->type != "Eltwise") || (fakeQuantize1->GetParamAsString("operation") != "sub")) {
+            THROW_IE_EXCEPTION << "zero point is not subtracted by Eltwise, layer " << fakeQuantize1->type << " " << fakeQuantize1->name;
+        }
+        fakeQuantize1 = CNNNetworkHelper::getParent(*fakeQuantize1, 0);
+    }
+    if (fakeQuantize1->type != "FakeQuantize") {
+        THROW_IE_EXCEPTION << "unexpected layer " << fakeQuantize1->type << " " << fakeQuantize1->name << " on the first input";
+    }
+
+    const Precision expectedPrecision = signedIntervals ? Precision::I8 : Precision::U8;
+    if (fakeQuantize1->outData[0]->getPrecision() != expectedPrecision) {
+        THROW_IE_EXCEPTION << "unexpected precision " << fakeQuantize1->outData[0]->getPrecision() << " for " << fakeQuantize1->type << " " << fakeQuantize1->name;
+    }
+
+    const CNNLayerPtr fakeQuantize2 = CNNNetworkHelper::getParent(*gemm, 1);
+    if (fakeQuantize2->type != "FakeQuantize") {
+        THROW_IE_EXCEPTION << "unexpected layer " << fakeQuantize2->type << " " << fakeQuantize2->name << " on the second input";
+    }
+    if (fakeQuantize2->outData[0]->getPrecision() != Precision::I8) {
+        THROW_IE_EXCEPTION << "unexpected precision " << fakeQuantize2->outData[0]->getPrecision() << " for " << fakeQuantize2->type << " " << fakeQuantize2->name;
+    }
+
+    // the second input is limited to 7 bits
+    const QuantizationDetails quantizationDetails = QuantizationDetails::getDetails(*fakeQuantize2);
+    if ((quantizationDetails.levels != 127ul) || (quantizationDetails.minOutputLow() != -63.f) || (quantizationDetails.maxOutputHigh() != 63.f)) {
+        THROW_IE_EXCEPTION << "the second input is not requantized to 7 bits: " << quantizationDetails;
+    }
+
+    const std::shared_ptr<float> scales = CNNNetworkHelper::getFloatData(CNNNetworkHelper::getBlob(output, "weights"));
+    const size_t channelsCount = CNNNetworkHelper::getOutputChannelsCount(*gemm);
+    const bool perChannelScales = !std::all_of(
+        scales.get(),
+        scales.get() + channelsCount,
+        [&](const float value) { return value == scales.get()[0]; });
+    if (perChannel != perChannelScales) {
+        THROW_IE_EXCEPTION << "unexpected dequantization scales of " << output->type << " " << output->name;
+    }
+
+    return true;
+}
+
+void GemmTestModel::resetTransformation(CNNNetwork& network) const {
+    // values of the inputs are 4, they are quantized without errors
+    const size_t channelsCount = getBlob(getLayer(network, "Const2"), "custom")->size();
+    std::vector<float> low(channelsCount);
+    std::vector<float> high(channelsCount);
+    for (size_t channel = 0; channel < channelsCount; ++channel) {
+        const float scale = perChannel ? static_cast<float>(1 << (channel % 3)) : 1.f;
+        low[channel] = (zeroPoint ? -1.02f : (signedIntervals ? -5.12f : 0.f)) * scale;
+        high[channel] = (zeroPoint ? 4.08f : (signedIntervals ? 5.08f : 5.1f)) * scale;
+    }
+
+    fillData(getLayer(network, "Const2"), low, "custom");
+    fillData(getLayer(network, "Const3"), high, "custom");
+    fillData(getLayer(network, "Const4"), low, "custom");
+    fillData(getLayer(network, "Const5"), high, "custom");
+
+    fillData(getLayer(network, "Const7"), shiftsOnSecondInput ? -2.f : -4.f, "custom");
+    fillData(getLayer(network, "Const8"), 4.f, "custom");
+    fillData(getLayer(network, "Const9"), shiftsOnSecondInput ? -2.f : -4.f, "custom");
+    fillData(getLayer(network, "Const10"), 4.f, "custom");
+}
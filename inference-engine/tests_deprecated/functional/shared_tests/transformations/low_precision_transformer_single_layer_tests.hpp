@@ -1089,6 +1089,34 @@ private:
     const size_t minLevels;
 };
 
+class GemmTestModel : public SingleLayerTestModel {
+public:
+    GemmTestModel(
+        const bool signedIntervals,
+        const bool perChannel = false,
+        const bool zeroPoint = false,
+        const bool shiftsOnSecondInput = false,
+        const bool narrowedSecondInput = false) :
+        SingleLayerTestModel(),
+        signedIntervals(signedIntervals),
+        perChannel(perChannel),
+        zeroPoint(zeroPoint),
+        shiftsOnSecondInput(shiftsOnSecondInput),
+        narrowedSecondInput(narrowedSecondInput) {}
+
+    std::string getModel(SingleLayerTransformationsTestParams& p) const override;
+    std::string getName() const override;
+    bool transform(CNNNetwork& network, LayerTransformation::Params& params) const override;
+    void resetTransformation(CNNNetwork& network) const override;
+
+private:
+    const bool signedIntervals;
+    const bool perChannel;
+    const bool zeroPoint;
+    const bool shiftsOnSecondInput;
+    const bool narrowedSecondInput;
+};
+
 class EltwiseBroadcastTestModel : public SingleLayerTestModel {
 public:
     std::string getModel(SingleLayerTransformationsTestParams& p) const override;
@@ -4,6 +4,9 @@
 
 #include "test_graph.hpp"
 
+#include <functional>
+#include <numeric>
+
 #include "single_layer_common.hpp"
 #include "tests_common.hpp"
 #include <ie_core.hpp>
@@ -659,3 +662,301 @@ INSTANTIATE_TEST_CASE_P(
                 gemm_test_params{{1, 3, 1, 3, 1, 1, 1, 3}, 7, 4, 3, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
                 gemm_test_params{{1, 3, 1, 1, 1, 1, 1, 3}, 7, 4, 3, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any}
         ));
+
+struct int8_gemm_test_params {
+    // leading dimensions of all tensors: {MB, C} for 4D, {MB} for 3D and empty for 2D tensors
+    InferenceEngine::SizeVector batches;
+
+    size_t M;
+    size_t N;
+    size_t K;
+
+    float alpha;
+
+    bool transposeA;
+    bool transposeB;
+
+    InferenceEngine::Precision precisionA;
+
+    // if not empty, the first input is U8 data minus these zero points: one value or one per channel of 4D input
+    std::vector<uint8_t> zeroPoints;
+};
+
+class MKLDNNGraphInt8GemmTests: public TestsCommon,
+                                public WithParamInterface<int8_gemm_test_params> {
+    std::string model_t = R"V0G0N(
+<net name="gemmInt8" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="_PA_" id="1">
+            <output>
+                <port id="1">__DIMS_A__</port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="I8" id="2">
+            <output>
+                <port id="1">__DIMS_B__</port>
+            </output>
+        </layer>
+        <layer name="gemm" id="3" type="GEMM" precision="FP32">
+            <data alpha="_A_" beta="0" transpose_a="_TA_" transpose_b="_TB_"/>
+            <input>
+                <port id="1">__DIMS_A__</port>
+                <port id="2">__DIMS_B__</port>
+            </input>
+            <output>
+                <port id="3">__DIMS_OUT__</port>
+            </output>
+        </layer>
+        <layer name="dequantize" id="4" type="ScaleShift" precision="FP32">
+            <weights offset="0" size="_S_"/>
+            <biases offset="_S_" size="_S_"/>
+            <input>
+                <port id="1">__DIMS_OUT__</port>
+            </input>
+            <output>
+                <port id="2">__DIMS_OUT__</port>
+            </output>
+        </layer>__ZERO_POINT_LAYERS__
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="__GEMM_INPUT__" to-port="1"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="4" to-port="1"/>__ZERO_POINT_EDGES__
+    </edges>
+</net>
+)V0G0N";
+
+    std::string zero_point_layers_t = R"V0G0N(
+        <layer name="zero_points" type="Const" precision="U8" id="5">
+            <output>
+                <port id="1">__DIMS_ZP__</port>
+            </output>
+            <blobs>
+                <custom offset="_ZPO_" size="_ZPS_"/>
+            </blobs>
+        </layer>
+        <layer name="sub" id="6" type="Eltwise" precision="FP32">
+            <data operation="sub"/>
+            <input>
+                <port id="1">__DIMS_A__</port>
+                <port id="2">__DIMS_ZP__</port>
+            </input>
+            <output>
+                <port id="3">__DIMS_A__</port>
+            </output>
+        </layer>)V0G0N";
+
+    std::string zero_point_edges_t = R"V0G0N(
+        <edge from-layer="5" from-port="1" to-layer="6" to-port="2"/>
+        <edge from-layer="6" from-port="3" to-layer="3" to-port="1"/>)V0G0N";
+
+protected:
+    static InferenceEngine::SizeVector withMatrix(const InferenceEngine::SizeVector &batches, size_t rows, size_t columns) {
+        InferenceEngine::SizeVector dims = batches;
+        dims.push_back(rows);
+        dims.push_back(columns);
+        return dims;
+    }
+
+    static std::string irDims(const InferenceEngine::SizeVector &dims) {
+        std::string result;
+        for (auto dim : dims)
+            result += "<dim>" + std::to_string(dim) + "</dim>";
+        return result;
+    }
+
+    static InferenceEngine::SizeVector dimsA(const int8_gemm_test_params &p) {
+        return withMatrix(p.batches, p.transposeA ? p.K : p.M, p.transposeA ? p.M : p.K);
+    }
+
+    static InferenceEngine::SizeVector dimsB(const int8_gemm_test_params &p) {
+        return withMatrix(p.batches, p.transposeB ? p.N : p.K, p.transposeB ? p.K : p.N);
+    }
+
+    // the dequantization channel is a batch dimension for 4D, a row for 3D and a column for 2D outputs
+    static size_t channels(const int8_gemm_test_params &p) {
+        return p.batches.size() == 2 ? p.batches[1] : p.batches.size() == 1 ? p.M : p.N;
+    }
+
+    // zero points are given by the second dimension of the first input as the low precision transformations do
+    static std::vector<uint8_t> zeroPointsData(const int8_gemm_test_params &p) {
+        if (p.zeroPoints.size() != 1)
+            return p.zeroPoints;
+        return std::vector<uint8_t>(dimsA(p)[1], p.zeroPoints[0]);
+    }
+
+    std::string getModel(int8_gemm_test_params p) {
+        std::string model = model_t;
+
+        auto zeroPoints = zeroPointsData(p);
+        if (!zeroPoints.empty()) {
+            InferenceEngine::SizeVector dimsZP(dimsA(p).size(), 1);
+            dimsZP[1] = zeroPoints.size();
+
+            REPLACE_WITH_STR(model, "__ZERO_POINT_LAYERS__", zero_point_layers_t);
+            REPLACE_WITH_STR(model, "__ZERO_POINT_EDGES__", zero_point_edges_t);
+            REPLACE_WITH_STR(model, "__DIMS_ZP__", irDims(dimsZP));
+            REPLACE_WITH_NUM(model, "_ZPO_", 2 * channels(p) * sizeof(float));
+            REPLACE_WITH_NUM(model, "_ZPS_", zeroPoints.size());
+            REPLACE_WITH_NUM(model, "__GEMM_INPUT__", 6);
+        } else {
+            REPLACE_WITH_STR(model, "__ZERO_POINT_LAYERS__", "");
+            REPLACE_WITH_STR(model, "__ZERO_POINT_EDGES__", "");
+            REPLACE_WITH_NUM(model, "__GEMM_INPUT__", 3);
+        }
+
+        REPLACE_WITH_STR(model, "_PA_", p.precisionA.name());
+        REPLACE_WITH_STR(model, "__DIMS_A__", irDims(dimsA(p)));
+        REPLACE_WITH_STR(model, "__DIMS_B__", irDims(dimsB(p)));
+        REPLACE_WITH_STR(model, "__DIMS_OUT__", irDims(withMatrix(p.batches, p.M, p.N)));
+
+        REPLACE_WITH_NUM(model, "_A_", p.alpha);
+        REPLACE_WITH_NUM(model, "_TA_", p.transposeA);
+        REPLACE_WITH_NUM(model, "_TB_", p.transposeB);
+        REPLACE_WITH_NUM(model, "_S_", channels(p) * sizeof(float));
+
+        return model;
+    }
+
+    template <typename T>
+    static InferenceEngine::Blob::Ptr makeInput(InferenceEngine::Precision precision, const InferenceEngine::SizeVector &dims,
+                                                int range, int base) {
+        InferenceEngine::Blob::Ptr blob = InferenceEngine::make_shared_blob<T>(
+                {precision, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims)});
+        blob->allocate();
+        T *data = blob->buffer().as<T*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            data[i] = static_cast<T>(static_cast<int>((i * 37) % range) + base);
+        return blob;
+    }
+
+    template <typename T>
+    static float valueAt(const InferenceEngine::Blob::Ptr &blob, size_t i) {
+        return static_cast<float>(blob->cbuffer().as<const T*>()[i]);
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            int8_gemm_test_params p = ::testing::WithParamInterface<int8_gemm_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            const size_t C = channels(p);
+            const auto zeroPoints = zeroPointsData(p);
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8,
+                {2 * C * sizeof(float) + zeroPoints.size()}, InferenceEngine::C });
+            weights->allocate();
+            float *scales = weights->data().as<float*>();
+            float *shifts = scales + C;
+            for (size_t c = 0; c < C; c++) {
+                scales[c] = 0.01f * (c + 1);
+                shifts[c] = 0.5f * c - 1.f;
+            }
+            std::copy(zeroPoints.begin(), zeroPoints.end(), reinterpret_cast<uint8_t*>(shifts + C));
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            InferenceEngine::Core core;
+            InferenceEngine::CNNNetwork network;
+            ASSERT_NO_THROW(network = core.ReadNetwork(model, weights_ptr));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+
+            // zero points and dequantization are fused into the gemm which reads quantized inputs directly
+            size_t gemmCount = 0;
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE(MKLDNNPlugin::Depthwise, node->getType());
+                ASSERT_NE(MKLDNNPlugin::Eltwise, node->getType());
+                if (node->getType() == MKLDNNPlugin::Gemm) {
+                    gemmCount++;
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    auto &config = node->getSelectedPrimitiveDescriptor()->getConfig();
+                    ASSERT_EQ(p.precisionA, config.inConfs.at(0).desc.getPrecision());
+                    ASSERT_EQ(InferenceEngine::Precision::I8, config.inConfs.at(1).desc.getPrecision());
+                    ASSERT_EQ(InferenceEngine::Precision::FP32, config.outConfs.at(0).desc.getPrecision());
+                }
+            }
+            ASSERT_EQ(1, gemmCount);
+
+            // the second input is limited to 7 bits as the low precision transformations do,
+            // so pairs of products do not saturate s16 sums of non-VNNI int8 gemm
+            bool isU8 = p.precisionA == InferenceEngine::Precision::U8;
+            InferenceEngine::Blob::Ptr src1 = isU8 ? makeInput<uint8_t>(p.precisionA, dimsA(p), 256, 0) :
+                                                     makeInput<int8_t>(p.precisionA, dimsA(p), 256, -128);
+            InferenceEngine::Blob::Ptr src2 = makeInput<int8_t>(InferenceEngine::Precision::I8, dimsB(p), 127, -63);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src1));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", src2));
+
+            InferenceEngine::OutputsDataMap out;
+            out = network.getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            float *dst_data = dst_ref.data();
+
+            size_t matrices = std::accumulate(p.batches.begin(), p.batches.end(), size_t(1), std::multiplies<size_t>());
+            for (size_t b = 0; b < matrices; b++) {
+                size_t a_off = b * p.M * p.K;
+                size_t b_off = b * p.K * p.N;
+                float zp = zeroPoints.empty() ? 0.f : zeroPoints.size() == 1 ? zeroPoints[0] :
+                           p.batches.size() == 2 ? zeroPoints[b % p.batches[1]] : zeroPoints[0];
+                for (size_t i = 0; i < p.M; i++) {
+                    for (size_t j = 0; j < p.N; j++) {
+                        float acc = 0.f;
+                        for (size_t k = 0; k < p.K; k++) {
+                            size_t src0_off = a_off + (p.transposeA ? k * p.M + i : i * p.K + k);
+                            size_t src1_off = b_off + (p.transposeB ? j * p.K + k : k * p.N + j);
+                            float a = isU8 ? valueAt<uint8_t>(src1, src0_off) : valueAt<int8_t>(src1, src0_off);
+                            acc += (a - zp) * valueAt<int8_t>(src2, src1_off);
+                        }
+                        size_t c = p.batches.size() == 2 ? b % p.batches[1] : p.batches.size() == 1 ? i : j;
+                        dst_data[(b * p.M + i) * p.N + j] = p.alpha * acc * scales[c] + shifts[c];
+                    }
+                }
+            }
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphInt8GemmTests, TestsGemm) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsGemm, MKLDNNGraphInt8GemmTests,
+        ::testing::Values(
+                int8_gemm_test_params{{1, 1}, 7, 4, 3, 1, false, false, InferenceEngine::Precision::U8},
+                int8_gemm_test_params{{2, 3}, 16, 10, 12, 1, false, false, InferenceEngine::Precision::U8},
+                int8_gemm_test_params{{2, 3}, 16, 10, 12, 0.5f, true, false, InferenceEngine::Precision::U8},
+                int8_gemm_test_params{{2, 3}, 16, 10, 12, 1, false, true, InferenceEngine::Precision::U8},
+                int8_gemm_test_params{{1, 4}, 11, 10, 64, 0.125f, true, true, InferenceEngine::Precision::U8},
+                int8_gemm_test_params{{2, 3}, 16, 10, 12, 1, false, false, InferenceEngine::Precision::I8},
+                int8_gemm_test_params{{1, 4}, 11, 10, 64, 0.125f, false, true, InferenceEngine::Precision::I8},
+                // 3D: dequantization by rows
+                int8_gemm_test_params{{2}, 16, 10, 12, 1, false, false, InferenceEngine::Precision::U8},
+                int8_gemm_test_params{{3}, 5, 9, 33, 0.5f, true, true, InferenceEngine::Precision::I8},
+                // 2D: dequantization by columns
+                int8_gemm_test_params{{}, 16, 10, 12, 1, false, false, InferenceEngine::Precision::U8},
+                int8_gemm_test_params{{}, 7, 13, 20, 1, false, true, InferenceEngine::Precision::I8},
+                // zero points
+                int8_gemm_test_params{{2, 3}, 16, 10, 12, 1, false, false, InferenceEngine::Precision::U8, {128}},
+                int8_gemm_test_params{{2, 3}, 16, 10, 12, 1, true, true, InferenceEngine::Precision::U8, {10, 128, 255}},
+                int8_gemm_test_params{{}, 16, 10, 12, 0.5f, false, true, InferenceEngine::Precision::U8, {64}}
+        ));
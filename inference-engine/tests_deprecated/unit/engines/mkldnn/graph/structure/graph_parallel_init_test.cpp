@@ -0,0 +1,238 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "../test_graph.hpp"
+
+#include "tests_common.hpp"
+#include <ie_core.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+namespace {
+
+// runs func with one thread, so the nodes are initialized one by one in the graph order
+template <typename F>
+void runSerially(const F &func) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    tbb::task_arena(1).execute(func);
+#elif IE_THREAD == IE_THREAD_OMP
+    const int threads = parallel_get_max_threads();
+    omp_set_num_threads(1);
+    func();
+    omp_set_num_threads(threads);
+#else
+    func();
+#endif
+}
+
+}  // namespace
+
+class MKLDNNGraphParallelInitTests: public TestsCommon {};
+
+TEST_F(MKLDNNGraphParallelInitTests, SelectsSameDescriptorsAsSerialInit) {
+    // Concat chooses its layout by the choice of its parents, so the order of the selection matters here
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>7</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1_1_conv" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="2" stride-y="2" pad-x="3" pad-y="3" kernel-x="7" kernel-y="7" output="4" group="1"/>
+            <input>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>7</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="0" size="2352"/>
+            <biases offset="2352" size="16"/>
+        </layer>
+        <layer name="conv1_1_neg" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="-1" shift="0"/>
+            <input>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1_1_concat" type="Concat" precision="FP32" id="4">
+            <concat_data axis="1"/>
+            <input>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1_1_scale" type="ScaleShift" precision="FP32" id="5">
+            <input>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="2368" size="32"/>
+            <biases offset="2400" size="32"/>
+        </layer>
+        <layer name="conv1_1_relu" type="ReLU" precision="FP32" id="6">
+            <input>
+                <port id="11">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="12">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="2"/>
+        <edge from-layer="2" from-port="3" to-layer="3" to-port="4"/>
+        <edge from-layer="2" from-port="3" to-layer="4" to-port="6"/>
+        <edge from-layer="3" from-port="5" to-layer="4" to-port="7"/>
+        <edge from-layer="4" from-port="8" to-layer="5" to-port="9"/>
+        <edge from-layer="5" from-port="10" to-layer="6" to-port="11"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::TBlob<uint8_t>::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>(
+            { InferenceEngine::Precision::U8, {2432}, InferenceEngine::C });
+    weights->allocate();
+    fill_data(weights->buffer().as<float *>(), weights->size() / sizeof(float));
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, weights));
+
+    MKLDNNGraphTestClass parallelGraph;
+    ASSERT_NO_THROW(parallelGraph.CreateGraph(network));
+    MKLDNNGraphTestClass serialGraph;
+    runSerially([&] {
+        ASSERT_NO_THROW(serialGraph.CreateGraph(network));
+    });
+
+    auto& parallelNodes = parallelGraph.getNodes();
+    auto& serialNodes = serialGraph.getNodes();
+    ASSERT_EQ(serialNodes.size(), parallelNodes.size());
+    for (size_t i = 0; i < serialNodes.size(); i++) {
+        auto& serial = serialNodes[i];
+        auto& parallel = parallelNodes[i];
+        ASSERT_EQ(serial->getName(), parallel->getName());
+        ASSERT_EQ(serial->getSupportedPrimitiveDescriptors().size(),
+                  parallel->getSupportedPrimitiveDescriptors().size()) << serial->getName();
+        ASSERT_NE(nullptr, serial->getSelectedPrimitiveDescriptor()) << serial->getName();
+        ASSERT_NE(nullptr, parallel->getSelectedPrimitiveDescriptor()) << serial->getName();
+        EXPECT_EQ(serial->getSelectedPrimitiveDescriptor()->getImplementationType(),
+                  parallel->getSelectedPrimitiveDescriptor()->getImplementationType()) << serial->getName();
+
+        auto serialConfig = serial->getSelectedPrimitiveDescriptor()->getConfig();
+        auto parallelConfig = parallel->getSelectedPrimitiveDescriptor()->getConfig();
+        ASSERT_EQ(serialConfig.inConfs.size(), parallelConfig.inConfs.size()) << serial->getName();
+        for (size_t j = 0; j < serialConfig.inConfs.size(); j++) {
+            EXPECT_EQ(serialConfig.inConfs[j].desc, parallelConfig.inConfs[j].desc) << serial->getName();
+            EXPECT_EQ(serialConfig.inConfs[j].inPlace, parallelConfig.inConfs[j].inPlace) << serial->getName();
+        }
+        ASSERT_EQ(serialConfig.outConfs.size(), parallelConfig.outConfs.size()) << serial->getName();
+        for (size_t j = 0; j < serialConfig.outConfs.size(); j++) {
+            EXPECT_EQ(serialConfig.outConfs[j].desc, parallelConfig.outConfs[j].desc) << serial->getName();
+            EXPECT_EQ(serialConfig.outConfs[j].inPlace, parallelConfig.outConfs[j].inPlace) << serial->getName();
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphParallelInitTests, RethrowsErrorOfFirstFailedNode) {
+    std::vector<int> nodes(256);
+    std::iota(nodes.begin(), nodes.end(), 0);
+    for (int repeat = 0; repeat < 10; repeat++) {
+        std::atomic<size_t> visited{0};
+        try {
+            MKLDNNPlugin::parallelForNodes(nodes, [&](int node) {
+                visited++;
+                if (node % 64 == 17) {
+                    // the first failed node in the graph order is the last one to throw
+                    if (node == 17)
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    throw std::runtime_error(std::to_string(node));
+                }
+            });
+            FAIL() << "The error is not rethrown";
+        } catch (const std::runtime_error &error) {
+            EXPECT_STREQ("17", error.what());
+        }
+        // the other nodes are processed anyway
+        EXPECT_EQ(nodes.size(), visited);
+    }
+}
@@ -63,6 +63,7 @@ public:
         SEARCH_TYPE(jit);
         SEARCH_TYPE(gemm);
         SEARCH_TYPE(ref);
+        SEARCH_TYPE(sparse);
 
         SEARCH_TYPE(avx512);
         SEARCH_TYPE(avx2);
@@ -0,0 +1,157 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <net_pass.h>
+#include <ie_layers.h>
+#include <details/ie_exception.hpp>
+#include "util_test.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+TensorDesc desc(Precision precision) {
+    return {precision, {1, 4}, Layout::NC};
+}
+
+template <typename T>
+Blob::Ptr makeBlob(Precision precision, const std::vector<T>& values) {
+    auto blob = make_shared_blob<T>({precision, {values.size()}, Layout::C});
+    blob->allocate();
+    std::copy(values.begin(), values.end(), blob->buffer().template as<T*>());
+    return blob;
+}
+
+template <typename T>
+std::vector<T> values(const Blob::Ptr& blob) {
+    auto data = blob->cbuffer().as<const T*>();
+    return {data, data + blob->size()};
+}
+
+CNNLayerPtr layer(const details::CNNNetworkImplPtr& net, const std::string& name) {
+    CNNLayerPtr result;
+    net->getLayerByName(name.c_str(), result, nullptr);
+    return result;
+}
+
+}  // namespace
+
+TEST(NetPassConvertPrecisionTests, ConvertsSeveralPrecisionsInOnePass) {
+    // i64 -> L1 -> u64 -> L2 -> fp32
+    auto net = NetBuilder()
+               .data("i64", desc(Precision::I64))
+               .data("u64", desc(Precision::U64))
+               .data("fp32", desc(Precision::FP32))
+               .layer<CNNLayer>(LayerParams{"L1", "dummy", Precision::I64})
+               .layer<CNNLayer>(LayerParams{"L2", "dummy", Precision::U64})
+               .linkData("i64", "u64", "L1")
+               .linkData("u64", "fp32", "L2")
+               .finalize();
+
+    NetPass::ConvertPrecision(*net, {{Precision::I64, Precision::I32}, {Precision::U64, Precision::I32}});
+
+    EXPECT_EQ(Precision::I32, net->getData("i64")->getPrecision());
+    EXPECT_EQ(Precision::I32, net->getData("u64")->getPrecision());
+    EXPECT_EQ(Precision::FP32, net->getData("fp32")->getPrecision());
+    EXPECT_EQ(Precision::I32, layer(net, "L1")->precision);
+    EXPECT_EQ(Precision::I32, layer(net, "L2")->precision);
+}
+
+TEST(NetPassConvertPrecisionTests, DoesNotChainConversions) {
+    // bool -> L1 -> u8
+    auto net = NetBuilder()
+               .data("bool", desc(Precision::BOOL))
+               .data("u8", desc(Precision::U8))
+               .layer<CNNLayer>(LayerParams{"L1", "dummy", Precision::BOOL})
+               .linkData("bool", "u8", "L1")
+               .finalize();
+    layer(net, "L1")->blobs["custom"] = makeBlob<uint8_t>(Precision::BOOL, {0, 1, 1, 0});
+
+    NetPass::ConvertPrecision(*net, {{Precision::BOOL, Precision::U8}, {Precision::U8, Precision::I32}});
+
+    // the bool tensor becomes u8 and is not converted again to i32
+    EXPECT_EQ(Precision::U8, net->getData("bool")->getPrecision());
+    EXPECT_EQ(Precision::I32, net->getData("u8")->getPrecision());
+    EXPECT_EQ(Precision::U8, layer(net, "L1")->precision);
+    auto blob = layer(net, "L1")->blobs["custom"];
+    EXPECT_EQ(Precision::U8, blob->getTensorDesc().getPrecision());
+    EXPECT_EQ((std::vector<uint8_t>{0, 1, 1, 0}), values<uint8_t>(blob));
+}
+
+TEST(NetPassConvertPrecisionTests, ThrowsIfPrecisionIsConvertedTwice) {
+    auto net = NetBuilder()
+               .data("i64", desc(Precision::I64))
+               .data("out", desc(Precision::I64))
+               .layer<CNNLayer>(LayerParams{"L1", "dummy", Precision::I64})
+               .linkData("i64", "out", "L1")
+               .finalize();
+
+    EXPECT_THROW(NetPass::ConvertPrecision(*net, {{Precision::I64, Precision::I32}, {Precision::I64, Precision::U8}}),
+                 details::InferenceEngineException);
+}
+
+TEST(NetPassConvertPrecisionTests, ConvertsSharedBlobOnce) {
+    // in -> FC -> mid -> Const user -> out, the weights of FC are its blob as well, the second layer shares them
+    auto net = NetBuilder()
+               .data("in", desc(Precision::FP32))
+               .data("mid", desc(Precision::FP32))
+               .data("out", desc(Precision::FP32))
+               .layer<FullyConnectedLayer>(LayerParams{"FC", "FullyConnected", Precision::FP32})
+               .layer<CNNLayer>(LayerParams{"User", "dummy", Precision::FP32})
+               .linkData("in", "mid", "FC")
+               .linkData("mid", "out", "User")
+               .finalize();
+    auto shared = makeBlob<int64_t>(Precision::I64, {-1, 2, 1ll << 40, 4});
+    auto fc = std::dynamic_pointer_cast<FullyConnectedLayer>(layer(net, "FC"));
+    fc->_weights = shared;
+    fc->blobs["weights"] = shared;
+    layer(net, "User")->blobs["custom"] = shared;
+
+    NetPass::ConvertPrecision(*net, {{Precision::I64, Precision::I32}, {Precision::U64, Precision::I32}});
+
+    auto converted = fc->_weights;
+    ASSERT_NE(shared, converted);
+    EXPECT_EQ(Precision::I32, converted->getTensorDesc().getPrecision());
+    EXPECT_EQ((std::vector<int32_t>{-1, 2, static_cast<int32_t>(1ll << 40), 4}), values<int32_t>(converted));
+    // all references get the same converted blob
+    EXPECT_EQ(converted, fc->blobs["weights"]);
+    EXPECT_EQ(converted, layer(net, "User")->blobs["custom"]);
+    // the original blob is not modified
+    EXPECT_EQ(Precision::I64, shared->getTensorDesc().getPrecision());
+}
+
+TEST(NetPassConvertPrecisionTests, FixesConvertLayers) {
+    // i64 -> ConvertToU64 -> u64 -> ConvertToFP32 -> fp32 -> L -> out
+    auto net = NetBuilder()
+               .data("i64", desc(Precision::I64))
+               .data("u64", desc(Precision::U64))
+               .data("fp32", desc(Precision::FP32))
+               .data("out", desc(Precision::FP32))
+               .layer<CNNLayer>(LayerParams{"ConvertToU64", "Convert", Precision::U64})
+               .layer<CNNLayer>(LayerParams{"ConvertToFP32", "Convert", Precision::FP32})
+               .layer<CNNLayer>(LayerParams{"L", "dummy", Precision::FP32})
+               .linkData("i64", "u64", "ConvertToU64")
+               .linkData("u64", "fp32", "ConvertToFP32")
+               .linkData("fp32", "out", "L")
+               .finalize();
+    layer(net, "ConvertToU64")->params["precision"] = "U64";
+    layer(net, "ConvertToFP32")->params["precision"] = "FP32";
+
+    NetPass::ConvertPrecision(*net, {{Precision::I64, Precision::I32}, {Precision::U64, Precision::I32}});
+
+    // the first Convert does nothing after the conversion and is removed, the second one converts from i32 now
+    auto input = net->getData("i64");
+    EXPECT_EQ(Precision::I32, input->getPrecision());
+    ASSERT_EQ(1, input->getInputTo().size());
+    auto convert = input->getInputTo().begin()->second;
+    EXPECT_EQ("ConvertToFP32", convert->name);
+    EXPECT_EQ("FP32", convert->params["precision"]);
+    EXPECT_EQ(Precision::FP32, convert->outData[0]->getPrecision());
+}
@@ -52,6 +52,8 @@ static constexpr char iop_message[] = "Optional. Specifies precision for input a
 
 static constexpr char dla_arch_name[] = "Optional. Specify architecture name used to compile executable network for FPGA device.";
 
+static constexpr char load_phases_message[] = "Optional. Print durations of the phases of LoadNetwork if the device supports it.";
+
 DEFINE_bool(h, false, help_message);
 DEFINE_string(m, "", model_message);
 DEFINE_string(d, "", targetDeviceMessage);
@@ -60,6 +62,7 @@ DEFINE_string(c, "config", config_message);
 DEFINE_string(ip, "", inputs_precision_message);
 DEFINE_string(op, "", outputs_precision_message);
 DEFINE_string(iop, "", iop_message);
+DEFINE_bool(load_phases, false, load_phases_message);
 DEFINE_string(VPU_MYRIAD_PLATFORM, "", platform_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
@@ -77,6 +80,7 @@ static void showUsage() {
     std::cout << "    -ip                          <value>     "   << inputs_precision_message     << std::endl;
     std::cout << "    -op                          <value>     "   << outputs_precision_message    << std::endl;
     std::cout << "    -iop                        \"<value>\"    " << iop_message                  << std::endl;
+    std::cout << "    -load_phases                             "   << load_phases_message          << std::endl;
     std::cout << "                                             "                                   << std::endl;
     std::cout << "    VPU options:                             "                                   << std::endl;
     std::cout << "      -VPU_MYRIAD_PLATFORM       <value>     "   << platform_message             << std::endl;
@@ -324,6 +328,19 @@ std::string getFileNameFromPath(const std::string& path,
     }
 }
 
+static void printLoadNetworkPhases(InferenceEngine::ExecutableNetwork& executableNetwork) {
+    std::vector<std::string> supportedMetrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    if (std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(COMPILE_PHASES)) == supportedMetrics.end()) {
+        std::cout << "Durations of LoadNetwork phases are not supported by the device" << std::endl;
+        return;
+    }
+    std::map<std::string, float> phases = executableNetwork.GetMetric(METRIC_KEY(COMPILE_PHASES));
+    std::cout << "LoadNetwork phases:" << std::endl;
+    for (auto&& phase : phases) {
+        std::cout << "    " << phase.first << ": " << phase.second << " ms" << std::endl;
+    }
+}
+
 using TimeDiff = std::chrono::milliseconds;
 
 int main(int argc, char *argv[]) {
@@ -346,6 +363,10 @@ int main(int argc, char *argv[]) {
         auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure(FLAGS_c, FLAGS_m));
         loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
 
+        if (FLAGS_load_phases) {
+            printLoadNetworkPhases(executableNetwork);
+        }
+
         std::string outputName = FLAGS_o;
         if (outputName.empty()) {
             outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
@@ -0,0 +1,728 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/binary_serializer.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/factory.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    constexpr char format_magic[4] = {'N', 'G', 'B', 'F'};
+    constexpr uint32_t format_version = 1;
+    constexpr uint64_t data_alignment = 64;
+
+    enum class AttributeKind : uint8_t
+    {
+        Bool,
+        Int,
+        UInt,
+        Real,
+        String,
+        IntVector,
+        UIntVector,
+        RealVector,
+        StringVector,
+        Data
+    };
+
+    struct Header
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t table_size;
+        uint64_t data_offset;
+        uint64_t data_size;
+    };
+
+    uint64_t align(uint64_t offset)
+    {
+        return (offset + data_alignment - 1) / data_alignment * data_alignment;
+    }
+
+    class Writer
+    {
+    public:
+        template <typename T>
+        void write(const T& value)
+        {
+            static_assert(is_arithmetic<T>::value || is_enum<T>::value, "Only scalars are written");
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void write(const string& value)
+        {
+            write<uint64_t>(value.size());
+            m_buffer.insert(m_buffer.end(), value.begin(), value.end());
+        }
+
+        template <typename T>
+        void write_vector(const vector<T>& values)
+        {
+            write<uint64_t>(values.size());
+            for (auto& value : values)
+            {
+                write(value);
+            }
+        }
+
+        void write_raw(const void* data, size_t size)
+        {
+            const char* bytes = static_cast<const char*>(data);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+        }
+
+        void pad(uint64_t size) { m_buffer.resize(size, 0); }
+        const vector<char>& get_buffer() const { return m_buffer; }
+        size_t size() const { return m_buffer.size(); }
+    private:
+        vector<char> m_buffer;
+    };
+
+    class Reader
+    {
+    public:
+        Reader(const char* data, size_t size)
+            : m_data(data)
+            , m_size(size)
+        {
+        }
+
+        template <typename T>
+        T read()
+        {
+            static_assert(is_arithmetic<T>::value || is_enum<T>::value, "Only scalars are read");
+            T value;
+            memcpy(&value, take(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        string read_string()
+        {
+            auto size = read<uint64_t>();
+            const char* data = take(size);
+            return string(data, data + size);
+        }
+
+        template <typename T>
+        vector<T> read_vector()
+        {
+            vector<T> values(read<uint64_t>());
+            for (auto& value : values)
+            {
+                value = read<T>();
+            }
+            return values;
+        }
+
+        vector<string> read_string_vector()
+        {
+            vector<string> values(read<uint64_t>());
+            for (auto& value : values)
+            {
+                value = read_string();
+            }
+            return values;
+        }
+
+    private:
+        const char* take(uint64_t size)
+        {
+            NGRAPH_CHECK(size <= m_size - m_pos, "Binary serialized function is truncated");
+            const char* data = m_data + m_pos;
+            m_pos += size;
+            return data;
+        }
+
+        const char* m_data;
+        uint64_t m_size;
+        uint64_t m_pos{0};
+    };
+
+    // Writes attributes of a node as (name, kind, value) records and constant data to the data
+    // section
+    class SerializeAttributeVisitor : public AttributeVisitor
+    {
+    public:
+        SerializeAttributeVisitor(Writer& data)
+            : m_data(data)
+        {
+        }
+
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            NGRAPH_CHECK(false, "Attribute \"", name, "\" cannot be serialized to binary format");
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            // aligned segments let the reader copy the data without realigning it
+            m_data.pad(align(m_data.size()));
+            start(name, AttributeKind::Data);
+            m_records.write<uint64_t>(m_data.size());
+            m_records.write<uint64_t>(adapter.size());
+            m_data.write_raw(adapter.get_ptr(), adapter.size());
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            start(name, AttributeKind::String);
+            m_records.write(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            start(name, AttributeKind::Bool);
+            m_records.write<uint8_t>(adapter.get() ? 1 : 0);
+        }
+        void on_adapter(const string& name, ValueAccessor<int8_t>& adapter) override
+        {
+            write_scalar<int64_t>(name, AttributeKind::Int, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int16_t>& adapter) override
+        {
+            write_scalar<int64_t>(name, AttributeKind::Int, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int32_t>& adapter) override
+        {
+            write_scalar<int64_t>(name, AttributeKind::Int, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            write_scalar<int64_t>(name, AttributeKind::Int, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint8_t>& adapter) override
+        {
+            write_scalar<uint64_t>(name, AttributeKind::UInt, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint16_t>& adapter) override
+        {
+            write_scalar<uint64_t>(name, AttributeKind::UInt, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint32_t>& adapter) override
+        {
+            write_scalar<uint64_t>(name, AttributeKind::UInt, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint64_t>& adapter) override
+        {
+            write_scalar<uint64_t>(name, AttributeKind::UInt, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<float>& adapter) override
+        {
+            write_scalar<double>(name, AttributeKind::Real, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            write_scalar<double>(name, AttributeKind::Real, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            write_vector<int64_t>(name, AttributeKind::IntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            write_vector<int64_t>(name, AttributeKind::IntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            write_vector<int64_t>(name, AttributeKind::IntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            write_vector<int64_t>(name, AttributeKind::IntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            write_vector<uint64_t>(name, AttributeKind::UIntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            write_vector<uint64_t>(name, AttributeKind::UIntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            write_vector<uint64_t>(name, AttributeKind::UIntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            write_vector<uint64_t>(name, AttributeKind::UIntVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            write_vector<double>(name, AttributeKind::RealVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            write_vector<double>(name, AttributeKind::RealVector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            start(name, AttributeKind::StringVector);
+            m_records.write_vector(adapter.get());
+        }
+
+        /// \brief Writes the count of visited attributes followed by their records
+        void flush(Writer& table)
+        {
+            table.write<uint64_t>(m_count);
+            table.write_raw(m_records.get_buffer().data(), m_records.size());
+            m_records = Writer();
+            m_count = 0;
+        }
+
+    private:
+        void start(const string& name, AttributeKind kind)
+        {
+            m_records.write(name);
+            m_records.write(kind);
+            m_count++;
+        }
+
+        template <typename ST, typename T>
+        void write_scalar(const string& name, AttributeKind kind, T value)
+        {
+            start(name, kind);
+            m_records.write(static_cast<ST>(value));
+        }
+
+        template <typename ST, typename T>
+        void write_vector(const string& name, AttributeKind kind, const vector<T>& values)
+        {
+            start(name, kind);
+            m_records.write(static_cast<uint64_t>(values.size()));
+            for (auto value : values)
+            {
+                m_records.write(static_cast<ST>(value));
+            }
+        }
+
+        Writer& m_data;
+        Writer m_records;
+        uint64_t m_count{0};
+    };
+
+    struct Attribute
+    {
+        AttributeKind kind;
+        int64_t int_value{0};
+        uint64_t uint_value{0};
+        double real_value{0};
+        string string_value;
+        vector<int64_t> int_values;
+        vector<uint64_t> uint_values;
+        vector<double> real_values;
+        vector<string> string_values;
+    };
+
+    // Sets attributes of a node from the records read by read_attributes
+    class DeserializeAttributeVisitor : public AttributeVisitor
+    {
+    public:
+        DeserializeAttributeVisitor(const char* data, uint64_t data_size)
+            : m_data(data)
+            , m_data_size(data_size)
+        {
+        }
+
+        void read_attributes(Reader& reader)
+        {
+            m_attributes.clear();
+            auto count = reader.read<uint64_t>();
+            for (uint64_t i = 0; i < count; i++)
+            {
+                auto name = reader.read_string();
+                Attribute attribute;
+                attribute.kind = reader.read<AttributeKind>();
+                switch (attribute.kind)
+                {
+                case AttributeKind::Bool:
+                    attribute.uint_value = reader.read<uint8_t>();
+                    break;
+                case AttributeKind::Int: attribute.int_value = reader.read<int64_t>(); break;
+                case AttributeKind::UInt: attribute.uint_value = reader.read<uint64_t>(); break;
+                case AttributeKind::Real: attribute.real_value = reader.read<double>(); break;
+                case AttributeKind::String: attribute.string_value = reader.read_string(); break;
+                case AttributeKind::IntVector:
+                    attribute.int_values = reader.read_vector<int64_t>();
+                    break;
+                case AttributeKind::UIntVector:
+                    attribute.uint_values = reader.read_vector<uint64_t>();
+                    break;
+                case AttributeKind::RealVector:
+                    attribute.real_values = reader.read_vector<double>();
+                    break;
+                case AttributeKind::StringVector:
+                    attribute.string_values = reader.read_string_vector();
+                    break;
+                case AttributeKind::Data:
+                    attribute.uint_values = {reader.read<uint64_t>(), reader.read<uint64_t>()};
+                    break;
+                default:
+                    NGRAPH_CHECK(false, "Unknown kind of attribute \"", name, "\"");
+                }
+                m_attributes.emplace(move(name), move(attribute));
+            }
+        }
+
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            NGRAPH_CHECK(
+                false, "Attribute \"", name, "\" cannot be deserialized from binary format");
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            auto& attribute = get(name, AttributeKind::Data);
+            auto offset = attribute.uint_values[0];
+            auto size = attribute.uint_values[1];
+            NGRAPH_CHECK(size == adapter.size(),
+                         "Size of attribute \"",
+                         name,
+                         "\" does not match: ",
+                         size,
+                         " != ",
+                         adapter.size());
+            NGRAPH_CHECK(offset <= m_data_size && size <= m_data_size - offset,
+                         "Data of attribute \"",
+                         name,
+                         "\" is out of the data section");
+            memcpy(adapter.get_ptr(), m_data + offset, size);
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            adapter.set(get(name, AttributeKind::String).string_value);
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            adapter.set(get(name, AttributeKind::Bool).uint_value != 0);
+        }
+        void on_adapter(const string& name, ValueAccessor<int8_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int16_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int32_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint8_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint16_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint32_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint64_t>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<float>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            set_scalar(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            set_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            adapter.set(get(name, AttributeKind::StringVector).string_values);
+        }
+
+    private:
+        const Attribute& get(const string& name, AttributeKind kind) const
+        {
+            auto it = m_attributes.find(name);
+            NGRAPH_CHECK(it != m_attributes.end(), "Attribute \"", name, "\" is not serialized");
+            NGRAPH_CHECK(it->second.kind == kind, "Attribute \"", name, "\" has a wrong kind");
+            return it->second;
+        }
+
+        template <typename T>
+        T get_number(const Attribute& attribute, size_t index) const
+        {
+            switch (attribute.kind)
+            {
+            case AttributeKind::Int: return static_cast<T>(attribute.int_value);
+            case AttributeKind::UInt: return static_cast<T>(attribute.uint_value);
+            case AttributeKind::Real: return static_cast<T>(attribute.real_value);
+            case AttributeKind::IntVector: return static_cast<T>(attribute.int_values[index]);
+            case AttributeKind::UIntVector: return static_cast<T>(attribute.uint_values[index]);
+            case AttributeKind::RealVector: return static_cast<T>(attribute.real_values[index]);
+            default: NGRAPH_CHECK(false, "Attribute is not a number");
+            }
+            return T();
+        }
+
+        template <typename T>
+        void set_scalar(const string& name, ValueAccessor<T>& adapter)
+        {
+            auto it = m_attributes.find(name);
+            NGRAPH_CHECK(it != m_attributes.end(), "Attribute \"", name, "\" is not serialized");
+            adapter.set(get_number<T>(it->second, 0));
+        }
+
+        template <typename T>
+        void set_vector(const string& name, ValueAccessor<vector<T>>& adapter)
+        {
+            auto it = m_attributes.find(name);
+            NGRAPH_CHECK(it != m_attributes.end(), "Attribute \"", name, "\" is not serialized");
+            auto& attribute = it->second;
+            size_t size = 0;
+            switch (attribute.kind)
+            {
+            case AttributeKind::IntVector: size = attribute.int_values.size(); break;
+            case AttributeKind::UIntVector: size = attribute.uint_values.size(); break;
+            case AttributeKind::RealVector: size = attribute.real_values.size(); break;
+            default: NGRAPH_CHECK(false, "Attribute \"", name, "\" is not a vector");
+            }
+            vector<T> values(size);
+            for (size_t i = 0; i < size; i++)
+            {
+                values[i] = get_number<T>(attribute, i);
+            }
+            adapter.set(values);
+        }
+
+        const char* m_data;
+        uint64_t m_data_size;
+        unordered_map<string, Attribute> m_attributes;
+    };
+}
+
+void ngraph::serialize_binary(ostream& out, const shared_ptr<Function>& func)
+{
+    auto buffer = serialize_binary(func);
+    out.write(buffer.data(), buffer.size());
+}
+
+vector<char> ngraph::serialize_binary(const shared_ptr<Function>& func)
+{
+    Writer table;
+    Writer data;
+    SerializeAttributeVisitor visitor(data);
+
+    auto ops = func->get_ordered_ops();
+    unordered_map<Node*, uint64_t> op_indices;
+    for (auto& op : ops)
+    {
+        op_indices.emplace(op.get(), op_indices.size());
+    }
+    auto index_of = [&](Node* node) {
+        auto it = op_indices.find(node);
+        NGRAPH_CHECK(it != op_indices.end(), "Node ", *node, " is not a part of the function");
+        return it->second;
+    };
+
+    table.write(func->get_friendly_name());
+    table.write<uint64_t>(ops.size());
+    for (auto& op : ops)
+    {
+        auto& type_info = op->get_type_info();
+        NGRAPH_CHECK(FactoryRegistry<Node>::get().has_factory(type_info),
+                     "Op ",
+                     *op,
+                     " cannot be deserialized as it has no factory");
+        table.write(string(type_info.name));
+        table.write<uint64_t>(type_info.version);
+        table.write(op->get_friendly_name());
+
+        table.write<uint64_t>(op->get_input_size());
+        for (auto& input : op->inputs())
+        {
+            auto output = input.get_source_output();
+            table.write<uint64_t>(index_of(output.get_node()));
+            table.write<uint64_t>(output.get_index());
+        }
+        table.write<uint64_t>(op->get_control_dependencies().size());
+        for (auto& dependency : op->get_control_dependencies())
+        {
+            table.write<uint64_t>(index_of(dependency.get()));
+        }
+
+        NGRAPH_CHECK(op->visit_attributes(visitor),
+                     "Op ",
+                     *op,
+                     " does not support attribute visiting");
+        visitor.flush(table);
+    }
+
+    table.write<uint64_t>(func->get_parameters().size());
+    for (auto& parameter : func->get_parameters())
+    {
+        table.write<uint64_t>(index_of(parameter.get()));
+    }
+    table.write<uint64_t>(func->get_results().size());
+    for (auto& result : func->get_results())
+    {
+        table.write<uint64_t>(index_of(result.get()));
+    }
+
+    Header header;
+    memcpy(header.magic, format_magic, sizeof(format_magic));
+    header.version = format_version;
+    header.table_size = table.size();
+    header.data_offset = align(sizeof(Header) + table.size());
+    header.data_size = data.size();
+
+    vector<char> buffer;
+    buffer.reserve(header.data_offset + header.data_size);
+    const char* header_bytes = reinterpret_cast<const char*>(&header);
+    buffer.insert(buffer.end(), header_bytes, header_bytes + sizeof(Header));
+    buffer.insert(buffer.end(), table.get_buffer().begin(), table.get_buffer().end());
+    buffer.resize(header.data_offset, 0);
+    buffer.insert(buffer.end(), data.get_buffer().begin(), data.get_buffer().end());
+    return buffer;
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(istream& in)
+{
+    vector<char> buffer{istreambuf_iterator<char>(in), istreambuf_iterator<char>()};
+    return deserialize_binary(buffer.data(), buffer.size());
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(const void* data, size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    NGRAPH_CHECK(size >= sizeof(Header), "Binary serialized function is truncated");
+    Header header;
+    memcpy(&header, bytes, sizeof(Header));
+    NGRAPH_CHECK(0 == memcmp(header.magic, format_magic, sizeof(format_magic)),
+                 "Data is not a binary serialized function");
+    NGRAPH_CHECK(header.version == format_version,
+                 "Unsupported version of binary serialized function: ",
+                 header.version);
+    NGRAPH_CHECK(header.table_size <= size - sizeof(Header) && header.data_offset <= size &&
+                     header.data_size <= size - header.data_offset,
+                 "Binary serialized function is truncated");
+
+    Reader reader(bytes + sizeof(Header), header.table_size);
+    DeserializeAttributeVisitor visitor(bytes + header.data_offset, header.data_size);
+
+    auto name = reader.read_string();
+    vector<shared_ptr<Node>> ops(reader.read<uint64_t>());
+    for (uint64_t i = 0; i < ops.size(); i++)
+    {
+        auto type_name = reader.read_string();
+        Node::type_info_t type_info{type_name.c_str(), reader.read<uint64_t>()};
+        shared_ptr<Node> node(FactoryRegistry<Node>::get().create(type_info));
+        NGRAPH_CHECK(
+            node != nullptr, "No factory for op ", type_name, " of version ", type_info.version);
+        node->set_friendly_name(reader.read_string());
+
+        OutputVector arguments(reader.read<uint64_t>());
+        for (auto& argument : arguments)
+        {
+            auto producer = reader.read<uint64_t>();
+            auto output = reader.read<uint64_t>();
+            // ops are stored in topological order, so producers are already created
+            NGRAPH_CHECK(producer < i, "Wrong order of ops in binary serialized function");
+            argument = ops[producer]->output(output);
+        }
+        auto dependencies = reader.read<uint64_t>();
+        for (uint64_t j = 0; j < dependencies; j++)
+        {
+            auto dependency = reader.read<uint64_t>();
+            NGRAPH_CHECK(dependency < i, "Wrong order of ops in binary serialized function");
+            node->add_control_dependency(ops[dependency]);
+        }
+
+        visitor.read_attributes(reader);
+        node->visit_attributes(visitor);
+        node->set_arguments(arguments);
+        node->constructor_validate_and_infer_types();
+        ops[i] = node;
+    }
+
+    ParameterVector parameters(reader.read<uint64_t>());
+    for (auto& parameter : parameters)
+    {
+        auto index = reader.read<uint64_t>();
+        NGRAPH_CHECK(index < ops.size(), "Wrong parameter index in binary serialized function");
+        parameter = as_type_ptr<op::Parameter>(ops[index]);
+        NGRAPH_CHECK(parameter != nullptr, "Op ", *ops[index], " is not a Parameter");
+    }
+    ResultVector results(reader.read<uint64_t>());
+    for (auto& result : results)
+    {
+        auto index = reader.read<uint64_t>();
+        NGRAPH_CHECK(index < ops.size(), "Wrong result index in binary serialized function");
+        result = as_type_ptr<op::Result>(ops[index]);
+        NGRAPH_CHECK(result != nullptr, "Op ", *ops[index], " is not a Result");
+    }
+    return make_shared<Function>(results, parameters, name);
+}
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    /// \brief Serialize a Function to the compact binary format
+    ///
+    /// The format starts with a header followed by a flat table of ops in topological order.
+    /// Attributes of every op are written through its visit_attributes method. Constant data
+    /// is stored after the table as raw segments aligned to 64 bytes, so it is copied to the
+    /// constants with a single memcpy on load. Values are stored in the byte order of the host.
+    ///
+    /// Every op of the function must support attribute visiting and must have a factory in
+    /// FactoryRegistry<Node>.
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(std::ostream& out, const std::shared_ptr<Function>& func);
+
+    /// \brief Serialize a Function to a buffer in the compact binary format
+    /// \param func The Function to serialize
+    NGRAPH_API
+    std::vector<char> serialize_binary(const std::shared_ptr<Function>& func);
+
+    /// \brief Deserialize a Function from the compact binary format
+    /// \param in An istream to the input data
+    NGRAPH_API
+    std::shared_ptr<Function> deserialize_binary(std::istream& in);
+
+    /// \brief Deserialize a Function from a buffer in the compact binary format
+    ///
+    /// The buffer, e.g. a memory mapped file, is only read during the call.
+    /// \param data A pointer to the serialized data
+    /// \param size The size of the serialized data in bytes
+    NGRAPH_API
+    std::shared_ptr<Function> deserialize_binary(const void* data, size_t size);
+}
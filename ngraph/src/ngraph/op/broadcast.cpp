@@ -244,6 +244,8 @@ op::v1::Broadcast::Broadcast(const Output<Node>& arg,
 
 void op::v1::Broadcast::validate_and_infer_types()
 {
+    // the spec may be set by set_broadcast_spec or visit_attributes after construction
+    m_mode = to_broadcast_mode(m_broadcast_spec);
     util::BroadcastBase::validate_and_infer_types();
 
     set_input_is_relevant_to_shape(0); // arg - Result element type
@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/broadcast.hpp"
@@ -45,6 +46,13 @@ op::Dot::Dot(const Output<Node>& arg0,
     constructor_validate_and_infer_types();
 }
 
+bool op::Dot::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("reduction_axes_count", m_reduction_axes_count);
+    visitor.on_attribute("has_reduction_axes_count", m_has_reduction_axes_count);
+    return true;
+}
+
 void op::Dot::validate_and_infer_types()
 {
     element::Type result_et;
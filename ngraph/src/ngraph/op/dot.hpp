@@ -64,6 +64,7 @@ namespace ngraph
                 /// \param arg1 The node producing the second argument.
                 Dot(const Output<Node>& arg0, const Output<Node>& arg1);
 
+                bool visit_attributes(AttributeVisitor& visitor) override;
                 void validate_and_infer_types() override;
 
                 virtual std::shared_ptr<Node> get_default_value() const override;
@@ -87,8 +88,8 @@ namespace ngraph
                 }
 
             protected:
-                size_t m_reduction_axes_count;
-                bool m_has_reduction_axes_count;
+                size_t m_reduction_axes_count{0};
+                bool m_has_reduction_axes_count{false};
 
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -20,6 +20,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "ngraph/binary_serializer.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
@@ -28,6 +29,7 @@
 #include "ngraph/op/interpolate.hpp"
 #include "ngraph/op/passthrough.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/opset1_upgrade.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -217,6 +219,106 @@ TEST(benchmark, serialize)
     out << serialize(f, 4);
 }
 
+// A ResNet-like chain of 3x3 convolutions, the serialized zoo has no models with weights
+static shared_ptr<Function> make_conv_chain(size_t blocks)
+{
+    const size_t channels = 64;
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, channels, 56, 56});
+    Output<Node> out = data;
+    // the weights are not uniform, JSON writes uniform constants as a single value
+    vector<float> weights(channels * channels * 9);
+    for (size_t i = 0; i < blocks; i++)
+    {
+        for (size_t j = 0; j < weights.size(); j++)
+        {
+            weights[j] = 0.01f * ((i + j) % 17);
+        }
+        auto filters =
+            op::Constant::create(element::f32, Shape{channels, channels, 3, 3}, weights);
+        auto conv = make_shared<op::v0::Convolution>(out,
+                                                     filters,
+                                                     Strides{1, 1},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{1, 1},
+                                                     CoordinateDiff{1, 1});
+        auto bias = op::Constant::create(
+            element::f32, Shape{1, channels, 1, 1}, vector<float>(channels, 0.1f * i));
+        out = make_shared<op::Relu>(
+            make_shared<op::v0::Add>(conv, bias, op::AutoBroadcastType::NUMPY));
+    }
+    return make_shared<Function>(OutputVector{out}, ParameterVector{data});
+}
+
+TEST(benchmark, DISABLED_serialize_binary)
+{
+    vector<pair<string, shared_ptr<Function>>> functions = {
+        {"generated 16 convolutions", make_conv_chain(16)}};
+    for (const string& model :
+         {"mxnet/mxnet_densenet121_inference_batch1_float32.json",
+          "mxnet/LSTM_forward.json",
+          "mxnet/Seq2Seq_forward.json",
+          "paddlepaddle/ngraph-paddlepaddle-bprop0.json",
+          "tensorflow/resnet8/"
+          "tf_function_cluster_34[_XlaCompiledKernel=true,_XlaNumConstantArgs=7,_"
+          "XlaNumResourceArgs=0].v73.json"})
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        functions.emplace_back(model, deserialize(file_util::read_file_to_string(json_path)));
+    }
+    constexpr size_t num_iterations = 10;
+
+    for (auto& function : functions)
+    {
+        const string& model = function.first;
+        const shared_ptr<Function>& f = function.second;
+        // JSON supports v0 ops only, the binary format needs the ops to visit their attributes,
+        // so each format serializes the version of the model it supports
+        auto upgraded = clone_function(*f);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::Opset1Upgrade>();
+        pass_manager.run_passes(upgraded);
+        string json_string;
+        vector<char> binary;
+        try
+        {
+            binary = serialize_binary(upgraded);
+        }
+        catch (const ngraph_error& e)
+        {
+            NGRAPH_INFO << model << " skipped: " << e.what();
+            continue;
+        }
+
+        stopwatch json_write;
+        stopwatch json_read;
+        stopwatch binary_write;
+        stopwatch binary_read;
+        for (size_t i = 0; i < num_iterations; i++)
+        {
+            json_write.start();
+            json_string = serialize(f);
+            json_write.stop();
+            json_read.start();
+            deserialize(json_string);
+            json_read.stop();
+            binary_write.start();
+            binary = serialize_binary(upgraded);
+            binary_write.stop();
+            binary_read.start();
+            deserialize_binary(binary.data(), binary.size());
+            binary_read.stop();
+        }
+
+        NGRAPH_INFO << model << ", " << f->get_ops().size() << " ops";
+        NGRAPH_INFO << "json   size " << json_string.size() << " bytes, serialize "
+                    << json_write.get_total_microseconds() / num_iterations << "us, deserialize "
+                    << json_read.get_total_microseconds() / num_iterations << "us";
+        NGRAPH_INFO << "binary size " << binary.size() << " bytes, serialize "
+                    << binary_write.get_total_microseconds() / num_iterations << "us, deserialize "
+                    << binary_read.get_total_microseconds() / num_iterations << "us";
+    }
+}
+
 MATCHER_P2(IsOutputShape, type, shape, "")
 {
     return std::get<0>(arg) == type && std::get<1>(arg).to_shape() == shape;
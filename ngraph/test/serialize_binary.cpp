@@ -0,0 +1,165 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/binary_serializer.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_test_function()
+{
+    auto data = make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    data->set_friendly_name("data");
+    auto filters =
+        opset1::Constant::create(element::f32, Shape{3, 2, 2, 2}, vector<float>(24, 0.5f));
+    auto conv = make_shared<opset1::Convolution>(data,
+                                                 filters,
+                                                 Strides{2, 2},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{1, 1});
+    conv->set_friendly_name("conv");
+    auto bias = opset1::Constant::create(element::f32, Shape{1, 3, 1, 1}, {1, 2, 3});
+    auto add = make_shared<opset1::Add>(conv, bias);
+    auto abs = make_shared<opset1::Abs>(add);
+    abs->add_control_dependency(bias);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{data});
+    f->set_friendly_name("test");
+    return f;
+}
+
+TEST(serialize_binary, round_trip)
+{
+    auto f = make_test_function();
+    auto buffer = serialize_binary(f);
+    auto g = deserialize_binary(buffer.data(), buffer.size());
+    ASSERT_NE(g, nullptr);
+
+    EXPECT_EQ(g->get_friendly_name(), "test");
+    ASSERT_EQ(g->get_parameters().size(), 1);
+    EXPECT_EQ(g->get_parameters()[0]->get_friendly_name(), "data");
+    ASSERT_EQ(g->get_results().size(), 1);
+    EXPECT_EQ(g->get_output_element_type(0), element::f32);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{1, 3, 3, 3}));
+
+    auto f_ops = f->get_ordered_ops();
+    auto g_ops = g->get_ordered_ops();
+    ASSERT_EQ(f_ops.size(), g_ops.size());
+    for (size_t i = 0; i < f_ops.size(); i++)
+    {
+        EXPECT_EQ(f_ops[i]->get_type_info(), g_ops[i]->get_type_info());
+        EXPECT_EQ(f_ops[i]->get_friendly_name(), g_ops[i]->get_friendly_name());
+        EXPECT_EQ(f_ops[i]->get_control_dependencies().size(),
+                  g_ops[i]->get_control_dependencies().size());
+    }
+
+    for (auto& op : g_ops)
+    {
+        if (auto conv = as_type_ptr<opset1::Convolution>(op))
+        {
+            EXPECT_EQ(conv->get_strides(), (Strides{2, 2}));
+            EXPECT_EQ(conv->get_pads_begin(), (CoordinateDiff{1, 1}));
+            EXPECT_EQ(conv->get_pads_end(), (CoordinateDiff{0, 0}));
+        }
+        if (auto constant = as_type_ptr<opset1::Constant>(op))
+        {
+            if (constant->get_shape() == Shape{1, 3, 1, 1})
+            {
+                EXPECT_EQ(constant->get_vector<float>(), (vector<float>{1, 2, 3}));
+            }
+            else
+            {
+                EXPECT_EQ(constant->get_vector<float>(), vector<float>(24, 0.5f));
+            }
+        }
+    }
+}
+
+TEST(serialize_binary, v0_dot)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{3, 4, 5});
+    auto dot = make_shared<op::Dot>(a, b, 2);
+    auto f = make_shared<Function>(NodeVector{dot}, ParameterVector{a, b});
+
+    auto buffer = serialize_binary(f);
+    auto g = deserialize_binary(buffer.data(), buffer.size());
+    EXPECT_EQ(g->get_output_shape(0), (Shape{2, 5}));
+    for (auto& op : g->get_ops())
+    {
+        if (auto g_dot = as_type_ptr<op::Dot>(op))
+        {
+            EXPECT_EQ(g_dot->get_reduction_axes_count(), 2);
+            EXPECT_TRUE(g_dot->get_has_reduction_axes_count());
+        }
+    }
+}
+
+TEST(serialize_binary, v1_broadcast_explicit_axes)
+{
+    // the target shape {41, 37} is valid for the explicit axes mapping only
+    auto data = make_shared<opset1::Parameter>(element::f32, Shape{41});
+    auto target_shape = opset1::Constant::create(element::i64, Shape{2}, {41, 37});
+    auto axes_mapping = opset1::Constant::create(element::i64, Shape{1}, {0});
+    auto broadcast = make_shared<opset1::Broadcast>(data, target_shape, axes_mapping);
+    auto f = make_shared<Function>(NodeVector{broadcast}, ParameterVector{data});
+
+    auto buffer = serialize_binary(f);
+    auto g = deserialize_binary(buffer.data(), buffer.size());
+    EXPECT_EQ(g->get_output_shape(0), (Shape{41, 37}));
+}
+
+TEST(serialize_binary, stream)
+{
+    auto f = make_test_function();
+    stringstream ss;
+    serialize_binary(ss, f);
+    auto g = deserialize_binary(ss);
+    ASSERT_NE(g, nullptr);
+    EXPECT_EQ(g->get_ordered_ops().size(), f->get_ordered_ops().size());
+}
+
+TEST(serialize_binary, constant_data_alignment)
+{
+    auto f = make_test_function();
+    auto buffer = serialize_binary(f);
+    // constant data starts at an aligned offset, so it can be used directly from a mapped file
+    uint64_t data_offset;
+    memcpy(&data_offset, buffer.data() + 16, sizeof(data_offset));
+    EXPECT_EQ(data_offset % 64, 0);
+    EXPECT_LE(data_offset + 27 * sizeof(float), buffer.size());
+}
+
+TEST(serialize_binary, wrong_magic)
+{
+    auto buffer = serialize_binary(make_test_function());
+    buffer[0] = 'X';
+    EXPECT_THROW(deserialize_binary(buffer.data(), buffer.size()), CheckFailure);
+}
+
+TEST(serialize_binary, truncated)
+{
+    auto buffer = serialize_binary(make_test_function());
+    EXPECT_THROW(deserialize_binary(buffer.data(), 8), CheckFailure);
+    EXPECT_THROW(deserialize_binary(buffer.data(), buffer.size() - 1), CheckFailure);
+}